@@ -0,0 +1,10 @@
+/*
+ Runs the script unit tests on their own, without the rest of config.as.  Used by the native test harness.
+*/
+
+#include "TestFramework.as"
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void main() {
+	UnitTest::ExecuteTests();
+}
@@ -1,18 +1,26 @@
 /*
  Tests and example configuration.
+ 
+ A test set is a namespace with a "void ExecuteTests()" that runs its tests in order.  Each "void Test*()" function in such a
+ namespace is one test: nlsscripttest finds them on its own and runs them in parallel, so a test must not depend on another
+ having run first.  Prefix a test that should not run with DISABLED_.
 */
 
 #include "TestMathVector3.as"
 #include "TestMathRotation.as"
+#include "TestMathMatrix.as"
+#include "TestMathArrays.as"
 
 namespace UnitTest {
 	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 	void ExecuteTests() {
 		// Run Tests
-		VerifyAsserts();
+		TestAsserts();
 		
 		RotationMathTests::ExecuteTests();
 		Vector3MathTests::ExecuteTests();
+		MatrixMathTests::ExecuteTests();
+		MathArrayTests::ExecuteTests();
 		
 		if (gTestStatus) {
 			Engine::LOG(Engine::LOG_PRIORITY::INFO, "All tests passed.");
@@ -24,7 +32,7 @@ namespace UnitTest {
 	}
 	
 	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-	void VerifyAsserts() {
+	void TestAsserts() {
 		ASSERT_TRUE(true);   EXPECT_TRUE(true);
 		ASSERT_FALSE(false); EXPECT_FALSE(false);
 		
@@ -79,157 +87,158 @@ namespace UnitTest {
 	}
 	
 	bool gTestStatus = true;
+	uint gAssertionCount = 0; ///< Number of assertions checked, passed or not.
 	
 	// Boolean "simple" tests
-	void ASSERT_TRUE (const bool&in a, string message = "")  { if (!a)  { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_TRUE failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
-	void EXPECT_TRUE (const bool&in a, string message = "")  { if (!a)  { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_TRUE failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
+	void ASSERT_TRUE (const bool&in a, string message = "")  { gAssertionCount++; if (!a)  { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_TRUE failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
+	void EXPECT_TRUE (const bool&in a, string message = "")  { gAssertionCount++; if (!a)  { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_TRUE failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
 	
-	void ASSERT_FALSE(const bool&in a, string message = "") { if (a) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_FALSE failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
-	void EXPECT_FALSE(const bool&in a, string message = "") { if (a) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_FALSE failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
+	void ASSERT_FALSE(const bool&in a, string message = "") { gAssertionCount++; if (a) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_FALSE failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
+	void EXPECT_FALSE(const bool&in a, string message = "") { gAssertionCount++; if (a) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_FALSE failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
 	
 	// Equal tests
-	void ASSERT_EQ(const uint8  &in a, const uint8  &in b, string message = "") { if (a != b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_EQ(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
-	void ASSERT_EQ(const uint16 &in a, const uint16 &in b, string message = "") { if (a != b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_EQ(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
-	void ASSERT_EQ(const uint   &in a, const uint   &in b, string message = "") { if (a != b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_EQ(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
-	void ASSERT_EQ(const uint64 &in a, const uint64 &in b, string message = "") { if (a != b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_EQ(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
-	void ASSERT_EQ(const  int8  &in a, const  int8  &in b, string message = "") { if (a != b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_EQ(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
-	void ASSERT_EQ(const  int16 &in a, const  int16 &in b, string message = "") { if (a != b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_EQ(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
-	void ASSERT_EQ(const  int   &in a, const  int   &in b, string message = "") { if (a != b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_EQ(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
-	void ASSERT_EQ(const  int64 &in a, const  int64 &in b, string message = "") { if (a != b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_EQ(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
-	void ASSERT_EQ(const  float &in a, const  float &in b, string message = "") { if (a != b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_EQ(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
-	void ASSERT_EQ(const  double&in a, const  double&in b, string message = "") { if (a != b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_EQ(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
-	void ASSERT_EQ(const  bool  &in a, const  bool  &in b, string message = "") { if (a != b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_EQ(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
-	void ASSERT_EQ(const  string&in a, const  string&in b, string message = "") { if (a != b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_EQ(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
-	void EXPECT_EQ(const uint8  &in a, const uint8  &in b, string message = "") { if (a != b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_EQ(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
-	void EXPECT_EQ(const uint16 &in a, const uint16 &in b, string message = "") { if (a != b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_EQ(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
-	void EXPECT_EQ(const uint   &in a, const uint   &in b, string message = "") { if (a != b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_EQ(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
-	void EXPECT_EQ(const uint64 &in a, const uint64 &in b, string message = "") { if (a != b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_EQ(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
-	void EXPECT_EQ(const  int8  &in a, const  int8  &in b, string message = "") { if (a != b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_EQ(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
-	void EXPECT_EQ(const  int16 &in a, const  int16 &in b, string message = "") { if (a != b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_EQ(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
-	void EXPECT_EQ(const  int   &in a, const  int   &in b, string message = "") { if (a != b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_EQ(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
-	void EXPECT_EQ(const  int64 &in a, const  int64 &in b, string message = "") { if (a != b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_EQ(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
-	void EXPECT_EQ(const  float &in a, const  float &in b, string message = "") { if (a != b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_EQ(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
-	void EXPECT_EQ(const  double&in a, const  double&in b, string message = "") { if (a != b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_EQ(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
-	void EXPECT_EQ(const  bool  &in a, const  bool  &in b, string message = "") { if (a != b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_EQ(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
-	void EXPECT_EQ(const  string&in a, const  string&in b, string message = "") { if (a != b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_EQ(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
+	void ASSERT_EQ(const uint8  &in a, const uint8  &in b, string message = "") { gAssertionCount++; if (a != b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_EQ(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
+	void ASSERT_EQ(const uint16 &in a, const uint16 &in b, string message = "") { gAssertionCount++; if (a != b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_EQ(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
+	void ASSERT_EQ(const uint   &in a, const uint   &in b, string message = "") { gAssertionCount++; if (a != b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_EQ(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
+	void ASSERT_EQ(const uint64 &in a, const uint64 &in b, string message = "") { gAssertionCount++; if (a != b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_EQ(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
+	void ASSERT_EQ(const  int8  &in a, const  int8  &in b, string message = "") { gAssertionCount++; if (a != b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_EQ(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
+	void ASSERT_EQ(const  int16 &in a, const  int16 &in b, string message = "") { gAssertionCount++; if (a != b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_EQ(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
+	void ASSERT_EQ(const  int   &in a, const  int   &in b, string message = "") { gAssertionCount++; if (a != b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_EQ(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
+	void ASSERT_EQ(const  int64 &in a, const  int64 &in b, string message = "") { gAssertionCount++; if (a != b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_EQ(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
+	void ASSERT_EQ(const  float &in a, const  float &in b, string message = "") { gAssertionCount++; if (a != b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_EQ(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
+	void ASSERT_EQ(const  double&in a, const  double&in b, string message = "") { gAssertionCount++; if (a != b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_EQ(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
+	void ASSERT_EQ(const  bool  &in a, const  bool  &in b, string message = "") { gAssertionCount++; if (a != b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_EQ(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
+	void ASSERT_EQ(const  string&in a, const  string&in b, string message = "") { gAssertionCount++; if (a != b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_EQ(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
+	void EXPECT_EQ(const uint8  &in a, const uint8  &in b, string message = "") { gAssertionCount++; if (a != b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_EQ(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
+	void EXPECT_EQ(const uint16 &in a, const uint16 &in b, string message = "") { gAssertionCount++; if (a != b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_EQ(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
+	void EXPECT_EQ(const uint   &in a, const uint   &in b, string message = "") { gAssertionCount++; if (a != b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_EQ(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
+	void EXPECT_EQ(const uint64 &in a, const uint64 &in b, string message = "") { gAssertionCount++; if (a != b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_EQ(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
+	void EXPECT_EQ(const  int8  &in a, const  int8  &in b, string message = "") { gAssertionCount++; if (a != b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_EQ(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
+	void EXPECT_EQ(const  int16 &in a, const  int16 &in b, string message = "") { gAssertionCount++; if (a != b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_EQ(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
+	void EXPECT_EQ(const  int   &in a, const  int   &in b, string message = "") { gAssertionCount++; if (a != b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_EQ(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
+	void EXPECT_EQ(const  int64 &in a, const  int64 &in b, string message = "") { gAssertionCount++; if (a != b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_EQ(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
+	void EXPECT_EQ(const  float &in a, const  float &in b, string message = "") { gAssertionCount++; if (a != b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_EQ(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
+	void EXPECT_EQ(const  double&in a, const  double&in b, string message = "") { gAssertionCount++; if (a != b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_EQ(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
+	void EXPECT_EQ(const  bool  &in a, const  bool  &in b, string message = "") { gAssertionCount++; if (a != b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_EQ(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
+	void EXPECT_EQ(const  string&in a, const  string&in b, string message = "") { gAssertionCount++; if (a != b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_EQ(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
 	
 	// Near tests for floates
-	void ASSERT_NEAR(const  float &in a, const  float &in b, const float &in range = 0.00001f, string message = "") { if (Math::abs(a - b) >= range) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_NEAR(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
-	void ASSERT_NEAR(const  double&in a, const  double&in b, const double&in range = 0.00001,  string message = "") { if (Math::abs(a - b) >= range) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_NEAR(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
-	void EXPECT_NEAR(const  float &in a, const  float &in b, const float &in range = 0.00001f, string message = "") { if (Math::abs(a - b) >= range) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_NEAR(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
-	void EXPECT_NEAR(const  double&in a, const  double&in b, const double&in range = 0.00001,  string message = "") { if (Math::abs(a - b) >= range) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_NEAR(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
+	void ASSERT_NEAR(const  float &in a, const  float &in b, const float &in range = 0.00001f, string message = "") { gAssertionCount++; if (Math::abs(a - b) >= range) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_NEAR(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
+	void ASSERT_NEAR(const  double&in a, const  double&in b, const double&in range = 0.00001,  string message = "") { gAssertionCount++; if (Math::abs(a - b) >= range) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_NEAR(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
+	void EXPECT_NEAR(const  float &in a, const  float &in b, const float &in range = 0.00001f, string message = "") { gAssertionCount++; if (Math::abs(a - b) >= range) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_NEAR(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
+	void EXPECT_NEAR(const  double&in a, const  double&in b, const double&in range = 0.00001,  string message = "") { gAssertionCount++; if (Math::abs(a - b) >= range) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_NEAR(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
 	
 	// Not equal tests
-	void ASSERT_NE(const uint8  &in a, const uint8  &in b, string message = "") { if (a == b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_NE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
-	void ASSERT_NE(const uint16 &in a, const uint16 &in b, string message = "") { if (a == b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_NE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
-	void ASSERT_NE(const uint   &in a, const uint   &in b, string message = "") { if (a == b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_NE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
-	void ASSERT_NE(const uint64 &in a, const uint64 &in b, string message = "") { if (a == b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_NE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
-	void ASSERT_NE(const  int8  &in a, const  int8  &in b, string message = "") { if (a == b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_NE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
-	void ASSERT_NE(const  int16 &in a, const  int16 &in b, string message = "") { if (a == b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_NE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
-	void ASSERT_NE(const  int   &in a, const  int   &in b, string message = "") { if (a == b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_NE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
-	void ASSERT_NE(const  int64 &in a, const  int64 &in b, string message = "") { if (a == b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_NE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
-	void ASSERT_NE(const  float &in a, const  float &in b, string message = "") { if (a == b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_NE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
-	void ASSERT_NE(const  double&in a, const  double&in b, string message = "") { if (a == b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_NE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
-	void ASSERT_NE(const  bool  &in a, const  bool  &in b, string message = "") { if (a == b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_NE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
-	void ASSERT_NE(const  string&in a, const  string&in b, string message = "") { if (a == b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_NE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
-	void EXPECT_NE(const uint8  &in a, const uint8  &in b, string message = "") { if (a == b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_NE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
-	void EXPECT_NE(const uint16 &in a, const uint16 &in b, string message = "") { if (a == b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_NE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
-	void EXPECT_NE(const uint   &in a, const uint   &in b, string message = "") { if (a == b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_NE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
-	void EXPECT_NE(const uint64 &in a, const uint64 &in b, string message = "") { if (a == b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_NE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
-	void EXPECT_NE(const  int8  &in a, const  int8  &in b, string message = "") { if (a == b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_NE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
-	void EXPECT_NE(const  int16 &in a, const  int16 &in b, string message = "") { if (a == b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_NE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
-	void EXPECT_NE(const  int   &in a, const  int   &in b, string message = "") { if (a == b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_NE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
-	void EXPECT_NE(const  int64 &in a, const  int64 &in b, string message = "") { if (a == b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_NE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
-	void EXPECT_NE(const  float &in a, const  float &in b, string message = "") { if (a == b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_NE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
-	void EXPECT_NE(const  double&in a, const  double&in b, string message = "") { if (a == b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_NE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
-	void EXPECT_NE(const  bool  &in a, const  bool  &in b, string message = "") { if (a == b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_NE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
-	void EXPECT_NE(const  string&in a, const  string&in b, string message = "") { if (a == b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_NE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
+	void ASSERT_NE(const uint8  &in a, const uint8  &in b, string message = "") { gAssertionCount++; if (a == b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_NE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
+	void ASSERT_NE(const uint16 &in a, const uint16 &in b, string message = "") { gAssertionCount++; if (a == b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_NE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
+	void ASSERT_NE(const uint   &in a, const uint   &in b, string message = "") { gAssertionCount++; if (a == b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_NE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
+	void ASSERT_NE(const uint64 &in a, const uint64 &in b, string message = "") { gAssertionCount++; if (a == b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_NE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
+	void ASSERT_NE(const  int8  &in a, const  int8  &in b, string message = "") { gAssertionCount++; if (a == b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_NE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
+	void ASSERT_NE(const  int16 &in a, const  int16 &in b, string message = "") { gAssertionCount++; if (a == b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_NE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
+	void ASSERT_NE(const  int   &in a, const  int   &in b, string message = "") { gAssertionCount++; if (a == b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_NE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
+	void ASSERT_NE(const  int64 &in a, const  int64 &in b, string message = "") { gAssertionCount++; if (a == b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_NE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
+	void ASSERT_NE(const  float &in a, const  float &in b, string message = "") { gAssertionCount++; if (a == b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_NE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
+	void ASSERT_NE(const  double&in a, const  double&in b, string message = "") { gAssertionCount++; if (a == b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_NE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
+	void ASSERT_NE(const  bool  &in a, const  bool  &in b, string message = "") { gAssertionCount++; if (a == b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_NE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
+	void ASSERT_NE(const  string&in a, const  string&in b, string message = "") { gAssertionCount++; if (a == b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_NE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
+	void EXPECT_NE(const uint8  &in a, const uint8  &in b, string message = "") { gAssertionCount++; if (a == b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_NE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
+	void EXPECT_NE(const uint16 &in a, const uint16 &in b, string message = "") { gAssertionCount++; if (a == b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_NE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
+	void EXPECT_NE(const uint   &in a, const uint   &in b, string message = "") { gAssertionCount++; if (a == b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_NE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
+	void EXPECT_NE(const uint64 &in a, const uint64 &in b, string message = "") { gAssertionCount++; if (a == b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_NE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
+	void EXPECT_NE(const  int8  &in a, const  int8  &in b, string message = "") { gAssertionCount++; if (a == b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_NE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
+	void EXPECT_NE(const  int16 &in a, const  int16 &in b, string message = "") { gAssertionCount++; if (a == b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_NE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
+	void EXPECT_NE(const  int   &in a, const  int   &in b, string message = "") { gAssertionCount++; if (a == b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_NE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
+	void EXPECT_NE(const  int64 &in a, const  int64 &in b, string message = "") { gAssertionCount++; if (a == b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_NE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
+	void EXPECT_NE(const  float &in a, const  float &in b, string message = "") { gAssertionCount++; if (a == b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_NE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
+	void EXPECT_NE(const  double&in a, const  double&in b, string message = "") { gAssertionCount++; if (a == b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_NE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
+	void EXPECT_NE(const  bool  &in a, const  bool  &in b, string message = "") { gAssertionCount++; if (a == b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_NE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
+	void EXPECT_NE(const  string&in a, const  string&in b, string message = "") { gAssertionCount++; if (a == b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_NE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
 	
 	// Less than tests
-	void ASSERT_LT(const uint8  &in a, const uint8  &in b, string message = "") { if (a >= b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_LT(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
-	void ASSERT_LT(const uint16 &in a, const uint16 &in b, string message = "") { if (a >= b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_LT(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
-	void ASSERT_LT(const uint   &in a, const uint   &in b, string message = "") { if (a >= b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_LT(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
-	void ASSERT_LT(const uint64 &in a, const uint64 &in b, string message = "") { if (a >= b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_LT(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
-	void ASSERT_LT(const  int8  &in a, const  int8  &in b, string message = "") { if (a >= b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_LT(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
-	void ASSERT_LT(const  int16 &in a, const  int16 &in b, string message = "") { if (a >= b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_LT(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
-	void ASSERT_LT(const  int   &in a, const  int   &in b, string message = "") { if (a >= b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_LT(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
-	void ASSERT_LT(const  int64 &in a, const  int64 &in b, string message = "") { if (a >= b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_LT(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
-	void ASSERT_LT(const  float &in a, const  float &in b, string message = "") { if (a >= b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_LT(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
-	void ASSERT_LT(const  double&in a, const  double&in b, string message = "") { if (a >= b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_LT(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
-	void EXPECT_LT(const uint8  &in a, const uint8  &in b, string message = "") { if (a >= b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_LT(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
-	void EXPECT_LT(const uint16 &in a, const uint16 &in b, string message = "") { if (a >= b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_LT(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
-	void EXPECT_LT(const uint   &in a, const uint   &in b, string message = "") { if (a >= b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_LT(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
-	void EXPECT_LT(const uint64 &in a, const uint64 &in b, string message = "") { if (a >= b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_LT(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
-	void EXPECT_LT(const  int8  &in a, const  int8  &in b, string message = "") { if (a >= b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_LT(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
-	void EXPECT_LT(const  int16 &in a, const  int16 &in b, string message = "") { if (a >= b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_LT(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
-	void EXPECT_LT(const  int   &in a, const  int   &in b, string message = "") { if (a >= b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_LT(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
-	void EXPECT_LT(const  int64 &in a, const  int64 &in b, string message = "") { if (a >= b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_LT(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
-	void EXPECT_LT(const  float &in a, const  float &in b, string message = "") { if (a >= b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_LT(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
-	void EXPECT_LT(const  double&in a, const  double&in b, string message = "") { if (a >= b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_LT(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
+	void ASSERT_LT(const uint8  &in a, const uint8  &in b, string message = "") { gAssertionCount++; if (a >= b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_LT(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
+	void ASSERT_LT(const uint16 &in a, const uint16 &in b, string message = "") { gAssertionCount++; if (a >= b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_LT(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
+	void ASSERT_LT(const uint   &in a, const uint   &in b, string message = "") { gAssertionCount++; if (a >= b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_LT(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
+	void ASSERT_LT(const uint64 &in a, const uint64 &in b, string message = "") { gAssertionCount++; if (a >= b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_LT(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
+	void ASSERT_LT(const  int8  &in a, const  int8  &in b, string message = "") { gAssertionCount++; if (a >= b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_LT(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
+	void ASSERT_LT(const  int16 &in a, const  int16 &in b, string message = "") { gAssertionCount++; if (a >= b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_LT(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
+	void ASSERT_LT(const  int   &in a, const  int   &in b, string message = "") { gAssertionCount++; if (a >= b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_LT(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
+	void ASSERT_LT(const  int64 &in a, const  int64 &in b, string message = "") { gAssertionCount++; if (a >= b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_LT(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
+	void ASSERT_LT(const  float &in a, const  float &in b, string message = "") { gAssertionCount++; if (a >= b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_LT(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
+	void ASSERT_LT(const  double&in a, const  double&in b, string message = "") { gAssertionCount++; if (a >= b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_LT(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
+	void EXPECT_LT(const uint8  &in a, const uint8  &in b, string message = "") { gAssertionCount++; if (a >= b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_LT(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
+	void EXPECT_LT(const uint16 &in a, const uint16 &in b, string message = "") { gAssertionCount++; if (a >= b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_LT(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
+	void EXPECT_LT(const uint   &in a, const uint   &in b, string message = "") { gAssertionCount++; if (a >= b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_LT(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
+	void EXPECT_LT(const uint64 &in a, const uint64 &in b, string message = "") { gAssertionCount++; if (a >= b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_LT(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
+	void EXPECT_LT(const  int8  &in a, const  int8  &in b, string message = "") { gAssertionCount++; if (a >= b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_LT(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
+	void EXPECT_LT(const  int16 &in a, const  int16 &in b, string message = "") { gAssertionCount++; if (a >= b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_LT(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
+	void EXPECT_LT(const  int   &in a, const  int   &in b, string message = "") { gAssertionCount++; if (a >= b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_LT(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
+	void EXPECT_LT(const  int64 &in a, const  int64 &in b, string message = "") { gAssertionCount++; if (a >= b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_LT(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
+	void EXPECT_LT(const  float &in a, const  float &in b, string message = "") { gAssertionCount++; if (a >= b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_LT(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
+	void EXPECT_LT(const  double&in a, const  double&in b, string message = "") { gAssertionCount++; if (a >= b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_LT(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
 	
 	// Less than or equal tests
-	void ASSERT_LE(const uint8  &in a, const uint8  &in b, string message = "") { if (a  > b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_LE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
-	void ASSERT_LE(const uint16 &in a, const uint16 &in b, string message = "") { if (a  > b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_LE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
-	void ASSERT_LE(const uint   &in a, const uint   &in b, string message = "") { if (a  > b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_LE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
-	void ASSERT_LE(const uint64 &in a, const uint64 &in b, string message = "") { if (a  > b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_LE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
-	void ASSERT_LE(const  int8  &in a, const  int8  &in b, string message = "") { if (a  > b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_LE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
-	void ASSERT_LE(const  int16 &in a, const  int16 &in b, string message = "") { if (a  > b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_LE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
-	void ASSERT_LE(const  int   &in a, const  int   &in b, string message = "") { if (a  > b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_LE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
-	void ASSERT_LE(const  int64 &in a, const  int64 &in b, string message = "") { if (a  > b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_LE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
-	void ASSERT_LE(const  float &in a, const  float &in b, string message = "") { if (a  > b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_LE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
-	void ASSERT_LE(const  double&in a, const  double&in b, string message = "") { if (a  > b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_LE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
-	void EXPECT_LE(const uint8  &in a, const uint8  &in b, string message = "") { if (a  > b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_LE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
-	void EXPECT_LE(const uint16 &in a, const uint16 &in b, string message = "") { if (a  > b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_LE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
-	void EXPECT_LE(const uint   &in a, const uint   &in b, string message = "") { if (a  > b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_LE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
-	void EXPECT_LE(const uint64 &in a, const uint64 &in b, string message = "") { if (a  > b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_LE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
-	void EXPECT_LE(const  int8  &in a, const  int8  &in b, string message = "") { if (a  > b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_LE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
-	void EXPECT_LE(const  int16 &in a, const  int16 &in b, string message = "") { if (a  > b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_LE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
-	void EXPECT_LE(const  int   &in a, const  int   &in b, string message = "") { if (a  > b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_LE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
-	void EXPECT_LE(const  int64 &in a, const  int64 &in b, string message = "") { if (a  > b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_LE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
-	void EXPECT_LE(const  float &in a, const  float &in b, string message = "") { if (a  > b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_LE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
-	void EXPECT_LE(const  double&in a, const  double&in b, string message = "") { if (a  > b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_LE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
+	void ASSERT_LE(const uint8  &in a, const uint8  &in b, string message = "") { gAssertionCount++; if (a  > b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_LE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
+	void ASSERT_LE(const uint16 &in a, const uint16 &in b, string message = "") { gAssertionCount++; if (a  > b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_LE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
+	void ASSERT_LE(const uint   &in a, const uint   &in b, string message = "") { gAssertionCount++; if (a  > b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_LE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
+	void ASSERT_LE(const uint64 &in a, const uint64 &in b, string message = "") { gAssertionCount++; if (a  > b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_LE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
+	void ASSERT_LE(const  int8  &in a, const  int8  &in b, string message = "") { gAssertionCount++; if (a  > b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_LE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
+	void ASSERT_LE(const  int16 &in a, const  int16 &in b, string message = "") { gAssertionCount++; if (a  > b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_LE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
+	void ASSERT_LE(const  int   &in a, const  int   &in b, string message = "") { gAssertionCount++; if (a  > b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_LE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
+	void ASSERT_LE(const  int64 &in a, const  int64 &in b, string message = "") { gAssertionCount++; if (a  > b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_LE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
+	void ASSERT_LE(const  float &in a, const  float &in b, string message = "") { gAssertionCount++; if (a  > b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_LE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
+	void ASSERT_LE(const  double&in a, const  double&in b, string message = "") { gAssertionCount++; if (a  > b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_LE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
+	void EXPECT_LE(const uint8  &in a, const uint8  &in b, string message = "") { gAssertionCount++; if (a  > b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_LE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
+	void EXPECT_LE(const uint16 &in a, const uint16 &in b, string message = "") { gAssertionCount++; if (a  > b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_LE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
+	void EXPECT_LE(const uint   &in a, const uint   &in b, string message = "") { gAssertionCount++; if (a  > b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_LE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
+	void EXPECT_LE(const uint64 &in a, const uint64 &in b, string message = "") { gAssertionCount++; if (a  > b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_LE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
+	void EXPECT_LE(const  int8  &in a, const  int8  &in b, string message = "") { gAssertionCount++; if (a  > b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_LE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
+	void EXPECT_LE(const  int16 &in a, const  int16 &in b, string message = "") { gAssertionCount++; if (a  > b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_LE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
+	void EXPECT_LE(const  int   &in a, const  int   &in b, string message = "") { gAssertionCount++; if (a  > b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_LE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
+	void EXPECT_LE(const  int64 &in a, const  int64 &in b, string message = "") { gAssertionCount++; if (a  > b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_LE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
+	void EXPECT_LE(const  float &in a, const  float &in b, string message = "") { gAssertionCount++; if (a  > b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_LE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
+	void EXPECT_LE(const  double&in a, const  double&in b, string message = "") { gAssertionCount++; if (a  > b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_LE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
 	
 	// Greater than tests
-	void ASSERT_GT(const uint8  &in a, const uint8  &in b, string message = "") { if (a <= b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_GT(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
-	void ASSERT_GT(const uint16 &in a, const uint16 &in b, string message = "") { if (a <= b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_GT(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
-	void ASSERT_GT(const uint   &in a, const uint   &in b, string message = "") { if (a <= b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_GT(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
-	void ASSERT_GT(const uint64 &in a, const uint64 &in b, string message = "") { if (a <= b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_GT(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
-	void ASSERT_GT(const  int8  &in a, const  int8  &in b, string message = "") { if (a <= b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_GT(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
-	void ASSERT_GT(const  int16 &in a, const  int16 &in b, string message = "") { if (a <= b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_GT(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
-	void ASSERT_GT(const  int   &in a, const  int   &in b, string message = "") { if (a <= b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_GT(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
-	void ASSERT_GT(const  int64 &in a, const  int64 &in b, string message = "") { if (a <= b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_GT(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
-	void ASSERT_GT(const  float &in a, const  float &in b, string message = "") { if (a <= b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_GT(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
-	void ASSERT_GT(const  double&in a, const  double&in b, string message = "") { if (a <= b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_GT(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
-	void EXPECT_GT(const uint8  &in a, const uint8  &in b, string message = "") { if (a <= b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_GT(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
-	void EXPECT_GT(const uint16 &in a, const uint16 &in b, string message = "") { if (a <= b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_GT(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
-	void EXPECT_GT(const uint   &in a, const uint   &in b, string message = "") { if (a <= b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_GT(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
-	void EXPECT_GT(const uint64 &in a, const uint64 &in b, string message = "") { if (a <= b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_GT(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
-	void EXPECT_GT(const  int8  &in a, const  int8  &in b, string message = "") { if (a <= b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_GT(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
-	void EXPECT_GT(const  int16 &in a, const  int16 &in b, string message = "") { if (a <= b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_GT(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
-	void EXPECT_GT(const  int   &in a, const  int   &in b, string message = "") { if (a <= b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_GT(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
-	void EXPECT_GT(const  int64 &in a, const  int64 &in b, string message = "") { if (a <= b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_GT(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
-	void EXPECT_GT(const  float &in a, const  float &in b, string message = "") { if (a <= b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_GT(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
-	void EXPECT_GT(const  double&in a, const  double&in b, string message = "") { if (a <= b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_GT(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
+	void ASSERT_GT(const uint8  &in a, const uint8  &in b, string message = "") { gAssertionCount++; if (a <= b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_GT(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
+	void ASSERT_GT(const uint16 &in a, const uint16 &in b, string message = "") { gAssertionCount++; if (a <= b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_GT(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
+	void ASSERT_GT(const uint   &in a, const uint   &in b, string message = "") { gAssertionCount++; if (a <= b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_GT(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
+	void ASSERT_GT(const uint64 &in a, const uint64 &in b, string message = "") { gAssertionCount++; if (a <= b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_GT(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
+	void ASSERT_GT(const  int8  &in a, const  int8  &in b, string message = "") { gAssertionCount++; if (a <= b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_GT(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
+	void ASSERT_GT(const  int16 &in a, const  int16 &in b, string message = "") { gAssertionCount++; if (a <= b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_GT(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
+	void ASSERT_GT(const  int   &in a, const  int   &in b, string message = "") { gAssertionCount++; if (a <= b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_GT(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
+	void ASSERT_GT(const  int64 &in a, const  int64 &in b, string message = "") { gAssertionCount++; if (a <= b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_GT(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
+	void ASSERT_GT(const  float &in a, const  float &in b, string message = "") { gAssertionCount++; if (a <= b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_GT(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
+	void ASSERT_GT(const  double&in a, const  double&in b, string message = "") { gAssertionCount++; if (a <= b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_GT(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
+	void EXPECT_GT(const uint8  &in a, const uint8  &in b, string message = "") { gAssertionCount++; if (a <= b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_GT(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
+	void EXPECT_GT(const uint16 &in a, const uint16 &in b, string message = "") { gAssertionCount++; if (a <= b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_GT(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
+	void EXPECT_GT(const uint   &in a, const uint   &in b, string message = "") { gAssertionCount++; if (a <= b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_GT(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
+	void EXPECT_GT(const uint64 &in a, const uint64 &in b, string message = "") { gAssertionCount++; if (a <= b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_GT(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
+	void EXPECT_GT(const  int8  &in a, const  int8  &in b, string message = "") { gAssertionCount++; if (a <= b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_GT(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
+	void EXPECT_GT(const  int16 &in a, const  int16 &in b, string message = "") { gAssertionCount++; if (a <= b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_GT(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
+	void EXPECT_GT(const  int   &in a, const  int   &in b, string message = "") { gAssertionCount++; if (a <= b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_GT(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
+	void EXPECT_GT(const  int64 &in a, const  int64 &in b, string message = "") { gAssertionCount++; if (a <= b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_GT(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
+	void EXPECT_GT(const  float &in a, const  float &in b, string message = "") { gAssertionCount++; if (a <= b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_GT(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
+	void EXPECT_GT(const  double&in a, const  double&in b, string message = "") { gAssertionCount++; if (a <= b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_GT(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
 	
 	// Greater than or equal tests
-	void ASSERT_GE(const uint8  &in a, const uint8  &in b, string message = "") { if (a  < b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_GE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
-	void ASSERT_GE(const uint16 &in a, const uint16 &in b, string message = "") { if (a  < b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_GE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
-	void ASSERT_GE(const uint   &in a, const uint   &in b, string message = "") { if (a  < b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_GE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
-	void ASSERT_GE(const uint64 &in a, const uint64 &in b, string message = "") { if (a  < b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_GE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
-	void ASSERT_GE(const  int8  &in a, const  int8  &in b, string message = "") { if (a  < b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_GE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
-	void ASSERT_GE(const  int16 &in a, const  int16 &in b, string message = "") { if (a  < b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_GE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
-	void ASSERT_GE(const  int   &in a, const  int   &in b, string message = "") { if (a  < b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_GE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
-	void ASSERT_GE(const  int64 &in a, const  int64 &in b, string message = "") { if (a  < b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_GE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
-	void ASSERT_GE(const  float &in a, const  float &in b, string message = "") { if (a  < b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_GE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
-	void ASSERT_GE(const  double&in a, const  double&in b, string message = "") { if (a  < b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_GE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
-	void EXPECT_GE(const uint8  &in a, const uint8  &in b, string message = "") { if (a  < b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_GE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
-	void EXPECT_GE(const uint16 &in a, const uint16 &in b, string message = "") { if (a  < b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_GE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
-	void EXPECT_GE(const uint   &in a, const uint   &in b, string message = "") { if (a  < b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_GE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
-	void EXPECT_GE(const uint64 &in a, const uint64 &in b, string message = "") { if (a  < b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_GE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
-	void EXPECT_GE(const  int8  &in a, const  int8  &in b, string message = "") { if (a  < b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_GE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
-	void EXPECT_GE(const  int16 &in a, const  int16 &in b, string message = "") { if (a  < b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_GE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
-	void EXPECT_GE(const  int   &in a, const  int   &in b, string message = "") { if (a  < b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_GE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
-	void EXPECT_GE(const  int64 &in a, const  int64 &in b, string message = "") { if (a  < b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_GE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
-	void EXPECT_GE(const  float &in a, const  float &in b, string message = "") { if (a  < b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_GE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
-	void EXPECT_GE(const  double&in a, const  double&in b, string message = "") { if (a  < b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_GE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
+	void ASSERT_GE(const uint8  &in a, const uint8  &in b, string message = "") { gAssertionCount++; if (a  < b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_GE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
+	void ASSERT_GE(const uint16 &in a, const uint16 &in b, string message = "") { gAssertionCount++; if (a  < b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_GE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
+	void ASSERT_GE(const uint   &in a, const uint   &in b, string message = "") { gAssertionCount++; if (a  < b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_GE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
+	void ASSERT_GE(const uint64 &in a, const uint64 &in b, string message = "") { gAssertionCount++; if (a  < b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_GE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
+	void ASSERT_GE(const  int8  &in a, const  int8  &in b, string message = "") { gAssertionCount++; if (a  < b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_GE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
+	void ASSERT_GE(const  int16 &in a, const  int16 &in b, string message = "") { gAssertionCount++; if (a  < b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_GE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
+	void ASSERT_GE(const  int   &in a, const  int   &in b, string message = "") { gAssertionCount++; if (a  < b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_GE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
+	void ASSERT_GE(const  int64 &in a, const  int64 &in b, string message = "") { gAssertionCount++; if (a  < b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_GE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
+	void ASSERT_GE(const  float &in a, const  float &in b, string message = "") { gAssertionCount++; if (a  < b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_GE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
+	void ASSERT_GE(const  double&in a, const  double&in b, string message = "") { gAssertionCount++; if (a  < b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "ASSERT_GE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); Engine::AbortExecution(); } }
+	void EXPECT_GE(const uint8  &in a, const uint8  &in b, string message = "") { gAssertionCount++; if (a  < b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_GE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
+	void EXPECT_GE(const uint16 &in a, const uint16 &in b, string message = "") { gAssertionCount++; if (a  < b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_GE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
+	void EXPECT_GE(const uint   &in a, const uint   &in b, string message = "") { gAssertionCount++; if (a  < b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_GE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
+	void EXPECT_GE(const uint64 &in a, const uint64 &in b, string message = "") { gAssertionCount++; if (a  < b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_GE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
+	void EXPECT_GE(const  int8  &in a, const  int8  &in b, string message = "") { gAssertionCount++; if (a  < b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_GE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
+	void EXPECT_GE(const  int16 &in a, const  int16 &in b, string message = "") { gAssertionCount++; if (a  < b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_GE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
+	void EXPECT_GE(const  int   &in a, const  int   &in b, string message = "") { gAssertionCount++; if (a  < b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_GE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
+	void EXPECT_GE(const  int64 &in a, const  int64 &in b, string message = "") { gAssertionCount++; if (a  < b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_GE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
+	void EXPECT_GE(const  float &in a, const  float &in b, string message = "") { gAssertionCount++; if (a  < b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_GE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
+	void EXPECT_GE(const  double&in a, const  double&in b, string message = "") { gAssertionCount++; if (a  < b) { Engine::LOG(Engine::LOG_PRIORITY::ERR, "EXPECT_GE(" + a + ", " + b + ") failed in " + Engine::Debug::GetPreviousCallstackLine() + "! " + message); gTestStatus = false; } }
 }
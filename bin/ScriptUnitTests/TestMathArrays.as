@@ -0,0 +1,164 @@
+/*
+ Tests and example configuration.
+*/
+
+namespace MathArrayTests {
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+	/**
+	* Calls and runs all the tests in this set.
+	*/
+	void ExecuteTests() {
+		TestCreationDestruction();
+		TestElementWriteRead();
+		TestAssignCopies();
+		
+		TestMethodAddScaled();
+		TestMethodRotate();
+		TestMethodGetBounds();
+		TestMethodNlerp();
+		TestMismatchedLengths();
+	}
+	
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+	/**
+	* Verify that the factories can be called, and fill in the elements.
+	*/
+	void TestCreationDestruction() {
+		{Engine::VectorArray test_var;}
+		{Engine::RotationArray test_var;}
+		
+		Engine::VectorArray vectors(3, Engine::Vector(1.0f, 2.0f, 3.0f));
+		UnitTest::EXPECT_EQ(vectors.GetLength(), 3);
+		UnitTest::EXPECT_EQ(vectors[2].y, 2.0f);
+		
+		Engine::RotationArray rotations(2);
+		UnitTest::EXPECT_EQ(rotations.GetLength(), 2);
+		UnitTest::EXPECT_EQ(rotations[1].s, 1.0f);
+	}
+	
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+	/**
+	* Elements written can be read back, and the length follows inserts and removals.
+	*/
+	void TestElementWriteRead() {
+		Engine::VectorArray test_var;
+		
+		test_var.InsertLast(Engine::Vector(1.0f, 0.0f, 0.0f));
+		test_var.InsertLast(Engine::Vector(0.0f, 1.0f, 0.0f));
+		test_var[0].z = 5.0f;
+		
+		UnitTest::EXPECT_EQ(test_var.GetLength(), 2);
+		UnitTest::EXPECT_EQ(test_var[0].z, 5.0f);
+		UnitTest::EXPECT_EQ(test_var[1].y, 1.0f);
+		
+		test_var.RemoveLast();
+		UnitTest::EXPECT_EQ(test_var.GetLength(), 1);
+		
+		test_var.Resize(10);
+		UnitTest::EXPECT_EQ(test_var[9].x, 0.0f);
+	}
+	
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+	/**
+	* Assignment copies the elements rather than sharing them.
+	*/
+	void TestAssignCopies() {
+		Engine::VectorArray test_var(2, Engine::Vector(1.0f, 1.0f, 1.0f));
+		Engine::VectorArray copy;
+		
+		copy = test_var;
+		test_var[0].x = 7.0f;
+		
+		UnitTest::EXPECT_EQ(copy.GetLength(), 2);
+		UnitTest::EXPECT_EQ(copy[0].x, 1.0f);
+	}
+	
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+	/**
+	* Moving positions by velocities over a time step, as for particles.
+	*/
+	void TestMethodAddScaled() {
+		Engine::VectorArray positions(9, Engine::Vector(1.0f, 2.0f, 3.0f));
+		Engine::VectorArray velocities(9, Engine::Vector(10.0f, -20.0f, 0.5f));
+		
+		UnitTest::ASSERT_TRUE(positions.AddScaled(velocities, 0.5f));
+		
+		for (uint index = 0; index < positions.GetLength(); ++index) {
+			UnitTest::EXPECT_NEAR(positions[index].x, 6.0f);
+			UnitTest::EXPECT_NEAR(positions[index].y, -8.0f);
+			UnitTest::EXPECT_NEAR(positions[index].z, 3.25f);
+		}
+	}
+	
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+	/**
+	* Rotating the array matches rotating each vector.
+	*/
+	void TestMethodRotate() {
+		Engine::Rotation rotation(0.3f, -0.2f, 0.1f);
+		Engine::Vector vector(4.0f, 5.0f, 6.0f);
+		Engine::VectorArray test_var(5, vector);
+		
+		test_var.Rotate(rotation);
+		
+		Engine::Vector expected = vector * rotation;
+		for (uint index = 0; index < test_var.GetLength(); ++index) {
+			UnitTest::EXPECT_NEAR(test_var[index].x, expected.x, 0.0001f);
+			UnitTest::EXPECT_NEAR(test_var[index].y, expected.y, 0.0001f);
+			UnitTest::EXPECT_NEAR(test_var[index].z, expected.z, 0.0001f);
+		}
+	}
+	
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+	/**
+	* The bounds hold every vector, and an empty array has none.
+	*/
+	void TestMethodGetBounds() {
+		Engine::VectorArray test_var;
+		Engine::Vector low, high;
+		
+		UnitTest::EXPECT_FALSE(test_var.GetBounds(low, high));
+		
+		test_var.InsertLast(Engine::Vector(1.0f, -5.0f, 2.0f));
+		test_var.InsertLast(Engine::Vector(-3.0f, 4.0f, 0.0f));
+		test_var.InsertLast(Engine::Vector(2.0f, 0.0f, -1.0f));
+		
+		UnitTest::ASSERT_TRUE(test_var.GetBounds(low, high));
+		UnitTest::EXPECT_EQ(low.x, -3.0f);
+		UnitTest::EXPECT_EQ(low.y, -5.0f);
+		UnitTest::EXPECT_EQ(low.z, -1.0f);
+		UnitTest::EXPECT_EQ(high.x, 2.0f);
+		UnitTest::EXPECT_EQ(high.y, 4.0f);
+		UnitTest::EXPECT_EQ(high.z, 2.0f);
+	}
+	
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+	/**
+	* Blending all the way reaches the target rotations.
+	*/
+	void TestMethodNlerp() {
+		Engine::RotationArray test_var(4);
+		Engine::RotationArray targets(4, Engine::Rotation(0.3f, -0.2f, 0.1f));
+		
+		UnitTest::ASSERT_TRUE(test_var.Nlerp(targets, 1.0f));
+		
+		for (uint index = 0; index < test_var.GetLength(); ++index) {
+			UnitTest::EXPECT_NEAR(test_var[index].x, targets[index].x, 0.0001f);
+			UnitTest::EXPECT_NEAR(test_var[index].y, targets[index].y, 0.0001f);
+			UnitTest::EXPECT_NEAR(test_var[index].z, targets[index].z, 0.0001f);
+			UnitTest::EXPECT_NEAR(test_var[index].s, targets[index].s, 0.0001f);
+		}
+	}
+	
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+	/**
+	* Arrays of different lengths are left alone.
+	*/
+	void TestMismatchedLengths() {
+		Engine::VectorArray test_var(3, Engine::Vector(1.0f, 1.0f, 1.0f));
+		Engine::VectorArray other(2, Engine::Vector(1.0f, 1.0f, 1.0f));
+		
+		UnitTest::EXPECT_FALSE(test_var.Add(other));
+		UnitTest::EXPECT_EQ(test_var[0].x, 1.0f);
+	}
+}
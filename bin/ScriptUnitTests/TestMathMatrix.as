@@ -0,0 +1,153 @@
+/*
+ Tests and example configuration.
+*/
+
+namespace MatrixMathTests {
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+	/**
+	* Calls and runs all the tests in this set.
+	*/
+	void ExecuteTests() {
+		TestCreationDestruction();
+		TestDefaultCtorIsIdentity();
+		TestElementWriteRead();
+		TestTransformCtor();
+		TestCopyCtor();
+		
+		TestMethodTransformDirection();
+		TestMethodInverse();
+		TestMethodTranspose();
+		
+		TestOpMultiply();
+	}
+	
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+	/**
+	* Verify that default ctors actually can be called.
+	*/
+	void TestCreationDestruction() {
+		{Engine::Matrix test_var;}
+		{Engine::Matrix test_var();}
+	}
+	
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+	/**
+	* A default matrix is the identity.
+	*/
+	void TestDefaultCtorIsIdentity() {
+		Engine::Matrix test_var;
+		
+		for (uint column = 0; column < 4; ++column) {
+			for (uint row = 0; row < 4; ++row) {
+				UnitTest::EXPECT_EQ(test_var.Get(column, row), column == row ? 1.0f : 0.0f);
+			}
+		}
+	}
+	
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+	/**
+	* Elements written can be read back, and the last column is the translation.
+	*/
+	void TestElementWriteRead() {
+		Engine::Matrix test_var;
+		
+		test_var.Set(3, 0, 1.5f);
+		test_var.Set(3, 1, -2.0f);
+		test_var.Set(3, 2, 4.0f);
+		test_var.Set(1, 2, 0.25f);
+		
+		UnitTest::EXPECT_EQ(test_var.Get(1, 2), 0.25f);
+		UnitTest::EXPECT_EQ(test_var.Get(2, 1), 0.0f);
+		
+		Engine::Vector translation = test_var.GetTranslation();
+		UnitTest::EXPECT_EQ(translation.x, 1.5f);
+		UnitTest::EXPECT_EQ(translation.y, -2.0f);
+		UnitTest::EXPECT_EQ(translation.z, 4.0f);
+	}
+	
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+	/**
+	* The transform ctor scales, then rotates, then translates, as an entity's local matrix does.
+	*/
+	void TestTransformCtor() {
+		// A quarter turn about z: x goes to y.
+		Engine::Matrix test_var(Engine::Vector(1.0f, 2.0f, 3.0f), Engine::Rotation(Engine::Vector(0.0f, 0.0f, 1.0f), 1.5707963267948966f), 2.0f);
+		
+		Engine::Vector result = test_var.TransformPoint(Engine::Vector(1.0f, 0.0f, 0.0f));
+		UnitTest::EXPECT_NEAR(result.x, 1.0f);
+		UnitTest::EXPECT_NEAR(result.y, 4.0f);
+		UnitTest::EXPECT_NEAR(result.z, 3.0f);
+		
+		result = test_var * Engine::Vector(0.0f, 0.0f, 0.0f);
+		UnitTest::EXPECT_NEAR(result.x, 1.0f);
+		UnitTest::EXPECT_NEAR(result.y, 2.0f);
+		UnitTest::EXPECT_NEAR(result.z, 3.0f);
+	}
+	
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+	/**
+	* Test the copy ctor.
+	*/
+	void TestCopyCtor() {
+		Engine::Matrix test_var;
+		test_var.Set(2, 3, 5.0f);
+		
+		Engine::Matrix copy(test_var);
+		UnitTest::EXPECT_EQ(copy.Get(2, 3), 5.0f);
+		UnitTest::EXPECT_EQ(copy.Get(0, 0), 1.0f);
+	}
+	
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+	/**
+	* Directions ignore the translation.
+	*/
+	void TestMethodTransformDirection() {
+		Engine::Matrix test_var(Engine::Vector(10.0f, 20.0f, 30.0f), Engine::Rotation(), 3.0f);
+		
+		Engine::Vector result = test_var.TransformDirection(Engine::Vector(1.0f, -1.0f, 0.5f));
+		UnitTest::EXPECT_NEAR(result.x, 3.0f);
+		UnitTest::EXPECT_NEAR(result.y, -3.0f);
+		UnitTest::EXPECT_NEAR(result.z, 1.5f);
+	}
+	
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+	/**
+	* The inverse undoes the transform.
+	*/
+	void TestMethodInverse() {
+		Engine::Matrix test_var(Engine::Vector(1.0f, -2.0f, 3.0f), Engine::Rotation(0.3f, -0.2f, 0.1f), 0.5f);
+		Engine::Vector point(4.0f, 5.0f, 6.0f);
+		
+		Engine::Vector result = test_var.Inverse() * (test_var * point);
+		UnitTest::EXPECT_NEAR(result.x, point.x);
+		UnitTest::EXPECT_NEAR(result.y, point.y);
+		UnitTest::EXPECT_NEAR(result.z, point.z);
+	}
+	
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+	/**
+	* The transpose swaps columns and rows.
+	*/
+	void TestMethodTranspose() {
+		Engine::Matrix test_var;
+		test_var.Set(3, 1, 7.0f);
+		
+		Engine::Matrix result = test_var.Transpose();
+		UnitTest::EXPECT_EQ(result.Get(1, 3), 7.0f);
+		UnitTest::EXPECT_EQ(result.Get(3, 1), 0.0f);
+	}
+	
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+	/**
+	* The product applies the right hand matrix first.
+	*/
+	void TestOpMultiply() {
+		Engine::Matrix scale(Engine::Vector(0.0f, 0.0f, 0.0f), Engine::Rotation(), 2.0f);
+		Engine::Matrix move(Engine::Vector(1.0f, 0.0f, 0.0f), Engine::Rotation(), 1.0f);
+		
+		Engine::Vector result = (move * scale) * Engine::Vector(1.0f, 1.0f, 1.0f);
+		UnitTest::EXPECT_NEAR(result.x, 3.0f);
+		UnitTest::EXPECT_NEAR(result.y, 2.0f);
+		UnitTest::EXPECT_NEAR(result.z, 2.0f);
+	}
+}
@@ -21,15 +21,7 @@ namespace RotationMathTests {
 	* Calls and runs all the tests in this set.
 	*/
 	void ExecuteTests() {
-		// Verify test values are near where expected:
-		UnitTest::EXPECT_NEAR(test_x,  0.131270f);
-		UnitTest::EXPECT_NEAR(test_y,  0.450536f);
-		UnitTest::EXPECT_NEAR(test_z, -0.042531f);
-		UnitTest::EXPECT_NEAR(test_s,  0.882029f);
-		UnitTest::EXPECT_NEAR( alt_x,  0.375168f);
-		UnitTest::EXPECT_NEAR( alt_y,  0.492846f);
-		UnitTest::EXPECT_NEAR( alt_z,  0.252235f);
-		UnitTest::EXPECT_NEAR( alt_s,  0.743456f);
+		TestValues();
 		
 		TestCreationDestruction();
 		TestBasicCtorAndPropertyReads();
@@ -43,7 +35,7 @@ namespace RotationMathTests {
 		TestImplictConversion();
 		TestExplictConversion();
 		
-		//TestMethodToEuler(); // Only stubbed in C++ (ScriptMath.cpp) - if you really need it, perhaps implement it?
+		//DISABLED_TestMethodToEuler(); // Only stubbed in C++ (ScriptMath.cpp) - if you really need it, perhaps implement it?
 		TestMethodToAxis();
 		TestMethodToAngle();
 		TestMethodSlerp();
@@ -54,6 +46,21 @@ namespace RotationMathTests {
 		TestOpDivision();
 	}
 	
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+	/**
+	* Verify test values are near where expected.
+	*/
+	void TestValues() {
+		UnitTest::EXPECT_NEAR(test_x,  0.131270f);
+		UnitTest::EXPECT_NEAR(test_y,  0.450536f);
+		UnitTest::EXPECT_NEAR(test_z, -0.042531f);
+		UnitTest::EXPECT_NEAR(test_s,  0.882029f);
+		UnitTest::EXPECT_NEAR( alt_x,  0.375168f);
+		UnitTest::EXPECT_NEAR( alt_y,  0.492846f);
+		UnitTest::EXPECT_NEAR( alt_z,  0.252235f);
+		UnitTest::EXPECT_NEAR( alt_s,  0.743456f);
+	}
+	
 	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 	/**
 	* Verify that default ctors actually can be called.  Generally a compilation test, but also does an implicit test of the actual functionality of the registered interface.
@@ -413,7 +420,7 @@ namespace RotationMathTests {
 	/**
 	* Test the conversion to Euler angles method.
 	*/
-	void TestMethodToEuler() {
+	void DISABLED_TestMethodToEuler() {
 		Engine::Vector expected(PI_BY_TWO / 2.0f, PI_BY_TWO / 2.0f, PI_BY_TWO / 2.0f);
 		
 		{
@@ -1,13 +1,25 @@
 /*
- Tests and example configuration.
+ Example configuration.
+ The script unit tests in ScriptUnitTests are run by nlsscripttest, not at startup.
 */
 
-#include "ScriptUnitTests/TestFramework.as"
-
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 void main() {
-	UnitTest::ExecuteTests(); // Run the tests.  This has nothing to do with config, feel free to not use in production code.
 	Engine.SetUserDataFolder(OS.GetPath(SYSTEM_DIRS::EXECUTABLE));
 	Engine.SetGameScript("main.as");
 	// Configure the engine.
+	if (OS.IsHeadless()) {
+		Engine.SetTickRate(30.0); // Dedicated servers simulate at a fixed rate and sleep in between.
+	}
+	
+	// Abort any call into scripts, such as a runaway main() or event handler, that runs for more than this many seconds.
+	Engine.SetScriptTimeout(10.0);
+	
+	// Resuming script coroutines, those started with Engine.StartCoroutine(), may take up this many seconds of each frame.
+	// Any still due once it is spent carry on first in the next frame.
+	Engine.SetCoroutineBudget(0.004);
+	
+	// Uncomment to sample where scripts spend their time.  The folded stacks are written to the user data folder when the
+	// engine stops, or on Engine.StopProfiler(), ready for flamegraph.pl.
+	//Engine.StartProfiler("scripts.folded");
 }
@@ -193,6 +193,37 @@ if(DEFINED NLS_ENGINE_BUILD_MODE)
 	source_group("Addon Source" FILES ${AngelScript_ADDON_SOURCE})
 	source_group("Addon Headers" FILES ${AngelScript_ADDON_SOURCE_HEADERS})
 	
+	# The optional JIT compiler is built into the same library.
+	if(NLS_ENGINE_AS_JIT)
+		set(NLS_ENGINE_AS_JIT_DIR "${LIB_AngelScript_DIR}/sdk/angelscript/jit" CACHE PATH
+			"Location of the BlindMind AngelScript JIT compiler's sources.  It includes AngelScript's internal headers as ../source/, so it belongs next to AngelScript's source folder."
+		)
+		
+		if(NOT EXISTS "${NLS_ENGINE_AS_JIT_DIR}/as_jit.cpp")
+			message(FATAL_ERROR "NLS_ENGINE_AS_JIT is on, but the JIT compiler's sources were not found in '${NLS_ENGINE_AS_JIT_DIR}'.  Get them from https://github.com/BlindMindStudios/AngelScript-JIT-Compiler, in a version made for AngelScript 2.23.1, or set NLS_ENGINE_AS_JIT_DIR.")
+		endif(NOT EXISTS "${NLS_ENGINE_AS_JIT_DIR}/as_jit.cpp")
+		
+		message("Adding the AngelScript JIT compiler to the AngelScript library.")
+		
+		set(AngelScript_SOURCE 
+			${AngelScript_SOURCE} 
+			${NLS_ENGINE_AS_JIT_DIR}/as_jit.cpp 
+			${NLS_ENGINE_AS_JIT_DIR}/virtual_asm_x86.cpp 
+		)
+		if(WIN32)
+			set(AngelScript_SOURCE ${AngelScript_SOURCE} ${NLS_ENGINE_AS_JIT_DIR}/virtual_asm_windows.cpp)
+		else(WIN32)
+			set(AngelScript_SOURCE ${AngelScript_SOURCE} ${NLS_ENGINE_AS_JIT_DIR}/virtual_asm_linux.cpp)
+		endif(WIN32)
+		set(AngelScript_SOURCE_HEADERS 
+			${AngelScript_SOURCE_HEADERS} 
+			${NLS_ENGINE_AS_JIT_DIR}/as_jit.h 
+			${NLS_ENGINE_AS_JIT_DIR}/virtual_asm.h 
+		)
+		
+		include_directories("${LIB_AngelScript_DIR}/sdk/angelscript/include")
+	endif(NLS_ENGINE_AS_JIT)
+	
 	add_definitions("-D_CRT_SECURE_NO_WARNINGS -DANGELSCRIPT_EXPORT -D_LIB -DAS_DEBUG")
 	
 	# Fix x64 issues on Linux
@@ -221,4 +252,9 @@ if(EXISTS "${LIBS_INCLUDE_PATH}/angelscript")
 	#	)
 	#endif(WINDOWS)
 	set(AngelScript_FOUND 1)
+	
+	# For as_jit.h
+	if(NLS_ENGINE_AS_JIT)
+		set(AngelScript_INCLUDE_DIRS ${AngelScript_INCLUDE_DIRS} "${NLS_ENGINE_AS_JIT_DIR}")
+	endif(NLS_ENGINE_AS_JIT)
 endif(EXISTS "${LIBS_INCLUDE_PATH}/angelscript")
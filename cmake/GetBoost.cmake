@@ -61,7 +61,7 @@ set(NLS_ENGINE_LIBRARY "Boost")
 #    - test
 #    - thread
 #    - wave
-set(BOOST_LIBS "date_time,filesystem,system" CACHE STRING
+set(BOOST_LIBS "date_time,filesystem,system,thread" CACHE STRING
 	"Comma-seperated list of boost library names"
 	FORCE
 )
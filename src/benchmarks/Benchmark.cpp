@@ -0,0 +1,169 @@
+/**
+* \file
+* \author agent
+* \date 2026-10-19
+* \brief Minimal benchmark harness: timed repetitions of registered cases, reported as JSON.
+*/
+
+#include "Benchmark.h"
+
+// Standard Includes
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+// Library Includes
+#include <boost/date_time.hpp>
+#include <boost/lexical_cast.hpp>
+#include <EngineConfig.h>
+
+// Local Includes
+#include "../sharedbase/EventLogger.h"
+
+// Local Types
+namespace {
+	std::string EscapeJSON(const std::string& text) {
+		std::string escaped;
+		
+		for (std::string::const_iterator itr = text.begin(); itr != text.end(); ++itr) {
+			if (*itr == '"' || *itr == '\\') {
+				escaped += '\\';
+			}
+			if (static_cast<unsigned char>(*itr) >= 0x20) {
+				escaped += *itr;
+			}
+		}
+		
+		return escaped;
+	}
+	
+	double Median(std::vector<double> samples) {
+		if (samples.empty()) {
+			return 0.0;
+		}
+		
+		std::sort(samples.begin(), samples.end());
+		
+		size_t middle = samples.size() / 2;
+		if (samples.size() % 2 == 0) {
+			return (samples[middle - 1] + samples[middle]) / 2.0;
+		}
+		return samples[middle];
+	}
+}
+
+namespace Benchmark {
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+	Timer::Timer() : elapsed(0.0), running(false) {
+	}
+	
+	void Timer::Start() {
+		if (!this->running) {
+			this->running = true;
+			this->started = boost::chrono::steady_clock::now();
+		}
+	}
+	
+	void Timer::Stop() {
+		if (this->running) {
+			this->elapsed += boost::chrono::steady_clock::now() - this->started;
+			this->running = false;
+		}
+	}
+	
+	double Timer::GetElapsed() const {
+		return this->elapsed.count();
+	}
+	
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+	Runner::Runner() : repetitions(5) {
+	}
+	
+	void Runner::Add(const std::string& group, const std::string& name, unsigned int iterations, const Body& body) {
+		this->cases.push_back(Case(group, name, std::max(iterations, 1u), body));
+	}
+	
+	void Runner::SetRepetitions(unsigned int repetitions) {
+		this->repetitions = std::max(repetitions, 1u);
+	}
+	
+	void Runner::SetFilter(const std::string& filter) {
+		this->filter = filter;
+	}
+	
+	void Runner::SetLabel(const std::string& label) {
+		this->label = label;
+	}
+	
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+	void Runner::Run() {
+		this->results.clear();
+		
+		for (std::vector<Case>::iterator case_it = this->cases.begin(); case_it != this->cases.end(); ++case_it) {
+			std::string full_name(case_it->group + "/" + case_it->name);
+			
+			if (!this->filter.empty() && full_name.find(this->filter) == std::string::npos) {
+				continue;
+			}
+			
+			LOG(LOG_PRIORITY::INFO, "Running benchmark " + full_name);
+			
+			Result result;
+			result.group = case_it->group;
+			result.name = case_it->name;
+			result.iterations = case_it->iterations;
+			
+			// The first repetition warms caches and lazily created state, and isn't recorded.
+			for (unsigned int repetition = 0; repetition <= this->repetitions; ++repetition) {
+				Timer timer;
+				
+				case_it->body(timer, case_it->iterations);
+				timer.Stop();
+				
+				if (repetition > 0) {
+					result.samples.push_back(timer.GetElapsed() * 1.0e9 / case_it->iterations);
+				}
+			}
+			
+			this->results.push_back(result);
+		}
+	}
+	
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+	void Runner::WriteJSON(std::ostream& out) const {
+		out << "{\n"
+			<< "\"NLSEngineBenchmarkVersion1.0\":{\n"
+			<< "\"engine\":\"" << NLS_ENGINE_VERSION_MAJOR << "." << NLS_ENGINE_VERSION_MINOR << "\",\n"
+			<< "\"label\":\"" << EscapeJSON(this->label) << "\",\n"
+			<< "\"time\":\"" << boost::posix_time::to_iso_extended_string(boost::posix_time::microsec_clock::universal_time()) << "UTC\",\n"
+			<< "\"repetitions\":" << this->repetitions << ",\n"
+			<< "\"results\":[";
+		
+		for (std::vector<Result>::const_iterator result_it = this->results.begin(); result_it != this->results.end(); ++result_it) {
+			const std::vector<double>& samples = result_it->samples;
+			
+			double mean = std::accumulate(samples.begin(), samples.end(), 0.0) / samples.size();
+			double variance = 0.0;
+			for (std::vector<double>::const_iterator sample_it = samples.begin(); sample_it != samples.end(); ++sample_it) {
+				variance += (*sample_it - mean) * (*sample_it - mean);
+			}
+			variance /= samples.size();
+			
+			out << (result_it == this->results.begin() ? "\n" : ",\n")
+				<< "{"
+				<< "\"group\":\"" << EscapeJSON(result_it->group) << "\","
+				<< "\"name\":\"" << EscapeJSON(result_it->name) << "\","
+				<< "\"iterations\":" << result_it->iterations << ","
+				<< "\"ns_per_op\":{"
+					<< "\"min\":" << *std::min_element(samples.begin(), samples.end()) << ","
+					<< "\"median\":" << Median(samples) << ","
+					<< "\"mean\":" << mean << ","
+					<< "\"max\":" << *std::max_element(samples.begin(), samples.end()) << ","
+					<< "\"stddev\":" << std::sqrt(variance)
+				<< "}"
+				<< "}";
+		}
+		
+		out << "\n]\n}\n}\n";
+	}
+}
@@ -0,0 +1,113 @@
+/**
+* \file
+* \author agent
+* \date 2026-10-19
+* \brief Minimal benchmark harness: timed repetitions of registered cases, reported as JSON.
+*
+* Every case runs a fixed number of iterations per repetition and a fixed number of repetitions, with any random
+* data generated from fixed seeds, so that results from different commits can be compared directly.
+*/
+#pragma once
+
+// Standard Includes
+#include <ostream>
+#include <string>
+#include <vector>
+
+// Library Includes
+#include <boost/chrono.hpp>
+#include <boost/function.hpp>
+
+// Local Includes
+
+// Forward Declarations
+
+// Typedefs
+
+namespace Benchmark {
+	/**
+	* \brief Accumulates the measured portion of a repetition.  Setup and teardown are left outside Start/Stop.
+	*/
+	class Timer {
+	public:
+		Timer();
+		
+		void Start();
+		void Stop();
+		
+		/// Total seconds between all Start/Stop pairs.
+		double GetElapsed() const;
+		
+	private:
+		boost::chrono::steady_clock::time_point started;
+		boost::chrono::duration<double> elapsed;
+		bool running;
+	};
+	
+	/// A benchmark body: performs the operation under test the given number of times, timing only that work.
+	typedef boost::function<void (Timer&, unsigned int)> Body;
+	
+	/// Keeps the compiler from discarding a computed value.
+	template <typename T>
+	void Consume(const T& value) {
+		static volatile char sink;
+		sink = *reinterpret_cast<const volatile char*>(&value);
+	}
+	
+	/// The measurements of a single benchmark case.
+	struct Result {
+		std::string group;
+		std::string name;
+		unsigned int iterations;
+		std::vector<double> samples; ///< Nanoseconds per iteration, one per repetition.
+	};
+	
+	/**
+	* \brief Holds the benchmark cases and runs them.
+	*/
+	class Runner {
+	public:
+		Runner();
+		
+		/// Adds a case.  Iterations are per repetition, and should make a repetition last a few milliseconds or more.
+		void Add(const std::string& group, const std::string& name, unsigned int iterations, const Body& body);
+		
+		/// Number of timed repetitions per case.  One untimed warm up repetition is always run first.
+		void SetRepetitions(unsigned int);
+		
+		/// Only cases whose "group/name" contains the filter are run.
+		void SetFilter(const std::string&);
+		
+		/// Free text identifying the build or commit, copied into the report.
+		void SetLabel(const std::string&);
+		
+		/// Runs every case matching the filter, logging progress.
+		void Run();
+		
+		/// Writes the results of the last Run as a JSON document.
+		void WriteJSON(std::ostream&) const;
+		
+	private:
+		struct Case {
+			Case(const std::string& group, const std::string& name, unsigned int iterations, const Body& body) : group(group), name(name), iterations(iterations), body(body) {}
+			
+			std::string group;
+			std::string name;
+			unsigned int iterations;
+			Body body;
+		};
+		
+		std::vector<Case> cases;
+		std::vector<Result> results;
+		unsigned int repetitions;
+		std::string filter;
+		std::string label;
+	};
+	
+	// Registration of the benchmark cases, one function per area of the engine.
+	void AddEntityBenchmarks(Runner&);
+	void AddEnvelopeBenchmarks(Runner&);
+	void AddEventLoggerBenchmarks(Runner&);
+	void AddModuleManagerBenchmarks(Runner&);
+	void AddScriptBenchmarks(Runner&);
+}
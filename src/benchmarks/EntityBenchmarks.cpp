@@ -0,0 +1,264 @@
+/**
+* \file
+* \author agent
+* \date 2026-10-19
+* \brief Benchmarks of Entity lifetime, transform queries, and EntityMap lookups.
+*/
+
+#include "Benchmark.h"
+
+// Standard Includes
+#include <vector>
+
+// Library Includes
+#include <boost/bind.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/random/mersenne_twister.hpp>
+#include <boost/random/uniform_int_distribution.hpp>
+#include <boost/scoped_ptr.hpp>
+#include <boost/shared_ptr.hpp>
+
+// Local Includes
+#include "../sharedbase/Entity.h"
+#include "../sharedbase/EventLogger.h"
+#include "../enginecore/EntityMap.h"
+
+// Local Types
+namespace {
+	/// A populated EntityMap, built once per case since filling it dwarfs the lookups being measured.
+	struct EntityMapFixture {
+		EntityMapFixture(unsigned int count) : map(new EntityMap()) {
+			// The adds log every entity; keep that out of the real log.
+			boost::scoped_ptr<EventLogger> scratch_log(EventLogger::CreateEventLogger());
+			EventLogger::ThreadBinding log_binding(scratch_log.get());
+			
+			for (unsigned int index = 0; index < count; ++index) {
+				std::string name("entity" + boost::lexical_cast<std::string>(index));
+				this->map->AddEntity(Entity::Factory(name));
+				this->names.push_back(name);
+			}
+			
+			// Look the names up in a fixed pseudo-random order, the same on every run.
+			boost::random::mt19937 generator(20120814u);
+			boost::random::uniform_int_distribution<unsigned int> pick(0, count - 1);
+			for (unsigned int index = 0; index < count; ++index) {
+				this->lookups.push_back(pick(generator));
+			}
+		}
+		
+		~EntityMapFixture() {
+			// As do the entities' destructors.
+			boost::scoped_ptr<EventLogger> scratch_log(EventLogger::CreateEventLogger());
+			EventLogger::ThreadBinding log_binding(scratch_log.get());
+			
+			this->map.reset();
+		}
+		
+		boost::scoped_ptr<EntityMap> map;
+		std::vector<std::string> names;
+		std::vector<unsigned int> lookups;
+	};
+	
+	void CreateDestroy(Benchmark::Timer& timer, unsigned int iterations) {
+		timer.Start();
+		for (unsigned int index = 0; index < iterations; ++index) {
+			EntitySPTR entity(Entity::Factory("benchmark"));
+			Benchmark::Consume(entity.get());
+		}
+		timer.Stop();
+	}
+	
+	/// A parent-to-child chain with non-trivial transforms.
+	std::vector<EntitySPTR> MakeChain(unsigned int depth) {
+		std::vector<EntitySPTR> chain;
+		
+		for (unsigned int level = 0; level < depth; ++level) {
+			EntitySPTR entity(Entity::Factory());
+			
+			entity->SetPosition(1.0f, 0.5f, 0.25f);
+			entity->SetRotation(0.1f, 0.2f, 0.3f);
+			entity->SetScale(1.01f);
+			
+			if (!chain.empty()) {
+				entity->SetParent(chain.back());
+			}
+			chain.push_back(entity);
+		}
+		
+		return chain;
+	}
+	
+	void GetWorldPosition(unsigned int depth, Benchmark::Timer& timer, unsigned int iterations) {
+		std::vector<EntitySPTR> chain(MakeChain(depth));
+		const Entity* leaf = chain.back().get();
+		
+		timer.Start();
+		for (unsigned int index = 0; index < iterations; ++index) {
+			Benchmark::Consume(leaf->GetWorldPosition());
+		}
+		timer.Stop();
+	}
+	
+	void WorldTransformSeparate(unsigned int depth, Benchmark::Timer& timer, unsigned int iterations) {
+		std::vector<EntitySPTR> chain(MakeChain(depth));
+		const Entity* leaf = chain.back().get();
+		
+		timer.Start();
+		for (unsigned int index = 0; index < iterations; ++index) {
+			Benchmark::Consume(leaf->GetWorldPosition());
+			Benchmark::Consume(leaf->GetWorldRotation());
+			Benchmark::Consume(leaf->GetWorldScale());
+		}
+		timer.Stop();
+	}
+	
+	void WorldTransformCombined(unsigned int depth, Benchmark::Timer& timer, unsigned int iterations) {
+		std::vector<EntitySPTR> chain(MakeChain(depth));
+		const Entity* leaf = chain.back().get();
+		glm::vec3 position;
+		glm::fquat rotation;
+		float scale;
+		
+		timer.Start();
+		for (unsigned int index = 0; index < iterations; ++index) {
+			leaf->GetWorldTransform(position, rotation, scale);
+			Benchmark::Consume(position);
+			Benchmark::Consume(rotation);
+			Benchmark::Consume(scale);
+		}
+		timer.Stop();
+	}
+	
+	/// Leaves in groups of siblings, each group at the end of its own chain of ancestors, as for the parts of many models.
+	struct Forest {
+		Forest(unsigned int count, unsigned int siblings, unsigned int depth) {
+			EntitySPTR parent;
+			for (unsigned int index = 0; index < count; ++index) {
+				if (index % siblings == 0) {
+					parent.reset();
+					for (unsigned int level = 0; level < depth; ++level) {
+						EntitySPTR ancestor(Entity::Factory());
+						ancestor->SetPosition(1.0f, 0.5f, 0.25f);
+						ancestor->SetRotation(0.1f, 0.2f, 0.3f);
+						ancestor->SetParent(parent);
+						this->ancestors.push_back(ancestor);
+						parent = ancestor;
+					}
+				}
+				
+				EntitySPTR leaf(Entity::Factory());
+				leaf->SetPosition(0.1f * (index % siblings), 0.0f, 0.0f);
+				leaf->SetParent(parent);
+				this->leaves.push_back(leaf);
+			}
+			
+			this->positions.resize(count);
+			this->rotations.resize(count);
+			this->scales.resize(count);
+		}
+		
+		std::vector<EntitySPTR> ancestors;
+		std::vector<EntitySPTR> leaves;
+		std::vector<glm::vec3> positions;
+		std::vector<glm::fquat> rotations;
+		std::vector<float> scales;
+	};
+	
+	void WorldTransformsOneByOne(unsigned int count, Benchmark::Timer& timer, unsigned int iterations) {
+		Forest forest(count, 16, 4);
+		
+		timer.Start();
+		for (unsigned int iteration = 0; iteration < iterations; ++iteration) {
+			for (unsigned int index = 0; index < count; ++index) {
+				const Entity* leaf = forest.leaves[index].get();
+				forest.positions[index] = leaf->GetWorldPosition();
+				forest.rotations[index] = leaf->GetWorldRotation();
+				forest.scales[index] = leaf->GetWorldScale();
+			}
+			Benchmark::Consume(&forest.positions[0]);
+		}
+		timer.Stop();
+	}
+	
+	void WorldTransformsBatch(unsigned int count, Benchmark::Timer& timer, unsigned int iterations) {
+		Forest forest(count, 16, 4);
+		
+		timer.Start();
+		for (unsigned int iteration = 0; iteration < iterations; ++iteration) {
+			Entity::GetWorldTransforms(forest.leaves, &forest.positions[0], &forest.rotations[0], &forest.scales[0]);
+			Benchmark::Consume(&forest.positions[0]);
+		}
+		timer.Stop();
+	}
+	
+	void TransformPoints(unsigned int count, Benchmark::Timer& timer, unsigned int iterations) {
+		Forest forest(1, 1, 4);
+		const Entity& leaf = *forest.leaves[0];
+		
+		std::vector<glm::vec3> points, results(count);
+		for (unsigned int index = 0; index < count; ++index) {
+			points.push_back(glm::vec3(0.5f * index, 1.0f, -0.25f * index));
+		}
+		
+		timer.Start();
+		for (unsigned int iteration = 0; iteration < iterations; ++iteration) {
+			leaf.TransformPoints(&points[0], &results[0], count);
+			Benchmark::Consume(&results[0]);
+		}
+		timer.Stop();
+	}
+	
+	/// Builds its fixture inside the untimed warm up rather than at registration, so filtered out cases cost nothing.
+	struct LazyEntityMapFixture {
+		LazyEntityMapFixture(unsigned int count) : count(count) {}
+		
+		EntityMapFixture& Get() {
+			if (!this->fixture) {
+				this->fixture.reset(new EntityMapFixture(this->count));
+			}
+			return *this->fixture;
+		}
+		
+		unsigned int count;
+		boost::scoped_ptr<EntityMapFixture> fixture;
+	};
+	
+	void FindEntity(const boost::shared_ptr<LazyEntityMapFixture>& lazy_fixture, Benchmark::Timer& timer, unsigned int iterations) {
+		EntityMapFixture& fixture = lazy_fixture->Get();
+		
+		timer.Start();
+		for (unsigned int index = 0; index < iterations; ++index) {
+			Benchmark::Consume(fixture.map->FindEntity(fixture.names[fixture.lookups[index % fixture.lookups.size()]]).get());
+		}
+		timer.Stop();
+	}
+}
+
+namespace Benchmark {
+	void AddEntityBenchmarks(Runner& runner) {
+		runner.Add("Entity", "CreateDestroy", 2000, &CreateDestroy);
+		
+		const unsigned int depths[] = {1, 4, 16, 64};
+		for (unsigned int index = 0; index < sizeof(depths) / sizeof(depths[0]); ++index) {
+			runner.Add("Entity", "GetWorldPosition/depth" + boost::lexical_cast<std::string>(depths[index]), 100000 / depths[index], boost::bind(&GetWorldPosition, depths[index], _1, _2));
+		}
+		
+		runner.Add("Entity", "WorldTransform/Separate/depth16", 10000, boost::bind(&WorldTransformSeparate, 16, _1, _2));
+		runner.Add("Entity", "WorldTransform/Combined/depth16", 10000, boost::bind(&WorldTransformCombined, 16, _1, _2));
+		
+		const unsigned int leaf_counts[] = {1000, 100000};
+		for (unsigned int index = 0; index < sizeof(leaf_counts) / sizeof(leaf_counts[0]); ++index) {
+			std::string count(boost::lexical_cast<std::string>(leaf_counts[index]));
+			runner.Add("Entity", "WorldTransforms/OneByOne/" + count, 100000 / leaf_counts[index] + 1, boost::bind(&WorldTransformsOneByOne, leaf_counts[index], _1, _2));
+			runner.Add("Entity", "WorldTransforms/Batch/" + count, 100000 / leaf_counts[index] + 1, boost::bind(&WorldTransformsBatch, leaf_counts[index], _1, _2));
+		}
+		
+		runner.Add("Entity", "TransformPoints/10000", 100, boost::bind(&TransformPoints, 10000, _1, _2));
+		
+		const unsigned int counts[] = {1000, 10000, 100000};
+		for (unsigned int index = 0; index < sizeof(counts) / sizeof(counts[0]); ++index) {
+			boost::shared_ptr<LazyEntityMapFixture> fixture(new LazyEntityMapFixture(counts[index]));
+			runner.Add("EntityMap", "FindEntity/" + boost::lexical_cast<std::string>(counts[index]), 100000, boost::bind(&FindEntity, fixture, _1, _2));
+		}
+	}
+}
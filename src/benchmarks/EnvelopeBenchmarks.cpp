@@ -0,0 +1,129 @@
+/**
+* \file
+* \author agent
+* \date 2026-10-19
+* \brief Benchmarks of Envelope data access and serialization.
+*/
+
+#include "Benchmark.h"
+
+// Standard Includes
+#include <string>
+
+// Library Includes
+#include <boost/bind.hpp>
+#include <boost/filesystem.hpp>
+#include <glm/glm.hpp>
+#include <glm/gtx/quaternion.hpp>
+
+// Local Includes
+#include "../sharedbase/Envelope.h"
+
+// Local Types
+namespace {
+	/// An envelope resembling a saved entity: a name, a transform, and some flags, repeated.
+	EnvelopeSPTR MakeSaveEnvelope(unsigned int records) {
+		EnvelopeSPTR envelope(new Envelope());
+		envelope->msgid = 1;
+		
+		for (unsigned int index = 0; index < records; ++index) {
+			EnvelopeSPTR record(new Envelope());
+			record->AddData(std::string("entity"));
+			record->AddData(glm::vec3(1.0f, 2.0f, 3.0f));
+			record->AddData(glm::fquat(1.0f, 0.0f, 0.0f, 0.0f));
+			record->AddData(1.0f);
+			record->AddData(static_cast<int>(index));
+			record->AddData(true);
+			envelope->AddData(record);
+		}
+		
+		return envelope;
+	}
+	
+	void AddData(Benchmark::Timer& timer, unsigned int iterations) {
+		EnvelopeSPTR envelope(new Envelope());
+		
+		timer.Start();
+		for (unsigned int index = 0; index < iterations; ++index) {
+			envelope->AddData(static_cast<int>(index));
+		}
+		timer.Stop();
+		
+		Benchmark::Consume(envelope->GetCount());
+	}
+	
+	void GetData(Benchmark::Timer& timer, unsigned int iterations) {
+		EnvelopeSPTR envelope(new Envelope());
+		for (unsigned int index = 0; index < 256; ++index) {
+			envelope->AddData(static_cast<int>(index));
+		}
+		
+		int sum = 0;
+		
+		timer.Start();
+		for (unsigned int index = 0; index < iterations; ++index) {
+			sum += envelope->GetDataInt(index % 256);
+		}
+		timer.Stop();
+		
+		Benchmark::Consume(sum);
+	}
+	
+	void SaveToDisk(bool binary, Benchmark::Timer& timer, unsigned int iterations) {
+		EnvelopeSPTR envelope(MakeSaveEnvelope(1000));
+		std::string filename((boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("nlsbench-%%%%%%%%")).string());
+		
+		timer.Start();
+		for (unsigned int index = 0; index < iterations; ++index) {
+			if (binary) {
+				::SaveToDiskBinary(envelope, filename);
+			}
+			else {
+				::SaveToDisk(envelope, filename);
+			}
+		}
+		timer.Stop();
+		
+		boost::system::error_code error;
+		boost::filesystem::remove(filename, error);
+	}
+	
+	void LoadFromDisk(bool binary, Benchmark::Timer& timer, unsigned int iterations) {
+		EnvelopeSPTR envelope(MakeSaveEnvelope(1000));
+		std::string filename((boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("nlsbench-%%%%%%%%")).string());
+		
+		if (binary) {
+			::SaveToDiskBinary(envelope, filename);
+		}
+		else {
+			::SaveToDisk(envelope, filename);
+		}
+		
+		timer.Start();
+		for (unsigned int index = 0; index < iterations; ++index) {
+			EnvelopeSPTR loaded(new Envelope());
+			::LoadFromDisk(loaded, filename);
+			
+			// Touch every record so lazily decoded binary loads pay the same cost as text ones.
+			unsigned int count = loaded->GetCount();
+			for (unsigned int record = 0; record < count; ++record) {
+				Benchmark::Consume(loaded->GetDataEnvelopeSPTR(record)->GetDataString(0).size());
+			}
+		}
+		timer.Stop();
+		
+		boost::system::error_code error;
+		boost::filesystem::remove(filename, error);
+	}
+}
+
+namespace Benchmark {
+	void AddEnvelopeBenchmarks(Runner& runner) {
+		runner.Add("Envelope", "AddData/int", 100000, &AddData);
+		runner.Add("Envelope", "GetData/int", 100000, &GetData);
+		runner.Add("Envelope", "SaveToDisk/text/1000records", 10, boost::bind(&SaveToDisk, false, _1, _2));
+		runner.Add("Envelope", "SaveToDisk/binary/1000records", 10, boost::bind(&SaveToDisk, true, _1, _2));
+		runner.Add("Envelope", "LoadFromDisk/text/1000records", 10, boost::bind(&LoadFromDisk, false, _1, _2));
+		runner.Add("Envelope", "LoadFromDisk/binary/1000records", 10, boost::bind(&LoadFromDisk, true, _1, _2));
+	}
+}
@@ -0,0 +1,59 @@
+/**
+* \file
+* \author agent
+* \date 2026-10-19
+* \brief Benchmarks of LOG throughput.
+*/
+
+#include "Benchmark.h"
+
+// Standard Includes
+#include <string>
+
+// Library Includes
+#include <boost/bind.hpp>
+#include <boost/filesystem.hpp>
+#include <boost/scoped_ptr.hpp>
+
+// Local Includes
+#include "../sharedbase/EventLogger.h"
+
+// Local Types
+namespace {
+	void Log(bool to_file, const std::string& message, Benchmark::Timer& timer, unsigned int iterations) {
+		// A logger of its own, so the benchmark's output doesn't flood the real log.
+		boost::scoped_ptr<EventLogger> elog(EventLogger::CreateEventLogger());
+		boost::filesystem::path log_file(boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("nlsbench-%%%%%%%%.log"));
+		
+		if (to_file) {
+			elog->SetLogFile(log_file.string());
+		}
+		
+		{
+			EventLogger::ThreadBinding log_binding(elog.get());
+			
+			timer.Start();
+			for (unsigned int index = 0; index < iterations; ++index) {
+				LOG(LOG_PRIORITY::INFO, message);
+			}
+			timer.Stop();
+		}
+		
+		elog.reset();
+		
+		boost::system::error_code error;
+		boost::filesystem::remove(log_file, error);
+	}
+}
+
+namespace Benchmark {
+	void AddEventLoggerBenchmarks(Runner& runner) {
+		std::string short_message("Entity 'player' created.");
+		std::string long_message(std::string(240, 'x') + "\n\"quoted\"\t/path\\");
+		
+		// Without a log file messages are only formatted and queued.
+		runner.Add("EventLogger", "LOG/queued/short", 20000, boost::bind(&Log, false, short_message, _1, _2));
+		runner.Add("EventLogger", "LOG/file/short", 2000, boost::bind(&Log, true, short_message, _1, _2));
+		runner.Add("EventLogger", "LOG/file/long", 2000, boost::bind(&Log, true, long_message, _1, _2));
+	}
+}
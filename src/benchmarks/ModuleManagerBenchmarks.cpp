@@ -0,0 +1,71 @@
+/**
+* \file
+* \author agent
+* \date 2026-10-19
+* \brief Benchmarks of ModuleManager::Update over synthetic in-process modules.
+*/
+
+#include "Benchmark.h"
+
+// Standard Includes
+#include <vector>
+
+// Library Includes
+#include <boost/bind.hpp>
+#include <boost/lexical_cast.hpp>
+
+// Local Includes
+#include "../sharedbase/ModuleInterface.h"
+#include "../enginecore/ModuleManager.h"
+
+// Local Types
+namespace {
+	/**
+	* \brief Stands in for a real module: integrates a block of positions each update.
+	*/
+	class SyntheticModule : public ModuleInterface {
+	public:
+		SyntheticModule(unsigned int work) : positions(work, 0.0f), velocities(work, 1.0f) {}
+		
+		void Update(double dt) {
+			float step = static_cast<float>(dt);
+			for (size_t index = 0; index < this->positions.size(); ++index) {
+				this->positions[index] += this->velocities[index] * step;
+			}
+			Benchmark::Consume(this->positions.empty() ? 0.0f : this->positions.back());
+		}
+		
+		WHO_DELETES::TYPE RemoveComponent(ComponentInterface*) {
+			return WHO_DELETES::CALLER;
+		}
+		
+	private:
+		std::vector<float> positions;
+		std::vector<float> velocities;
+	};
+	
+	void Update(unsigned int module_count, unsigned int work, Benchmark::Timer& timer, unsigned int iterations) {
+		ModuleManager modmgr((OSInterfaceSPTR()));
+		
+		for (unsigned int index = 0; index < module_count; ++index) {
+			modmgr.AddModule("synthetic" + boost::lexical_cast<std::string>(index), new SyntheticModule(work));
+		}
+		
+		timer.Start();
+		for (unsigned int index = 0; index < iterations; ++index) {
+			modmgr.Update(1.0 / 60.0);
+		}
+		timer.Stop();
+		
+		modmgr.Shutdown();
+	}
+}
+
+namespace Benchmark {
+	void AddModuleManagerBenchmarks(Runner& runner) {
+		// Dispatch overhead alone, then modules doing a realistic amount of work.
+		runner.Add("ModuleManager", "Update/8modules/idle", 100000, boost::bind(&Update, 8, 0, _1, _2));
+		runner.Add("ModuleManager", "Update/64modules/idle", 20000, boost::bind(&Update, 64, 0, _1, _2));
+		runner.Add("ModuleManager", "Update/8modules/1000floats", 10000, boost::bind(&Update, 8, 1000, _1, _2));
+	}
+}
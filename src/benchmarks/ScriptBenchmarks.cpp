@@ -0,0 +1,193 @@
+/**
+* \file
+* \author agent
+* \date 2026-10-19
+* \brief Benchmarks of calling into scripts through ScriptExecutor.
+*/
+
+#include "Benchmark.h"
+
+// Standard Includes
+#include <fstream>
+
+// Library Includes
+#include <angelscript.h>
+#include <boost/bind.hpp>
+#include <boost/filesystem.hpp>
+#include <boost/scoped_ptr.hpp>
+#include <boost/shared_ptr.hpp>
+
+// Local Includes
+#include "../sharedbase/EventLogger.h"
+#include "../enginecore/ScriptEngine.h"
+#include "../enginecore/ScriptExecutor.h"
+
+// Local Types
+namespace {
+	const char* BENCHMARK_SCRIPT =
+		"void Noop() {}\n"
+		"float Accumulate(float x) {\n"
+		"	float sum = 0;\n"
+		"	for (int i = 0; i < 100; i++) {\n"
+		"		sum += x * i;\n"
+		"	}\n"
+		"	return sum;\n"
+		"}\n"
+		"Vector MoveAll(uint count) {\n"
+		"	Vector position(0, 0, 0);\n"
+		"	Vector velocity(0.016f, 0.032f, 0.048f);\n"
+		"	for (uint i = 0; i < count; i++) {\n"
+		"		position = position + velocity;\n"
+		"	}\n"
+		"	return position;\n"
+		"}\n"
+		"void MoveScriptArray(uint count) {\n"
+		"	array<Vector> positions(count);\n"
+		"	array<Vector> velocities(count, Vector(0.016f, 0.032f, 0.048f));\n"
+		"	for (uint i = 0; i < count; i++) {\n"
+		"		positions[i] = positions[i] + velocities[i];\n"
+		"	}\n"
+		"}\n"
+		"void MoveVectorArray(uint count) {\n"
+		"	VectorArray positions(count);\n"
+		"	VectorArray velocities(count, Vector(0.016f, 0.032f, 0.048f));\n"
+		"	positions.Add(velocities);\n"
+		"}\n"
+	;
+	
+	/// A script engine with a script built, created on first use: the benchmark script, unless given a file.
+	struct ScriptFixture {
+		explicit ScriptFixture(bool use_jit = true, const std::string& script_file = "") : useJIT(use_jit), scriptFile(script_file) { }
+		
+		ScriptEngine& Get() {
+			if (!this->engine) {
+				this->engine.reset(new ScriptEngine(this->useJIT));
+				EventLogger::RegisterScriptEngine(this->engine.get()); // For the script unit tests.
+				
+				if (!this->scriptFile.empty()) {
+					this->engine->LoadScriptFile(this->scriptFile);
+					return *this->engine;
+				}
+				
+				boost::filesystem::path script_file(boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("nlsbench-%%%%%%%%.as"));
+				{
+					std::ofstream out(script_file.string().c_str());
+					out << BENCHMARK_SCRIPT;
+				}
+				this->engine->LoadScriptFile(script_file.string());
+				
+				boost::system::error_code error;
+				boost::filesystem::remove(script_file, error);
+			}
+			return *this->engine;
+		}
+		
+		bool useJIT;
+		std::string scriptFile;
+		boost::scoped_ptr<ScriptEngine> engine;
+	};
+	
+	void Prepare(const boost::shared_ptr<ScriptFixture>& fixture, Benchmark::Timer& timer, unsigned int iterations) {
+		boost::scoped_ptr<ScriptExecutor> exec(fixture->Get().ScriptExecutorFactory());
+		
+		timer.Start();
+		for (unsigned int index = 0; index < iterations; ++index) {
+			exec->PrepareFunction("void Noop()", "enginecore");
+		}
+		timer.Stop();
+	}
+	
+	void PrepareExecute(const boost::shared_ptr<ScriptFixture>& fixture, const std::string& decl, unsigned int argument, Benchmark::Timer& timer, unsigned int iterations) {
+		boost::scoped_ptr<ScriptExecutor> exec(fixture->Get().ScriptExecutorFactory());
+		
+		timer.Start();
+		for (unsigned int index = 0; index < iterations; ++index) {
+			exec->PrepareFunction(decl, "enginecore");
+			if (argument > 0) {
+				exec->SetFunctionParam(0, argument);
+			}
+			exec->ExecuteFunction();
+		}
+		timer.Stop();
+	}
+	
+	void Execute(const boost::shared_ptr<ScriptFixture>& fixture, Benchmark::Timer& timer, unsigned int iterations) {
+		asIScriptEngine* as_engine = fixture->Get().GetasIScriptEngine();
+		asIScriptFunction* func = as_engine->GetModule("enginecore")->GetFunctionByDecl("float Accumulate(float)");
+		boost::scoped_ptr<ScriptExecutor> exec(fixture->Get().ScriptExecutorFactory());
+		float sum = 0.0f;
+		
+		timer.Start();
+		for (unsigned int index = 0; index < iterations; ++index) {
+			exec->PrepareFunction(func);
+			exec->SetFunctionParam(0, 0.5f);
+			exec->ExecuteFunction();
+			sum += exec->GetReturnFloat();
+		}
+		timer.Stop();
+		
+		Benchmark::Consume(sum);
+	}
+	
+	/// Runs a set of the script unit tests, as UnitTest::ExecuteTests does.
+	void ExecuteTestSet(const boost::shared_ptr<ScriptFixture>& fixture, const std::string& test_set, Benchmark::Timer& timer, unsigned int iterations) {
+		asIScriptModule* module = fixture->Get().GetasIScriptEngine()->GetModule("enginecore");
+		module->SetDefaultNamespace(test_set.c_str());
+		asIScriptFunction* func = module->GetFunctionByDecl("void ExecuteTests()");
+		module->SetDefaultNamespace("");
+		boost::scoped_ptr<ScriptExecutor> exec(fixture->Get().ScriptExecutorFactory());
+		
+		timer.Start();
+		for (unsigned int index = 0; index < iterations; ++index) {
+			exec->PrepareFunction(func);
+			exec->ExecuteFunction();
+		}
+		timer.Stop();
+	}
+	
+	/// The startup cost of the math bindings, on a fresh engine each time.
+	void RegisterMathTypes(Benchmark::Timer& timer, unsigned int iterations) {
+		for (unsigned int index = 0; index < iterations; ++index) {
+			asIScriptEngine* as_engine = asCreateScriptEngine(ANGELSCRIPT_VERSION);
+			
+			timer.Start();
+			ScriptEngine::RegisterMathTypes(as_engine);
+			timer.Stop();
+			
+			as_engine->Release();
+		}
+	}
+}
+
+namespace Benchmark {
+	void AddScriptBenchmarks(Runner& runner) {
+		boost::shared_ptr<ScriptFixture> fixture(new ScriptFixture());
+		
+		runner.Add("ScriptExecutor", "PrepareFunction/byDecl", 100000, boost::bind(&Prepare, fixture, _1, _2));
+		runner.Add("ScriptExecutor", "PrepareExecute/Noop", 100000, boost::bind(&PrepareExecute, fixture, std::string("void Noop()"), 0u, _1, _2));
+		runner.Add("ScriptExecutor", "Execute/Accumulate100", 20000, boost::bind(&Execute, fixture, _1, _2));
+		runner.Add("ScriptExecutor", "PrepareExecute/MoveAll1000", 1000, boost::bind(&PrepareExecute, fixture, std::string("Vector MoveAll(uint)"), 1000u, _1, _2));
+		runner.Add("ScriptExecutor", "PrepareExecute/MoveScriptArray1000", 1000, boost::bind(&PrepareExecute, fixture, std::string("void MoveScriptArray(uint)"), 1000u, _1, _2));
+		runner.Add("ScriptExecutor", "PrepareExecute/MoveVectorArray1000", 1000, boost::bind(&PrepareExecute, fixture, std::string("void MoveVectorArray(uint)"), 1000u, _1, _2));
+		runner.Add("ScriptEngine", "RegisterMathTypes", 200, boost::bind(&RegisterMathTypes, _1, _2));
+		
+		// The same scripts run by the bytecode interpreter, and by the JIT when it is built in.
+		const char* modes[] = {"Interpreted", "JIT"};
+#ifdef NLS_ENGINE_AS_JIT
+		const unsigned int mode_count = 2;
+#else
+		const unsigned int mode_count = 1;
+#endif
+		for (unsigned int mode = 0; mode < mode_count; ++mode) {
+			const bool use_jit = (mode == 1);
+			const std::string name(modes[mode]);
+			boost::shared_ptr<ScriptFixture> mode_fixture(new ScriptFixture(use_jit));
+			boost::shared_ptr<ScriptFixture> tests_fixture(new ScriptFixture(use_jit, std::string(NLS_ENGINE_SCRIPT_TESTS_PATH) + "/TestFramework.as"));
+			
+			runner.Add("ScriptJIT", name + "/Accumulate100", 20000, boost::bind(&Execute, mode_fixture, _1, _2));
+			runner.Add("ScriptJIT", name + "/MoveAll1000", 1000, boost::bind(&PrepareExecute, mode_fixture, std::string("Vector MoveAll(uint)"), 1000u, _1, _2));
+			runner.Add("ScriptJIT", name + "/Vector3MathTests", 100, boost::bind(&ExecuteTestSet, tests_fixture, std::string("Vector3MathTests"), _1, _2));
+			runner.Add("ScriptJIT", name + "/RotationMathTests", 100, boost::bind(&ExecuteTestSet, tests_fixture, std::string("RotationMathTests"), _1, _2));
+		}
+	}
+}
@@ -0,0 +1,91 @@
+/**
+* \file
+* \author agent
+* \date 2026-10-19
+* \brief Entry point of the benchmark suite.
+*
+* Usage: nlsbenchmark [--output <file.json>] [--filter <text>] [--repetitions <n>] [--label <text>] [--log <file>]
+* Results go to standard output unless an output file is given.
+*/
+
+// Standard Includes
+#include <fstream>
+#include <iostream>
+#include <string>
+
+// Library Includes
+#include <boost/lexical_cast.hpp>
+
+// Local Includes
+#include "Benchmark.h"
+#include "../sharedbase/EventLogger.h"
+
+int main(int argc, char* argv[]) {
+	Benchmark::Runner runner;
+	std::string output_file;
+	std::string log_file("nlsbenchmark.log");
+	
+	for (int index = 1; index < argc; ++index) {
+		std::string argument(argv[index]);
+		
+		if (index + 1 >= argc) {
+			std::cerr << "Missing value for '" << argument << "'." << std::endl;
+			return 1;
+		}
+		
+		std::string value(argv[++index]);
+		
+		if (argument == "--output") {
+			output_file = value;
+		}
+		else if (argument == "--filter") {
+			runner.SetFilter(value);
+		}
+		else if (argument == "--repetitions") {
+			try {
+				runner.SetRepetitions(boost::lexical_cast<unsigned int>(value));
+			}
+			catch (boost::bad_lexical_cast&) {
+				std::cerr << "Invalid repetition count '" << value << "'." << std::endl;
+				return 1;
+			}
+		}
+		else if (argument == "--label") {
+			runner.SetLabel(value);
+		}
+		else if (argument == "--log") {
+			log_file = value;
+		}
+		else {
+			std::cerr << "Unknown option '" << argument << "'." << std::endl;
+			return 1;
+		}
+	}
+	
+	// The engine code under test logs as it normally would, so the log file is part of what's measured.
+	EventLogger::module = "Benchmark";
+	EventLogger::GetEventLogger()->SetLogFile(log_file);
+	
+	Benchmark::AddEntityBenchmarks(runner);
+	Benchmark::AddEnvelopeBenchmarks(runner);
+	Benchmark::AddEventLoggerBenchmarks(runner);
+	Benchmark::AddModuleManagerBenchmarks(runner);
+	Benchmark::AddScriptBenchmarks(runner);
+	
+	runner.Run();
+	
+	if (output_file.empty()) {
+		runner.WriteJSON(std::cout);
+	}
+	else {
+		std::ofstream out(output_file.c_str());
+		runner.WriteJSON(out);
+		
+		if (!out) {
+			std::cerr << "Unable to write '" << output_file << "'." << std::endl;
+			return 1;
+		}
+	}
+	
+	return 0;
+}
@@ -0,0 +1,42 @@
+/**
+* \file
+* \author agent
+* \date 2026-10-19
+* \brief AsyncDiskOperation registration function
+*
+*/
+
+// System Library Includes
+#include <cassert>
+#include <string>
+
+// Application Library Includes
+#include <angelscript.h>
+
+// Local Includes
+#include "../sharedbase/AsyncDiskOperation.h"
+
+// Static class member initialization
+
+// Class methods in the order they are defined within the class header
+
+/**
+* \param[in] as_engine A pointer to the Angelscript engine instance.
+*/
+void AsyncDiskOperation::Register(asIScriptEngine* const as_engine) {
+	int ret = 0;
+	
+	ret = as_engine->SetDefaultNamespace("Engine"); assert(ret >= 0);
+	
+	ret = as_engine->RegisterObjectType("DiskOperation", 0, asOBJ_REF); assert(ret >= 0);
+	ret = as_engine->RegisterObjectBehaviour("DiskOperation", asBEHAVE_ADDREF,  "void f()", asMETHOD(AsyncDiskOperation, Addref),  asCALL_THISCALL); assert(ret >= 0);
+	ret = as_engine->RegisterObjectBehaviour("DiskOperation", asBEHAVE_RELEASE, "void f()", asMETHOD(AsyncDiskOperation, Release), asCALL_THISCALL); assert(ret >= 0);
+	
+	ret = as_engine->RegisterObjectMethod("DiskOperation", "bool IsComplete() const",            asMETHOD(AsyncDiskOperation, IsComplete),  asCALL_THISCALL); assert(ret >= 0);
+	ret = as_engine->RegisterObjectMethod("DiskOperation", "bool Succeeded() const",             asMETHOD(AsyncDiskOperation, Succeeded),   asCALL_THISCALL); assert(ret >= 0);
+	ret = as_engine->RegisterObjectMethod("DiskOperation", "void Wait() const",                  asMETHOD(AsyncDiskOperation, Wait),        asCALL_THISCALL); assert(ret >= 0);
+	ret = as_engine->RegisterObjectMethod("DiskOperation", "const string& GetFilename() const",  asMETHOD(AsyncDiskOperation, GetFilename), asCALL_THISCALL); assert(ret >= 0);
+	
+	// Clean up after myself
+	ret = as_engine->SetDefaultNamespace(""); assert(ret >= 0);
+}
@@ -16,6 +16,7 @@
 // Application Library Includes
 
 // Local Includes
+#include "../sharedbase/AsyncDiskOperation.h"
 #include "../sharedbase/EventLogger.h"
 #include "../sharedbase/OSInterface.h"
 
@@ -25,15 +26,27 @@
 
 /**
 * \param[in] os A SPTR to an instance of OSInterface. This is stored, and also used to get the working directory and EventLogger.
+* \param[in] private_log Whether to log to an EventLogger owned by this instance rather than the one from the OS.
 */
-EngineCore::EngineCore( OSInterfaceSPTR os ) : now(boost::chrono::steady_clock::now()), workingdir(os->GetPath(SYSTEM_DIRS::EXECUTABLE)), elog(os->GetLogger()), os(os) {
+EngineCore::EngineCore( OSInterfaceSPTR os, bool private_log ) : now(boost::chrono::steady_clock::now()), workingdir(os->GetPath(SYSTEM_DIRS::EXECUTABLE)), privateLog(private_log ? EventLogger::CreateEventLogger() : nullptr), elog(private_log ? this->privateLog.get() : os->GetLogger()), snapshot(EntList), spatialIndex(EntList), modmgr(os), os(os) {
+	this->snapshot.SetPath(this->workingdir + "/world");
+}
 
+EngineCore::~EngineCore() {
+	if (this->os->GetInputEngine() == &this->engine) {
+		this->os->SetInputEngine(nullptr);
+	}
+	
+	// Released once the members that follow it are destroyed, as they may log.
+	this->destroyBinding.reset(new EventLogger::ThreadBinding(this->elog));
 }
 
 /**
 * \return True on a successful config.
 */
 bool EngineCore::StartUp() {
+	EventLogger::ThreadBinding log_binding(this->elog);
+	
 	EventLogger::RegisterScriptEngine(&engine);
 	this->os->RegisterScriptEngine(&engine);
 
@@ -51,11 +64,17 @@ bool EngineCore::StartUp() {
 			return false;
 		}
 		delete exec;
+		
+		// Modules loaded in the background register here, so that the game play script can use them.
+		this->modmgr.FinishLoading();
 	} this->engine.EndConfigGroup();
 
 	// Register the APIs available to game play scripts.
 	this->engine.BeginConfigGroup("gameplay"); {
 		this->EntList.RegisterScriptEngine(&engine);
+		this->snapshot.RegisterScriptEngine(&engine);
+		this->spatialIndex.RegisterScriptEngine(&engine);
+		this->modmgr.RegisterMetricsScriptEngine(&engine);
 		this->engine.LoadScriptFile(engine.GetGameScript());
 		ScriptExecutor* exec = engine.ScriptExecutorFactory();
 		as_status = exec->PrepareFunction(std::string("void main()"), std::string("enginecore"));
@@ -65,11 +84,18 @@ bool EngineCore::StartUp() {
 			return false;
 		}
 		delete exec;
+		
+		// Modules loaded in the background register here, so that the game play script can use them.
+		this->modmgr.FinishLoading();
 	} this->engine.EndConfigGroup();
 
 	return this->engine.IsRunning();
 }
 
+void EngineCore::AttachInput() {
+	this->os->SetInputEngine(&this->engine);
+}
+
 /**
 * \return True if the script engine is running.
 */
@@ -77,16 +103,54 @@ bool EngineCore::IsRunning() {
 	return this->engine.IsRunning();
 }
 
+/**
+* \return The fixed updates per second, or 0 when running at a variable rate.
+*/
+double EngineCore::GetTickRate() {
+	return this->engine.GetTickRate();
+}
+
 void EngineCore::Update() {
+	EventLogger::ThreadBinding log_binding(this->elog);
+	
 	// Timing variables used in the update function for the main loop.
 	this->oldnow = this->now;
 	this->now = boost::chrono::steady_clock::now();
 	this->duraction = this->now - this->oldnow;
+	
+	// At a fixed tick rate every update simulates exactly one tick, however late it runs.
+	double tick_rate = this->engine.GetTickRate();
+	if (tick_rate > 0.0) {
+		this->duraction = boost::chrono::duration<double, boost::ratio<1,1>>(1.0 / tick_rate);
+	}
+	
+	// Report any background saves or loads that have finished.
+	DispatchAsyncDiskOperations();
+	
+	// Carry on with the script coroutines that are due, as far as their share of the frame allows.
+	this->engine.UpdateCoroutines(this->duraction.count());
 
 	// Calls update for each core.
 	this->modmgr.Update(this->duraction.count());
+	
+	// Entities moved during the frame are found in their new places from the next.
+	this->spatialIndex.Update();
+	
+	// Entities removed during the frame are only destroyed once everything is done with them.
+	this->EntList.DestroyRemovedEntities();
 }
 
 void EngineCore::Shutdown() {
+	EventLogger::ThreadBinding log_binding(this->elog);
+	
+	// Don't exit with saves still in flight.
+	FlushAsyncDiskOperations();
+	
+	// Write out the script profile, if one was being taken, while the engine's log is still bound.
+	this->engine.StopProfiler();
+	
+	// Their components belong to the modules, so must go first.
+	this->EntList.DestroyRemovedEntities();
+	
 	this->modmgr.Shutdown();
 }
@@ -10,19 +10,19 @@
 // System Library Includes
 
 // Application Library Includes
-// *NOTE: We don't need hybrid error checking, and it's nice to not have to compile and link the chrono library, so specify it to be header-only.
-#define BOOST_CHRONO_HEADER_ONLY
-#define BOOST_CHRONO_DONT_PROVIDE_HYBRID_ERROR_HANDLING 
 #include <boost/chrono.hpp>
+#include <boost/scoped_ptr.hpp>
 
 // Local Includes
+#include "../sharedbase/EventLogger.h"
 #include "ModuleManager.h"
 #include "ScriptEngine.h"
 #include "EntityMap.h"
+#include "SpatialIndex.h"
+#include "WorldSnapshot.h"
 #include "OSInterface_fwd.h"
 
 // Forward Declarations
-class EventLogger;
 
 // Typedefs
 
@@ -32,7 +32,13 @@ class EventLogger;
 */
 class EngineCore {
 public:
-	EngineCore(OSInterfaceSPTR os);
+	/**
+	* \param os The OS interface; one is shared by every engine instance in the process.
+	* \param private_log When true the engine logs through its own EventLogger instead of the process-wide one,
+	* so that several engines may run side by side, each on its own thread, without interleaving their logs.
+	*/
+	EngineCore(OSInterfaceSPTR os, bool private_log = false);
+	~EngineCore();
 
 	/**
 	* \brief Starts the script engine by calling config.as. After the config phase is done it loads the main gameplay script.
@@ -44,6 +50,18 @@ public:
 	*/
 	bool IsRunning();
 
+	/**
+	* \brief Returns the fixed updates per second requested by the config script, or 0 for a variable rate.
+	*/
+	double GetTickRate();
+
+	/**
+	* \brief Makes this the engine that the OS hands console and keyboard input to.
+	* \details The OS is shared by every engine in the process, so only one engine gets the input.  That engine must be
+	* updated on the thread that calls OSInterface::RouteMessages, as the input is run there.
+	*/
+	void AttachInput();
+
 	/**
 	* \brief Calls update on all loaded modules.
 	*/
@@ -58,9 +76,14 @@ private:
 	boost::chrono::duration<double, boost::ratio<1,1>> duraction;
 	std::string workingdir;
 
+	// *NOTE: The logger and the binding to it are declared before the members that log as they are destroyed, so as to outlive them.
+	boost::scoped_ptr<EventLogger> privateLog; // The logger created for this instance alone, if asked for.
 	EventLogger* elog;
+	boost::scoped_ptr<EventLogger::ThreadBinding> destroyBinding; // Binds elog while the members are destroyed.
 	ScriptEngine engine;
 	EntityMap EntList;
+	WorldSnapshot snapshot;
+	SpatialIndex spatialIndex;
 	ModuleManager modmgr;
 	OSInterfaceSPTR os;
 };
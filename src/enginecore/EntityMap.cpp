@@ -12,9 +12,12 @@
 #include "EntityMap.h"
 
 // System Library Includes
+#include <algorithm>
 #include <cassert>
 
 // Application Library Includes
+#include <angelscript/scriptarray.h>
+#include <boost/lexical_cast.hpp>
 
 // Local Includes
 #include "../sharedbase/EventLogger.h"
@@ -23,8 +26,40 @@
 
 // Static class member initialization
 
+// Local Functions
+namespace {
+	/**
+	* \brief Script wrapper for EntityMap::RemoveEntities.
+	*/
+	asUINT RemoveEntitiesFromScript(const CScriptArray& names, EntityMap* map) {
+		std::vector<std::string> name_list;
+		name_list.reserve(names.GetSize());
+		for (asUINT index = 0; index < names.GetSize(); ++index) {
+			name_list.push_back(*static_cast<const std::string*>(names.At(index)));
+		}
+		
+		return map->RemoveEntities(name_list);
+	}
+	
+	// Script wrappers for the methods that pass entities, converting between handles and EntitySPTRs.
+	bool AddEntityFromScript(Entity* entity, EntityMap* map) {
+		return map->AddEntity(Entity::FromScriptHandle(entity));
+	}
+	
+	Entity* FindEntityFromScript(const std::string& name, EntityMap* map) {
+		return Entity::ToScriptHandle(map->FindEntity(name));
+	}
+}
+
 // Class methods in the order they are defined within the class header
 
+EntityMap::~EntityMap(void) {
+	// Scripts or modules may keep hold of entities after the map is gone.
+	for (NamedEntityMap::iterator entitymap_it = this->entities.begin(); entitymap_it != this->entities.end(); ++entitymap_it) {
+		entitymap_it->second->changeList = nullptr;
+	}
+}
+
 /**
 * \param[in] as_engine A pointer to the Angelscript engine instance
 */
@@ -37,9 +72,11 @@ void EntityMap::RegisterScriptEngine(ScriptEngine* const engine ) {
 	
 	ret = as_engine->RegisterObjectType("EntityMap", 0, asOBJ_REF | asOBJ_NOHANDLE); assert(ret >= 0);
 	ret = as_engine->RegisterGlobalProperty("EntityMap gEntMap", this); assert(ret >= 0); // *TODO: Remove this global property and make EntityMap a full-on type similar to the spec's GenericMap type, just specialized ONLY for the Entity type.  When done this method should become static so main() doesn't have to instanciate the class.
-	ret = as_engine->RegisterObjectMethod("EntityMap", "bool AddEntity(const Entity)", asMETHODPR(EntityMap, AddEntity, (EntitySPTR const), bool), asCALL_THISCALL); assert(ret >= 0);
-	ret = as_engine->RegisterObjectMethod("EntityMap", "Entity FindEntity(const string &in)", asMETHODPR(EntityMap, FindEntity, (const std::string &), EntitySPTR), asCALL_THISCALL); assert(ret >= 0);
+	ret = as_engine->RegisterObjectMethod("EntityMap", "bool AddEntity(Entity@)", asFUNCTION(AddEntityFromScript), asCALL_CDECL_OBJLAST); assert(ret >= 0);
+	ret = as_engine->RegisterObjectMethod("EntityMap", "Entity@ FindEntity(const string &in)", asFUNCTION(FindEntityFromScript), asCALL_CDECL_OBJLAST); assert(ret >= 0);
 	ret = as_engine->RegisterObjectMethod("EntityMap", "bool RemoveEntity(const string &in)", asMETHODPR(EntityMap, RemoveEntity, (const std::string &), bool), asCALL_THISCALL); assert(ret >= 0);
+	ret = as_engine->RegisterObjectMethod("EntityMap", "uint RemoveEntities(const array<string> &in)", asFUNCTION(RemoveEntitiesFromScript), asCALL_CDECL_OBJLAST); assert(ret >= 0);
+	ret = as_engine->RegisterObjectMethod("EntityMap", "uint RemoveSubtree(const string &in)", asMETHODPR(EntityMap, RemoveSubtree, (const std::string &), unsigned int), asCALL_THISCALL); assert(ret >= 0);
 	
 	// Clean up after myself
 	ret = as_engine->SetDefaultNamespace("Engine"); assert(ret >= 0);
@@ -59,7 +96,24 @@ bool EntityMap::AddEntity( EntitySPTR const entity ) {
 
 		if (this->entities.find(&entity->GetName()) == this->entities.end()) {
 			EntitySPTR ent(entity);
+			
+			// Added back before the end of the frame it was removed in: it is no longer to be destroyed.
+			if (ent->destroyed) {
+				std::vector<EntitySPTR>::iterator removed_it = std::find(this->removed.begin(), this->removed.end(), ent);
+				if (removed_it != this->removed.end()) {
+					this->removed.erase(removed_it);
+				}
+				ent->destroyed = false;
+			}
+
 			this->entities[&ent->GetName()] = ent;
+			
+			ent->changeList = &this->changed;
+			ent->MarkChanged();
+			
+			for (std::vector<EntityMapObserver>::iterator observer_it = this->addObservers.begin(); observer_it != this->addObservers.end(); ++observer_it) {
+				(*observer_it)(ent);
+			}
 
 			LOG(LOG_PRIORITY::FLOW, "Adding entity: '" + entity->GetName() + "'");
 			return true;
@@ -102,17 +156,146 @@ EntitySPTR EntityMap::FindEntity( const std::string& name ) {
 bool EntityMap::RemoveEntity( const std::string& name ) {
 	NamedEntityMap::iterator entitymap_it = this->entities.find(&name);
 	if (entitymap_it != this->entities.end()) {
-		LOG(LOG_PRIORITY::FLOW, "Removing entity '" + name + "' and deleting it.");
+		this->Remove(entitymap_it);
+		
+		return true;
+	}
 
-		EntitySPTR ent(entitymap_it->second);
+	LOG(LOG_PRIORITY::CONFIG, "Entity '" + name +  "' not found. Unable to remove and delete.  Did you add it to the EntityMap?");
+	return false;
+}
 
-		this->entities.erase(entitymap_it);
+/**
+* \param[in] names The names of the entities to remove, such as all of those in a level being unloaded.
+* \return The number of entities removed.  Names not found are skipped.
+*/
+unsigned int EntityMap::RemoveEntities( const std::vector<std::string>& names ) {
+	unsigned int count = 0;
+	
+	for (std::vector<std::string>::const_iterator name_it = names.begin(); name_it != names.end(); ++name_it) {
+		NamedEntityMap::iterator entitymap_it = this->entities.find(&*name_it);
+		if (entitymap_it != this->entities.end()) {
+			this->Remove(entitymap_it);
+			++count;
+		}
+	}
+	
+	return count;
+}
 
-		ent->ClearComponents();
+/**
+* \param[in] name The name of the root of the subtree.
+* \return The number of entities removed.  Descendants that were never added to the map aren't counted, nor destroyed: they are only unparented.
+*/
+unsigned int EntityMap::RemoveSubtree( const std::string& name ) {
+	NamedEntityMap::iterator root_it = this->entities.find(&name);
+	if (root_it == this->entities.end()) {
+		LOG(LOG_PRIORITY::CONFIG, "Entity '" + name +  "' not found. Unable to remove it and its descendants.  Did you add it to the EntityMap?");
+		return 0;
+	}
+	
+	EntitySPTR root(root_it->second);
+	unsigned int count = 0;
+	
+	for (Entity::SubtreeIterator entity_it = root->SubtreeBegin(); entity_it != root->SubtreeEnd(); ++entity_it) {
+		NamedEntityMap::iterator entitymap_it = this->entities.find(&entity_it->GetName());
+		if (entitymap_it != this->entities.end() && entitymap_it->second.get() == &*entity_it) {
+			this->Remove(entitymap_it);
+			++count;
+		}
+	}
+	
+	return count;
+}
 
-		return true;
+void EntityMap::DestroyRemovedEntities() {
+	if (this->removed.empty()) {
+		return;
 	}
+	
+	// *NOTE: Swapped out first: entities removed by component destructors wait for the next call.
+	std::vector<EntitySPTR> destroying;
+	destroying.swap(this->removed);
+	
+	// Unparents the children of the removed entities through their child lists, rather than checking every entity left.
+	Entity::NotifyEntityRemoval(destroying);
+	
+	Entity::ClearComponents(destroying);
+	
+	// Done with: should one be added back in a later frame it starts afresh.
+	for (std::vector<EntitySPTR>::iterator entity_it = destroying.begin(); entity_it != destroying.end(); ++entity_it) {
+		(*entity_it)->destroyed = false;
+	}
+	
+	// Nor are the changes of entities no longer in the map wanted, so they needn't be kept alive for them.
+	std::vector<EntitySPTR>::iterator kept_it = this->changed.begin();
+	for (std::vector<EntitySPTR>::iterator entity_it = this->changed.begin(); entity_it != this->changed.end(); ++entity_it) {
+		if ((*entity_it)->changeList == &this->changed) {
+			kept_it->swap(*entity_it);
+			++kept_it;
+		}
+	}
+	this->changed.erase(kept_it, this->changed.end());
+	
+	LOG(LOG_PRIORITY::FLOW, "Destroyed " + boost::lexical_cast<std::string>(destroying.size()) + " removed entities.");
+}
 
-	LOG(LOG_PRIORITY::CONFIG, "Entity '" + name +  "' not found. Unable to remove and delete.  Did you add it to the EntityMap?");
-	return false;
+/**
+* \return The map of all entities.
+*/
+const NamedEntityMap& EntityMap::GetEntities() const {
+	return this->entities;
+}
+
+/**
+* \param[in] entitymap_it The entity's place in the map.
+*/
+void EntityMap::Remove( NamedEntityMap::iterator entitymap_it ) {
+	EntitySPTR ent(entitymap_it->second);
+	
+	this->entities.erase(entitymap_it);
+	
+	// Left in the changed list until it is next pruned or taken; should it be added back it is listed afresh.
+	ent->changeList = nullptr;
+	ent->changed = false;
+	ent->destroyed = true;
+	this->removed.push_back(ent);
+	
+	for (std::vector<EntityMapObserver>::iterator observer_it = this->removeObservers.begin(); observer_it != this->removeObservers.end(); ++observer_it) {
+		(*observer_it)(ent);
+	}
+}
+
+/**
+* \param[in] on_add Called with each entity after it is added.
+* \param[in] on_remove Called with each entity after it is removed, before it is destroyed.
+*/
+void EntityMap::AddObserver( const EntityMapObserver& on_add, const EntityMapObserver& on_remove ) {
+	this->addObservers.push_back(on_add);
+	this->removeObservers.push_back(on_remove);
+}
+
+/**
+* \param[out] entities Replaced with the entities added or changed, each once, leaving out any removed since.
+*/
+void EntityMap::TakeChangedEntities( std::vector<EntitySPTR>& entities ) {
+	entities.clear();
+	
+	// Entities removed since are left out, as is the earlier listing of one added back after being removed.
+	for (std::vector<EntitySPTR>::iterator entity_it = this->changed.begin(); entity_it != this->changed.end(); ++entity_it) {
+		if ((*entity_it)->changeList == &this->changed && (*entity_it)->changed) {
+			(*entity_it)->changed = false;
+			entities.push_back(*entity_it);
+		}
+	}
+	
+	this->changed.clear();
+	
+	// Those held by scripts may be written through their fields at any time without a call to say so, so they stay listed.
+	for (std::vector<EntitySPTR>::iterator entity_it = entities.begin(); entity_it != entities.end(); ++entity_it) {
+		if ((*entity_it)->scriptReferences > 0) {
+			(*entity_it)->changed = true;
+			this->changed.push_back(*entity_it);
+		}
+	}
 }
@@ -9,8 +9,10 @@
 // System Library Includes
 #include <map>
 #include <string>
+#include <vector>
 
 // Application Library Includes
+#include <boost/function.hpp>
 
 // Local Includes
 #include "../sharedbase/Entity_fwd.h"
@@ -42,6 +44,11 @@ struct strptrcmp : std::binary_function<const std::string*, const std::string*,
 */
 typedef std::map<const std::string*, EntitySPTR, strptrcmp> NamedEntityMap;
 
+/**
+* \brief Called with an entity as it is added to or removed from an EntityMap.
+*/
+typedef boost::function<void (EntitySPTR)> EntityMapObserver;
+
 /**
 * \brief        List of all entities stored in a map with their name as the key.
 * \details      A wrapper for a mapping of entities and their name (<string*, EntitySPTR>).
@@ -51,7 +58,7 @@ typedef std::map<const std::string*, EntitySPTR, strptrcmp> NamedEntityMap;
 class EntityMap {
 public:
 	EntityMap(void) { }
-	~EntityMap(void) {	}
+	~EntityMap(void);
 
 	/**
 	* \brief Angelscript registration for EntityMap. Additionally calls the registration for
@@ -70,9 +77,52 @@ public:
 	EntitySPTR FindEntity(const std::string &);
 	
 	/**
-	* \brief Removes an entity with the given name.
+	* \brief Removes an entity with the given name, leaving its destruction to DestroyRemovedEntities.
 	*/
 	bool RemoveEntity(const std::string &);
+	
+	/**
+	* \brief Removes the entities with the given names, leaving their destruction to DestroyRemovedEntities.
+	*/
+	unsigned int RemoveEntities(const std::vector<std::string> &);
+	
+	/**
+	* \brief Removes the named entity and all of its descendants, leaving their destruction to DestroyRemovedEntities.
+	*/
+	unsigned int RemoveSubtree(const std::string &);
+	
+	/**
+	* \brief Destroys the components of every entity removed since the last call, and unparents the entities left in the map from them.
+	* \details Called once at the end of each frame, so that modules and scripts never see components vanish while
+	* they are working through them.  Each module removes its components from all of the entities in one batch.
+	*/
+	void DestroyRemovedEntities();
+	
+	/**
+	* \brief Gives read access to every entity, ordered by name.
+	*/
+	const NamedEntityMap& GetEntities() const;
+	
+	/**
+	* \brief Has the given functions called with each entity as it is added, and as it is removed.
+	*/
+	void AddObserver(const EntityMapObserver&, const EntityMapObserver&);
+	
+	/**
+	* \brief Hands over the entities in the map that were added or marked as changed since the last call.
+	* \details Entities held by scripts are handed over every call, as scripts can change them unnoticed; the caller is to
+	* compare them against what it has.
+	*/
+	void TakeChangedEntities(std::vector<EntitySPTR>&);
 private:
+	/**
+	* \brief Takes the entity out of the map and queues it for destruction.
+	*/
+	void Remove(NamedEntityMap::iterator);
+	
 	NamedEntityMap entities; /**< The map of Entity::name to EntitySPTR. */
+	std::vector<EntitySPTR> removed; /**< Entities removed this frame, kept alive until DestroyRemovedEntities. */
+	std::vector<EntitySPTR> changed; /**< Entities added or marked as changed since TakeChangedEntities, each listed once. */
+	std::vector<EntityMapObserver> addObservers;
+	std::vector<EntityMapObserver> removeObservers;
 };
@@ -7,15 +7,69 @@
 */
 
 // System Library Includes
+#include <cassert>
+#include <vector>
 
 // Application Library Includes
+#include <angelscript.h>
+#include <angelscript/scriptarray.h>
 
 // Local Includes
-#include "sptrtypes.h"
 #include "../sharedbase/Entity.h"
 
 // Static class member initialization
 
+// Local Functions
+namespace {
+	/**
+	* \brief Script wrapper for Entity::GetWorldTransforms, resizing the outputs to match the entities.
+	*/
+	void GetWorldTransformsFromScript(const CScriptArray& entities, CScriptArray& positions, CScriptArray& rotations) {
+		// *NOTE: The script array keeps each element in its own allocation, so everything is copied through contiguous lists.
+		std::vector<EntitySPTR> entity_list;
+		entity_list.reserve(entities.GetSize());
+		for (asUINT index = 0; index < entities.GetSize(); ++index) {
+			Entity* entity = *static_cast<Entity* const*>(entities.At(index));
+			entity_list.push_back(entity != nullptr ? entity->shared_from_this() : EntitySPTR());
+		}
+		
+		std::vector<glm::vec3> position_list(entity_list.size());
+		std::vector<glm::fquat> rotation_list(entity_list.size());
+		if (!entity_list.empty()) {
+			Entity::GetWorldTransforms(entity_list, &position_list[0], &rotation_list[0], nullptr);
+		}
+		
+		positions.Resize(entities.GetSize());
+		rotations.Resize(entities.GetSize());
+		for (asUINT index = 0; index < entities.GetSize(); ++index) {
+			*static_cast<glm::vec3*>(positions.At(index)) = position_list[index];
+			*static_cast<glm::fquat*>(rotations.At(index)) = rotation_list[index];
+		}
+	}
+	
+	// Script wrappers for the methods that pass entities, converting between handles and EntitySPTRs.
+	void SetParentFromScript(Entity* new_parent, Entity* entity) {
+		entity->SetParent(Entity::FromScriptHandle(new_parent));
+	}
+	
+	Entity* GetParentFromScript(Entity* entity) {
+		return Entity::ToScriptHandle(entity->GetParent());
+	}
+	
+	// Script wrappers for the single point transforms.
+	glm::vec3 TransformPointFromScript(const glm::vec3& point, Entity* entity) {
+		glm::vec3 result;
+		entity->TransformPoints(&point, &result, 1);
+		return result;
+	}
+	
+	glm::vec3 InverseTransformPointFromScript(const glm::vec3& point, Entity* entity) {
+		glm::vec3 result;
+		entity->InverseTransformPoints(&point, &result, 1);
+		return result;
+	}
+}
+
 // Class methods in the order they are defined within the class header
 
 /**
@@ -24,48 +78,57 @@
 void Entity::Register(asIScriptEngine* const as_engine) {
 	int ret = 0;
 	
-	// *NOTE: Works, just there's an issue:
-	// In current scripts, Entity ent; creates an object.
-	// With this it creates a shared_ptr with a value pointed at garbage.  I'd like it to point at nullptr, but that's another issue.
-	// This problem means that scripts need to add an extra set of parens to call the ctor: Entity ent();
-	// This breaks backwards compat.
+	// *NOTE: Entity is a reference type counted by the entity itself, so scripts hold Entity@ handles and copying one
+	// is a plain increment.  Entity ent; creates a new entity, as does Entity ent("name");
 	
 	// Register Object
 	ret = as_engine->SetDefaultNamespace("Engine"); assert(ret >= 0);
 	
-	ret = as_engine->RegisterObjectType("Entity", sizeof(EntitySPTR), asOBJ_VALUE | asOBJ_APP_CLASS_CDAK); assert(ret >= 0);
+	ret = as_engine->RegisterObjectType("Entity", 0, asOBJ_REF); assert(ret >= 0);
 	
 	// Register behaviors and operations
-	ret = as_engine->RegisterObjectBehaviour("Entity", asBEHAVE_CONSTRUCT,  "void f()",                                asFUNCTIONPR(Entity::FactoryAtAddress,(void*), void),   asCALL_CDECL_OBJFIRST); assert(ret >= 0);
-	ret = as_engine->RegisterObjectBehaviour("Entity", asBEHAVE_CONSTRUCT,  "void f(const string& in)",                asFUNCTIONPR(Entity::FactoryAtAddress,(void*, const std::string&), void),   asCALL_CDECL_OBJFIRST); assert(ret >= 0);
-	ret = as_engine->RegisterObjectBehaviour("Entity", asBEHAVE_CONSTRUCT,  "void f(const Entity& in)", asFUNCTION(copy_construct<EntitySPTR>), asCALL_CDECL_OBJFIRST); assert(ret >= 0);
-	ret = as_engine->RegisterObjectBehaviour("Entity", asBEHAVE_DESTRUCT,   "void f()",                 asFUNCTION(destroy<EntitySPTR>),        asCALL_CDECL_OBJFIRST); assert(ret >= 0);
-	ret = as_engine->RegisterObjectMethod("Entity", "Entity &opAssign(const Entity &in)", asFUNCTION(assign<EntitySPTR>), asCALL_CDECL_OBJFIRST); assert(ret >= 0);
+	ret = as_engine->RegisterObjectBehaviour("Entity", asBEHAVE_FACTORY, "Entity@ f()",                  asFUNCTIONPR(Entity::ScriptFactory, (), Entity*),                   asCALL_CDECL); assert(ret >= 0);
+	ret = as_engine->RegisterObjectBehaviour("Entity", asBEHAVE_FACTORY, "Entity@ f(const string &in)",  asFUNCTIONPR(Entity::ScriptFactory, (const std::string&), Entity*), asCALL_CDECL); assert(ret >= 0);
+	ret = as_engine->RegisterObjectBehaviour("Entity", asBEHAVE_ADDREF,  "void f()", asMETHOD(Entity, AddScriptReference),     asCALL_THISCALL); assert(ret >= 0);
+	ret = as_engine->RegisterObjectBehaviour("Entity", asBEHAVE_RELEASE, "void f()", asMETHOD(Entity, ReleaseScriptReference), asCALL_THISCALL); assert(ret >= 0);
 	
-	ret = as_engine->RegisterObjectMethod("Entity", "float& get_scale() const",  REF_GETTER(Entity, scale), asCALL_CDECL_OBJFIRST); assert(ret >= 0);
-	ret = as_engine->RegisterObjectMethod("Entity", "void set_scale(const float& in)", REF_SETTER(Entity, scale), asCALL_CDECL_OBJFIRST); assert(ret >= 0);
+	// Register properties
+	// *NOTE: Written in place, with no call to list the change: the EntityMap lists entities for as long as scripts hold them.
+	ret = as_engine->RegisterObjectProperty("Entity", "Vector positionOffset",   asOFFSET(Entity, location)); assert(ret >= 0);
+	ret = as_engine->RegisterObjectProperty("Entity", "Rotation rotationOffset", asOFFSET(Entity, rotation)); assert(ret >= 0);
+	ret = as_engine->RegisterObjectProperty("Entity", "float scale",             asOFFSET(Entity, scale));    assert(ret >= 0);
 	
-	ret = as_engine->RegisterObjectMethod("Entity", "Vector& get_positionOffset() const",  REF_GETTER(Entity, location), asCALL_CDECL_OBJFIRST); assert(ret >= 0);
-	ret = as_engine->RegisterObjectMethod("Entity", "void set_positionOffset(const Vector& in)", REF_SETTER(Entity, location), asCALL_CDECL_OBJFIRST); assert(ret >= 0);
+	// Register methods
+	ret = as_engine->RegisterObjectMethod("Entity", "void SetParent(Entity@)", asFUNCTION(SetParentFromScript), asCALL_CDECL_OBJLAST); assert(ret >= 0);
+	ret = as_engine->RegisterObjectMethod("Entity", "Entity@ GetParent()",     asFUNCTION(GetParentFromScript), asCALL_CDECL_OBJLAST); assert(ret >= 0);
+	ret = as_engine->RegisterObjectMethod("Entity", "bool IsDestroyed()",      asMETHOD(Entity, IsDestroyed),   asCALL_THISCALL); assert(ret >= 0);
 	
-	//ret = as_engine->RegisterObjectMethod("Entity", "Rotation& get_rotationOffset() const",  REF_GETTER(Entity, rotation), asCALL_CDECL_OBJFIRST); assert(ret >= 0);
-	//ret = as_engine->RegisterObjectMethod("Entity", "void set_rotationOffset(const Rotation& in)", REF_SETTER(Entity, rotation), asCALL_CDECL_OBJFIRST); assert(ret >= 0);
+	ret = as_engine->RegisterObjectMethod("Entity", "float GetWorldScale()",   asMETHOD(Entity, GetWorldScale), asCALL_THISCALL); assert(ret >= 0);
+	ret = as_engine->RegisterObjectMethod("Entity", "void SetScale(float)",    asMETHOD(Entity, SetScale),      asCALL_THISCALL); assert(ret >= 0);
+	ret = as_engine->RegisterObjectMethod("Entity", "void ChangeScale(float)", asMETHOD(Entity, ChangeScale),   asCALL_THISCALL); assert(ret >= 0);
 	
-	// Register methods
-	ret = as_engine->RegisterObjectMethod("Entity", "void SetParent(Entity)", CALLER(Entity, SetParent),     asCALL_CDECL_OBJFIRST); assert(ret >= 0);
-	ret = as_engine->RegisterObjectMethod("Entity", "Entity GetParent()",     CALLER(Entity, GetParent),     asCALL_CDECL_OBJFIRST); assert(ret >= 0);
-
-	ret = as_engine->RegisterObjectMethod("Entity", "float GetWorldScale()",   CALLER(Entity, GetWorldScale), asCALL_CDECL_OBJFIRST); assert(ret >= 0);
-	ret = as_engine->RegisterObjectMethod("Entity", "float SetScale()",   CALLER(Entity, SetScale), asCALL_CDECL_OBJFIRST); assert(ret >= 0);
-	ret = as_engine->RegisterObjectMethod("Entity", "void ChangeScale(float)", CALLER(Entity, ChangeScale),   asCALL_CDECL_OBJFIRST); assert(ret >= 0);
+	ret = as_engine->RegisterObjectMethod("Entity", "Vector GetWorldPosition()",             asMETHOD(Entity, GetWorldPosition), asCALL_THISCALL); assert(ret >= 0);
+	ret = as_engine->RegisterObjectMethod("Entity", "void SetPosition(float, float, float)", asMETHOD(Entity, SetPosition),      asCALL_THISCALL); assert(ret >= 0);
+	ret = as_engine->RegisterObjectMethod("Entity", "void ChangePosition(Vector)",           asMETHOD(Entity, ChangePosition),   asCALL_THISCALL); assert(ret >= 0);
+	
+	ret = as_engine->RegisterObjectMethod("Entity", "Rotation GetWorldRotation()",              asMETHOD(Entity, GetWorldRotation), asCALL_THISCALL); assert(ret >= 0);
+	ret = as_engine->RegisterObjectMethod("Entity", "void SetRotation(Rotation)",               asMETHODPR(Entity, SetRotation, (glm::fquat), void), asCALL_THISCALL); assert(ret >= 0);
+	ret = as_engine->RegisterObjectMethod("Entity", "void SetRotation(float, float, float)",    asMETHODPR(Entity, SetRotation, (float, float, float), void), asCALL_THISCALL); assert(ret >= 0);
+	ret = as_engine->RegisterObjectMethod("Entity", "void ChangeRotation(Rotation)",            asMETHODPR(Entity, ChangeRotation, (glm::fquat), void), asCALL_THISCALL); assert(ret >= 0);
+	ret = as_engine->RegisterObjectMethod("Entity", "void ChangeRotation(float, float, float)", asMETHODPR(Entity, ChangeRotation, (float, float, float), void), asCALL_THISCALL); assert(ret >= 0);
+	
+	ret = as_engine->RegisterObjectMethod("Entity", "void GetWorldTransform(Vector &out, Rotation &out, float &out) const", asMETHOD(Entity, GetWorldTransform), asCALL_THISCALL); assert(ret >= 0);
+	ret = as_engine->RegisterObjectMethod("Entity", "void SetTransform(const Vector &in, const Rotation &in, float)",         asMETHOD(Entity, SetTransform),      asCALL_THISCALL); assert(ret >= 0);
+	ret = as_engine->RegisterObjectMethod("Entity", "void ChangeTransform(const Vector &in, const Rotation &in, float)",      asMETHOD(Entity, ChangeTransform),   asCALL_THISCALL); assert(ret >= 0);
 	
-	ret = as_engine->RegisterObjectMethod("Entity", "Vector GetWorldPosition()", CALLER(Entity, GetWorldPosition), asCALL_CDECL_OBJFIRST); assert(ret >= 0);
-	ret = as_engine->RegisterObjectMethod("Entity", "void SetPosition(float, float, float)", CALLER(Entity, SetPosition), asCALL_CDECL_OBJFIRST); assert(ret >= 0);
-	ret = as_engine->RegisterObjectMethod("Entity", "void ChangePosition(Vector)", CALLER(Entity, ChangePosition), asCALL_CDECL_OBJFIRST); assert(ret >= 0);
+	ret = as_engine->RegisterObjectMethod("Entity", "const Matrix &GetLocalMatrix() const",        asMETHOD(Entity, GetLocalMatrix),        asCALL_THISCALL); assert(ret >= 0);
+	ret = as_engine->RegisterObjectMethod("Entity", "const Matrix &GetWorldMatrix() const",        asMETHOD(Entity, GetWorldMatrix),        asCALL_THISCALL); assert(ret >= 0);
+	ret = as_engine->RegisterObjectMethod("Entity", "const Matrix &GetWorldInverseMatrix() const", asMETHOD(Entity, GetWorldInverseMatrix), asCALL_THISCALL); assert(ret >= 0);
+	ret = as_engine->RegisterObjectMethod("Entity", "Vector TransformPoint(const Vector &in) const",        asFUNCTION(TransformPointFromScript),        asCALL_CDECL_OBJLAST); assert(ret >= 0);
+	ret = as_engine->RegisterObjectMethod("Entity", "Vector InverseTransformPoint(const Vector &in) const", asFUNCTION(InverseTransformPointFromScript), asCALL_CDECL_OBJLAST); assert(ret >= 0);
 	
-	//ret = as_engine->RegisterObjectMethod("Entity", "Rotation GetWorldRotation()", CALLER(Entity, GetWorldRotation), asCALL_CDECL_OBJFIRST); assert(ret >= 0);
-	//ret = as_engine->RegisterObjectMethod("Entity", "void SetRotation(float, float, float)", CALLER_PR(Entity, SetRotation, (float, float, float), void), asCALL_CDECL_OBJFIRST); assert(ret >= 0);
-	//ret = as_engine->RegisterObjectMethod("Entity", "void ChangeRotation(float, float, float)", CALLER_PR(Entity, ChangeRotation, (float, float, float), void), asCALL_CDECL_OBJFIRST); assert(ret >= 0);
+	// Register functions
+	ret = as_engine->RegisterGlobalFunction("void GetWorldTransforms(const array<Entity@> &in, array<Vector> &inout, array<Rotation> &inout)", asFUNCTION(GetWorldTransformsFromScript), asCALL_CDECL); assert(ret >= 0);
 	
 	// Clean up after myself
 	ret = as_engine->SetDefaultNamespace(""); assert(ret >= 0);
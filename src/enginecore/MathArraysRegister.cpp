@@ -0,0 +1,140 @@
+/**
+* \file
+* \author agent
+* \date 2026-10-19
+* \brief VectorArray and RotationArray registration functions
+*
+*/
+
+// System Library Includes
+#include <cassert>
+#include <string>
+
+// Application Library Includes
+#include <angelscript.h>
+
+// Local Includes
+#include "../sharedbase/MathArrays.h"
+
+// Static class member initialization
+
+// Local Functions
+namespace {
+	// Script factories.  Each array is made with the one reference held for the script.
+	template <typename ArrayType> ArrayType* ArrayFactory() {
+		return new ArrayType();
+	}
+	
+	template <typename ArrayType> ArrayType* ArrayFactory(asUINT length) {
+		return new ArrayType(length);
+	}
+	
+	template <typename ArrayType, typename ElementType> ArrayType* ArrayFactory(asUINT length, const ElementType& value) {
+		return new ArrayType(length, value);
+	}
+	
+	template <typename ArrayType> ArrayType& ArrayAssign(const ArrayType& other, ArrayType* array) {
+		array->Assign(other);
+		return *array;
+	}
+	
+	/// Element access, raising a script exception when out of range the same as array<T> does.
+	template <typename ArrayType, typename ElementType> ElementType& ArrayIndex(asUINT index, ArrayType* array) {
+		if (index >= array->GetSize()) {
+			asGetActiveContext()->SetException("Index out of bounds");
+			static ElementType unused; // The script stops at the exception, before it can use the result.
+			return unused;
+		}
+		return (*array)[index];
+	}
+	
+	// Wrappers converting between the script's uint and std::size_t.
+	template <typename ArrayType> asUINT ArrayGetLength(const ArrayType* array) {
+		return static_cast<asUINT>(array->GetSize());
+	}
+	
+	template <typename ArrayType> void ArrayResize(asUINT length, ArrayType* array) {
+		array->Resize(length);
+	}
+	
+	template <typename ArrayType> void ArrayReserve(asUINT length, ArrayType* array) {
+		array->Reserve(length);
+	}
+	
+	/**
+	* \brief Registers the behaviours and methods common to both of the arrays.
+	* \param[in] type The script name of the array type.
+	* \param[in] element The script name of the element type.
+	*/
+	template <typename ArrayType, typename ElementType> void RegisterArrayCommon(asIScriptEngine* const as_engine, const std::string& type, const std::string& element) {
+		int ret = 0;
+		
+		ret = as_engine->RegisterObjectType(type.c_str(), 0, asOBJ_REF); assert(ret >= 0);
+		
+		// Register behaviors and operations
+		ret = as_engine->RegisterObjectBehaviour(type.c_str(), asBEHAVE_FACTORY, (type + "@ f()").c_str(), asFUNCTIONPR(ArrayFactory<ArrayType>, (), ArrayType*), asCALL_CDECL); assert(ret >= 0);
+		ret = as_engine->RegisterObjectBehaviour(type.c_str(), asBEHAVE_FACTORY, (type + "@ f(uint)").c_str(), asFUNCTIONPR(ArrayFactory<ArrayType>, (asUINT), ArrayType*), asCALL_CDECL); assert(ret >= 0);
+		ret = as_engine->RegisterObjectBehaviour(type.c_str(), asBEHAVE_FACTORY, (type + "@ f(uint, const " + element + " &in)").c_str(), asFUNCTIONPR((ArrayFactory<ArrayType, ElementType>), (asUINT, const ElementType&), ArrayType*), asCALL_CDECL); assert(ret >= 0);
+		ret = as_engine->RegisterObjectBehaviour(type.c_str(), asBEHAVE_ADDREF,  "void f()", asMETHOD(ArrayType, Addref),  asCALL_THISCALL); assert(ret >= 0);
+		ret = as_engine->RegisterObjectBehaviour(type.c_str(), asBEHAVE_RELEASE, "void f()", asMETHOD(ArrayType, Release), asCALL_THISCALL); assert(ret >= 0);
+		
+		ret = as_engine->RegisterObjectMethod(type.c_str(), (type + " &opAssign(const " + type + " &in)").c_str(), asFUNCTION(ArrayAssign<ArrayType>), asCALL_CDECL_OBJLAST); assert(ret >= 0);
+		ret = as_engine->RegisterObjectMethod(type.c_str(), (element + " &opIndex(uint)").c_str(),                 asFUNCTION((ArrayIndex<ArrayType, ElementType>)), asCALL_CDECL_OBJLAST); assert(ret >= 0);
+		ret = as_engine->RegisterObjectMethod(type.c_str(), ("const " + element + " &opIndex(uint) const").c_str(), asFUNCTION((ArrayIndex<ArrayType, ElementType>)), asCALL_CDECL_OBJLAST); assert(ret >= 0);
+		
+		// Register methods
+		ret = as_engine->RegisterObjectMethod(type.c_str(), "uint GetLength() const", asFUNCTION(ArrayGetLength<ArrayType>), asCALL_CDECL_OBJLAST); assert(ret >= 0);
+		ret = as_engine->RegisterObjectMethod(type.c_str(), "void Resize(uint)",      asFUNCTION(ArrayResize<ArrayType>),    asCALL_CDECL_OBJLAST); assert(ret >= 0);
+		ret = as_engine->RegisterObjectMethod(type.c_str(), "void Reserve(uint)",     asFUNCTION(ArrayReserve<ArrayType>),   asCALL_CDECL_OBJLAST); assert(ret >= 0);
+		ret = as_engine->RegisterObjectMethod(type.c_str(), ("void InsertLast(const " + element + " &in)").c_str(), asMETHOD(ArrayType, PushBack), asCALL_THISCALL); assert(ret >= 0);
+		ret = as_engine->RegisterObjectMethod(type.c_str(), "void RemoveLast()",      asMETHOD(ArrayType, PopBack), asCALL_THISCALL); assert(ret >= 0);
+		ret = as_engine->RegisterObjectMethod(type.c_str(), "void Clear()",           asMETHOD(ArrayType, Clear),   asCALL_THISCALL); assert(ret >= 0);
+	}
+}
+
+// Class methods in the order they are defined within the class header
+
+/**
+* \param[in] as_engine A pointer to the Angelscript engine instance, with Vector and RotationArray already registered.
+*/
+void VectorArray::Register(asIScriptEngine* const as_engine) {
+	int ret = 0;
+	
+	ret = as_engine->SetDefaultNamespace("Engine"); assert(ret >= 0);
+	
+	RegisterArrayCommon<VectorArray, glm::vec3>(as_engine, "VectorArray", "Vector");
+	
+	ret = as_engine->RegisterObjectMethod("VectorArray", "void Add(const Vector &in)",                     asMETHODPR(VectorArray, Add, (const glm::vec3&), void),        asCALL_THISCALL); assert(ret >= 0);
+	ret = as_engine->RegisterObjectMethod("VectorArray", "bool Add(const VectorArray &in)",                asMETHODPR(VectorArray, Add, (const VectorArray&), bool),      asCALL_THISCALL); assert(ret >= 0);
+	ret = as_engine->RegisterObjectMethod("VectorArray", "bool Subtract(const VectorArray &in)",           asMETHOD(VectorArray, Subtract),                               asCALL_THISCALL); assert(ret >= 0);
+	ret = as_engine->RegisterObjectMethod("VectorArray", "bool AddScaled(const VectorArray &in, float)",   asMETHOD(VectorArray, AddScaled),                              asCALL_THISCALL); assert(ret >= 0);
+	ret = as_engine->RegisterObjectMethod("VectorArray", "void Scale(float)",                              asMETHOD(VectorArray, Scale),                                  asCALL_THISCALL); assert(ret >= 0);
+	ret = as_engine->RegisterObjectMethod("VectorArray", "void Rotate(const Rotation &in)",                asMETHODPR(VectorArray, Rotate, (const glm::fquat&), void),    asCALL_THISCALL); assert(ret >= 0);
+	ret = as_engine->RegisterObjectMethod("VectorArray", "bool Rotate(const RotationArray &in)",           asMETHODPR(VectorArray, Rotate, (const RotationArray&), bool), asCALL_THISCALL); assert(ret >= 0);
+	ret = as_engine->RegisterObjectMethod("VectorArray", "bool Lerp(const VectorArray &in, float)",        asMETHOD(VectorArray, Lerp),                                   asCALL_THISCALL); assert(ret >= 0);
+	ret = as_engine->RegisterObjectMethod("VectorArray", "bool Min(const VectorArray &in)",                asMETHOD(VectorArray, Min),                                    asCALL_THISCALL); assert(ret >= 0);
+	ret = as_engine->RegisterObjectMethod("VectorArray", "bool Max(const VectorArray &in)",                asMETHOD(VectorArray, Max),                                    asCALL_THISCALL); assert(ret >= 0);
+	ret = as_engine->RegisterObjectMethod("VectorArray", "bool GetBounds(Vector &out, Vector &out) const", asMETHOD(VectorArray, GetBounds),                              asCALL_THISCALL); assert(ret >= 0);
+	
+	// Clean up after myself
+	ret = as_engine->SetDefaultNamespace(""); assert(ret >= 0);
+}
+
+/**
+* \param[in] as_engine A pointer to the Angelscript engine instance, with Rotation already registered.
+*/
+void RotationArray::Register(asIScriptEngine* const as_engine) {
+	int ret = 0;
+	
+	ret = as_engine->SetDefaultNamespace("Engine"); assert(ret >= 0);
+	
+	RegisterArrayCommon<RotationArray, glm::fquat>(as_engine, "RotationArray", "Rotation");
+	
+	ret = as_engine->RegisterObjectMethod("RotationArray", "void Multiply(const Rotation &in)",          asMETHODPR(RotationArray, Multiply, (const glm::fquat&), void),    asCALL_THISCALL); assert(ret >= 0);
+	ret = as_engine->RegisterObjectMethod("RotationArray", "bool Multiply(const RotationArray &in)",     asMETHODPR(RotationArray, Multiply, (const RotationArray&), bool), asCALL_THISCALL); assert(ret >= 0);
+	ret = as_engine->RegisterObjectMethod("RotationArray", "void Normalize()",                           asMETHOD(RotationArray, Normalize),                                asCALL_THISCALL); assert(ret >= 0);
+	ret = as_engine->RegisterObjectMethod("RotationArray", "bool Nlerp(const RotationArray &in, float)", asMETHOD(RotationArray, Nlerp),                                    asCALL_THISCALL); assert(ret >= 0);
+	
+	// Clean up after myself
+	ret = as_engine->SetDefaultNamespace(""); assert(ret >= 0);
+}
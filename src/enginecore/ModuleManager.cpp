@@ -8,10 +8,17 @@
 #include "ModuleManager.h"
 
 // Standard Includes
+#include <iomanip>
+#include <sstream>
 
 // Library Includes
+#include <boost/bind.hpp>
+#include <boost/filesystem.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/thread/thread.hpp>
 
 // Local Includes
+#include "../sharedbase/Envelope.h"
 #include "../sharedbase/ModuleInterface.h"
 #include "../sharedbase/EventLogger.h"
 #include "../sharedbase/OSInterface.h"
@@ -19,148 +26,424 @@
 
 // Static class member initialization
 
-// Class methods in the order they are defined within the class header
-
-/**
-* \param name The filename of the dynamic library to load.
-* \return LOADED if the modules is loaded otherwise LOAD_ERROR/START_ERROR on error..
-*/
-MODULE_STATUS::TYPE ModuleManager::Load(const std::string &name) {
-	if (name == "") {
-		LOG(LOG_PRIORITY::CONFIG, "Can't load a library with no name.");
-		return MODULE_STATUS::LOAD_ERROR;
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+// Local helpers
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+namespace {
+	const unsigned int MAX_UPDATE_INTERVAL = 8; ///< Modules are updated at least this often in frames, however far over budget.
+	const double TIME_SMOOTHING = 0.1; ///< Weight of the newest sample in averaged times.
+	const unsigned int GOVERNOR_SETTLE_FRAMES = 10; ///< Frames to wait after changing how often modules update, to see the effect.
+	const unsigned int GOVERNOR_RELAX_FRAMES = 60; ///< Frames under half of the budget before modules are updated more often again.
+	const boost::chrono::seconds METRICS_LOG_PERIOD(10);
+	
+	const char* PRIORITY_NAMES[UPDATE_PRIORITY::COUNT] = { "critical", "high", "normal", "low" };
+	
+	std::string FormatMilliseconds(double seconds) {
+		std::ostringstream out;
+		out << std::fixed << std::setprecision(3) << seconds * 1000.0 << " ms";
+		return out.str();
 	}
-
-	OSInterfaceSPTR operating_system(OSInterface::GetOSPointer());
-	std::string location =
-		operating_system->GetPath(SYSTEM_DIRS::EXECUTABLE) + "/" +
-		/*
+	
+	/**
+	* \param os The OS interface used to find the executable's folder.
+	* \param name The name of the module.
+	* \return The full path to the module's dynamic library.
+	*/
+	std::string GetLibraryLocation(OSInterfaceSPTR os, const std::string &name) {
+		return
+			os->GetPath(SYSTEM_DIRS::EXECUTABLE) + "/" +
+			/*
 #ifdef _MSC_VER
 	#ifdef _DEBUG
-		"Debug/" +
+			"Debug/" +
 	#else
-		"Release/" +
+			"Release/" +
 	#endif
 #endif
-	*/
-		name +
+		*/
+			name +
 #ifdef _WIN32
-		".dll";
+			".dll";
 #else
-		".so";
+			".so";
 #endif
-	;
+		;
+	}
 	
-	std::string message;
-	if (this->libraries.find(name) == this->libraries.end()) {
-		LOG(LOG_PRIORITY::FLOW, "Attempting to load library '" + name + "' from '" + location + "'.");
+	/**
+	* \brief Copies a library into the temporary folder under a new name, so that the OS sees it as a library not yet loaded.
+	* \return The path to the copy, or empty on error.
+	*/
+	std::string CopyLibrary(const std::string &name, const std::string &location) {
+		boost::filesystem::path original(location);
+		boost::filesystem::path copy(boost::filesystem::temp_directory_path() / boost::filesystem::unique_path(name + "-%%%%%%%%" + original.extension().string()));
 		
-		// Load the DLL ONLY if the library has not already been loaded in the past.
+		boost::system::error_code error;
+		boost::filesystem::copy_file(original, copy, boost::filesystem::copy_option::overwrite_if_exists, error);
+		if (error) {
+			LOG(LOG_PRIORITY::RESTART, "Unable to copy library '" + name + "' for hot reloading: " + error.message());
+			return "";
+		}
+		
+		return copy.string();
+	}
+	
+	/**
+	* \return True if the library was closed.
+	*/
+	bool CloseLibrary(DLLHANDLE library) {
 #ifdef _WIN32
-		HMODULE libdll = LoadLibrary(location.c_str());
+		return FreeLibrary(library) != 0;
 #else
-		void * libdll = dlopen(location.c_str(), RTLD_LAZY);
+		return dlclose(library) == 0;
 #endif
-		if (libdll != NULL) {
-			this->libraries[name] = libdll;
+	}
+	
+	/**
+	* \return The number of global functions, properties and types, used to tell whether a module registered a script interface.
+	*/
+	asUINT CountScriptInterface(asIScriptEngine* const as_engine) {
+		return as_engine->GetGlobalFunctionCount() + as_engine->GetGlobalPropertyCount() + as_engine->GetObjectTypeCount() + as_engine->GetEnumCount();
+	}
+	
+	/**
+	* \brief Deletes the module and forgets its interface version, so that a module later built at the same address isn't mistaken for it.
+	*/
+	void DeleteModule(ModuleInterface* module) {
+		ModuleInterface::ForgetInterfaceVersion(module);
+		delete module;
+	}
+	
+	void LogLibraryError(const std::string &fallback) {
+		std::string message;
+#ifdef _WIN32
+		char buf[256];
+		DWORD errcode = GetLastError();
+		FormatMessage(FORMAT_MESSAGE_FROM_SYSTEM, NULL, errcode, 0, buf, 256, NULL); // *TODO: Remove the trailing newline as it goofs our output.
+		message = buf;
+#else
+		message = fallback;
+#endif
+		LOG(LOG_PRIORITY::RESTART, message);
+	}
+	
+	/**
+	* \brief Opens the library, if not already open, and constructs its module.
+	* \details Touches nothing shared with the ModuleManager, so is safe to call from a worker thread.
+	* \param[in] name The name of the module.
+	* \param[in] location The path to the library.
+	* \param[in] os The OS interface handed to the module's factory.
+	* \param[in,out] library The library handle; if null the library is opened and the handle stored here.  Left null if the library was closed again due to error.
+	* \param[out] module The constructed module, or null on error.
+	* \return LOADED on success, otherwise LOAD_ERROR/START_ERROR.
+	*/
+	MODULE_STATUS::TYPE OpenModule(const std::string &name, const std::string &location, OSInterfaceSPTR os, DLLHANDLE &library, ModuleInterface* &module) {
+		module = nullptr;
+		
+		if (library == NULL) {
+			LOG(LOG_PRIORITY::FLOW, "Attempting to load library '" + name + "' from '" + location + "'.");
 			
-			LOG(LOG_PRIORITY::FLOW, "Loaded library '" + name + "' successfully.");
-		}
-		else {
 #ifdef _WIN32
-			char buf[256];
-			DWORD errcode = GetLastError();
-			FormatMessage(FORMAT_MESSAGE_FROM_SYSTEM, NULL, errcode, 0, buf, 256, NULL); // *TODO: Remove the trailing newline as it goofs our output.
-			message = buf;
+			library = LoadLibrary(location.c_str());
 #else
-			message = "Error loading library: " + name;
+			library = dlopen(location.c_str(), RTLD_LAZY);
 #endif
-			LOG(LOG_PRIORITY::RESTART, message);
+			if (library == NULL) {
+				LogLibraryError("Error loading library: " + name);
+				
+				LOG(LOG_PRIORITY::RESTART, "Library loading failed due to error.");
+				return MODULE_STATUS::LOAD_ERROR;
+			}
 			
-			LOG(LOG_PRIORITY::RESTART, "Library loading failed due to error.");
-			return MODULE_STATUS::LOAD_ERROR;
+			LOG(LOG_PRIORITY::FLOW, "Loaded library '" + name + "' successfully.");
 		}
-	}
-	else {
-		LOG(LOG_PRIORITY::CONFIG, "Library '" + name + "' already loaded, not reloading.");
-	}
-
-	{
+		
 		ModuleInstanceFactory fact;
 #ifdef _WIN32
-		fact = (ModuleInstanceFactory)GetProcAddress(this->libraries[name], "ModuleFactory");
+		fact = (ModuleInstanceFactory)GetProcAddress(library, "ModuleFactory");
 #else
-		fact = (ModuleInstanceFactory)dlsym(this->libraries[name], "ModuleFactory");
+		fact = (ModuleInstanceFactory)dlsym(library, "ModuleFactory");
 #endif
-
-		if (fact != nullptr) {
-			LOG(LOG_PRIORITY::FLOW, "Module factory acquired successfully.");
+		
+		if (fact == nullptr) {
+			LogLibraryError("Error loading module factory");
 			
-			ModuleInterface* module = fact(operating_system);
-			if (module != nullptr) {
-				module->Register(this->engine->GetasIScriptEngine());
-			}
-			else {
-				LOG(LOG_PRIORITY::FLOW, "Failed calling the module's factory.");
-				return MODULE_STATUS::START_ERROR;
-			}
-			this->modules[name] = module;
+			LOG(LOG_PRIORITY::RESTART, "Module factory loading aborted due to error.");
 			
+			CloseLibrary(library);
+			library = NULL;
+			
+			return MODULE_STATUS::START_ERROR;
 		}
-		else {
+		
+		LOG(LOG_PRIORITY::FLOW, "Module factory acquired successfully.");
+		
+		// Libraries from before the interface was versioned don't export a version.
+		ModuleInterfaceVersionQuery version_query;
 #ifdef _WIN32
-			char buf[256];
-			DWORD errcode = GetLastError();
-			FormatMessage(FORMAT_MESSAGE_FROM_SYSTEM, NULL, errcode, 0, buf, 256, NULL);
-			message = buf;
+		version_query = (ModuleInterfaceVersionQuery)GetProcAddress(library, "ModuleInterfaceVersion");
 #else
-			message = "Error loading module factory";
+		version_query = (ModuleInterfaceVersionQuery)dlsym(library, "ModuleInterfaceVersion");
 #endif
-			LOG(LOG_PRIORITY::RESTART, message);
+		unsigned int version = (version_query != nullptr) ? version_query() : 1;
+		
+		if (version == 0 || version > MODULE_INTERFACE_VERSION) {
+			LOG(LOG_PRIORITY::RESTART, "Module '" + name + "' was built against module interface version " + boost::lexical_cast<std::string>(version) +
+				", which this engine, at version " + boost::lexical_cast<std::string>(MODULE_INTERFACE_VERSION) + ", doesn't support.");
 			
-			LOG(LOG_PRIORITY::RESTART, "Module factory loading aborted due to error.");
+			CloseLibrary(library);
+			library = NULL;
 			
-			Unload(name);
-
 			return MODULE_STATUS::START_ERROR;
 		}
+		
+		if (version < MODULE_INTERFACE_VERSION) {
+			LOG(LOG_PRIORITY::WARN, "Module '" + name + "' was built against the older module interface version " + boost::lexical_cast<std::string>(version) + ", newer features are disabled for it.");
+		}
+		
+		module = fact(os);
+		if (module == nullptr) {
+			LOG(LOG_PRIORITY::FLOW, "Failed calling the module's factory.");
+			return MODULE_STATUS::START_ERROR;
+		}
+		ModuleInterface::SetInterfaceVersion(module, version);
+		
+		return MODULE_STATUS::LOADED;
+	}
+}
+
+/**
+* \brief A module being loaded on a worker thread.
+*/
+struct ModuleManager::PendingLoad {
+	PendingLoad(const std::string &name) : name(name), writeTime(0), library(NULL), module(nullptr), status(MODULE_STATUS::LOADING) { }
+	
+	/// Starts the worker, which logs to the log of the calling thread.
+	void Start(OSInterfaceSPTR os) {
+		this->worker = boost::thread(boost::bind(&PendingLoad::Run, this, os, EventLogger::GetEventLogger()));
+	}
+	
+	void Run(OSInterfaceSPTR os, EventLogger* log) {
+		EventLogger::ThreadBinding log_binding(log);
+		this->status = OpenModule(this->name, this->location, os, this->library, this->module);
+	}
+	
+	/// Waits for the worker, then throws away what it loaded along with the copy of the library it loaded from.
+	void Discard() {
+		if (this->worker.joinable()) {
+			this->worker.join();
+		}
+		
+		DeleteModule(this->module);
+		this->module = nullptr;
+		if (this->library != NULL) {
+			CloseLibrary(this->library);
+			this->library = NULL;
+		}
+		
+		boost::system::error_code error;
+		boost::filesystem::remove(this->location, error);
+	}
+	
+	std::string name;
+	std::string location; ///< Where the library is loaded from.
+	std::time_t writeTime; ///< Write time of the library, when loading a copy.
+	boost::thread worker;
+	
+	// Written by the worker, only read once it has been joined.
+	DLLHANDLE library;
+	ModuleInterface* module;
+	MODULE_STATUS::TYPE status;
+};
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+// Class methods in the order they are defined within the class header
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**
+* \param os The OS interface handed to each module's factory, and used to locate the module libraries.
+*/
+ModuleManager::ModuleManager(OSInterfaceSPTR os) : hotReload(false), updateOrderDirty(false), frameBudget(0.0), frameTime(0.0), smoothedFrameTime(0.0), framesSinceGoverned(0), lastMetricsLog(boost::chrono::steady_clock::now()), os(os), engine(nullptr) {
+	for (unsigned int priority = 0; priority < UPDATE_PRIORITY::COUNT; ++priority) {
+		this->updateInterval[priority] = 1;
+	}
+}
+
+ModuleManager::~ModuleManager() {
+	// Don't leave workers running against a destroyed manager.
+	for (auto it = this->pending.begin(); it != this->pending.end(); ++it) {
+		(*it)->worker.join();
+	}
+	for (auto it = this->reloads.begin(); it != this->reloads.end(); ++it) {
+		(*it)->worker.join();
+	}
+}
+
+/**
+* \param name The filename of the dynamic library to load.
+* \return LOADED if the modules is loaded otherwise LOAD_ERROR/START_ERROR on error..
+*/
+MODULE_STATUS::TYPE ModuleManager::Load(const std::string &name) {
+	if (name == "") {
+		LOG(LOG_PRIORITY::CONFIG, "Can't load a library with no name.");
+		return MODULE_STATUS::LOAD_ERROR;
+	}
+	
+	// Any background loads, including one of this same module, land first.
+	this->FinishLoading();
+	
+	DLLHANDLE library = NULL;
+	if (this->libraries.find(name) != this->libraries.end()) {
+		LOG(LOG_PRIORITY::CONFIG, "Library '" + name + "' already loaded, not reloading.");
+		library = this->libraries[name];
+	}
+	
+	std::string location;
+	if (library == NULL) {
+		std::time_t write_time;
+		location = this->GetLoadLocation(name, write_time);
+		if (location.empty()) {
+			return MODULE_STATUS::LOAD_ERROR;
+		}
 	}
+	
+	ModuleInterface* module = nullptr;
+	MODULE_STATUS::TYPE status = OpenModule(name, location, this->os, library, module);
+	
+	if (library == NULL) {
+		this->libraries.erase(name); // Closed due to error.
+		this->ForgetLibrary(name);
+	}
+	this->Attach(name, library, module);
+	
+	return status;
+}
 
-	return MODULE_STATUS::LOADED;
+/**
+* \param name The filename of the dynamic library to load.
+* \return LOADING if the load was started, otherwise as Load.
+*/
+MODULE_STATUS::TYPE ModuleManager::LoadAsync(const std::string &name) {
+	if (name == "") {
+		LOG(LOG_PRIORITY::CONFIG, "Can't load a library with no name.");
+		return MODULE_STATUS::LOAD_ERROR;
+	}
+	
+	for (auto it = this->pending.begin(); it != this->pending.end(); ++it) {
+		if ((*it)->name == name) {
+			LOG(LOG_PRIORITY::CONFIG, "Library '" + name + "' is already being loaded.");
+			return MODULE_STATUS::LOADING;
+		}
+	}
+	
+	// With the library already open only the factory is left to call, which isn't worth a thread.
+	if (this->libraries.find(name) != this->libraries.end()) {
+		return this->Load(name);
+	}
+	
+	boost::shared_ptr<PendingLoad> load(new PendingLoad(name));
+	load->location = this->GetLoadLocation(name, load->writeTime);
+	if (load->location.empty()) {
+		return MODULE_STATUS::LOAD_ERROR;
+	}
+	load->Start(this->os);
+	this->pending.push_back(load);
+	
+	return MODULE_STATUS::LOADING;
+}
+
+void ModuleManager::FinishLoading() {
+	// *NOTE: Swapped out first so that nothing below can see a half finished list.
+	std::vector<boost::shared_ptr<PendingLoad> > loads;
+	loads.swap(this->pending);
+	
+	for (auto it = loads.begin(); it != loads.end(); ++it) {
+		(*it)->worker.join();
+		
+		if ((*it)->status == MODULE_STATUS::LOADED) {
+			LOG(LOG_PRIORITY::FLOW, "Finished loading module '" + (*it)->name + "' in the background.");
+		}
+		else {
+			LOG(LOG_PRIORITY::RESTART, "Background loading of module '" + (*it)->name + "' failed.");
+		}
+		
+		if ((*it)->library == NULL) {
+			this->ForgetLibrary((*it)->name);
+		}
+		this->Attach((*it)->name, (*it)->library, (*it)->module);
+	}
+}
+
+/**
+* \param name The name to list the module under.
+* \param module The module.  The ModuleManager takes ownership, deleting it on Unload or Shutdown.
+* \return False if the module was null or the name is already in use, in which case ownership stays with the caller.
+*/
+bool ModuleManager::AddModule(const std::string &name, ModuleInterface* module) {
+	if (module == nullptr || this->modules.find(name) != this->modules.end()) {
+		LOG(LOG_PRIORITY::CONFIG, "Unable to add module '" + name + "'.");
+		return false;
+	}
+	
+	this->Attach(name, NULL, module);
+	
+	return true;
+}
+
+/**
+* \param name The name of the module.
+* \param library The module's library, or null if it failed to open.
+* \param module The module, or null if it failed to start.
+*/
+void ModuleManager::Attach(const std::string &name, DLLHANDLE library, ModuleInterface* module) {
+	if (library != NULL) {
+		this->libraries[name] = library;
+	}
+	
+	if (module != nullptr) {
+		if (this->engine != nullptr) {
+			asIScriptEngine* as_engine = this->engine->GetasIScriptEngine();
+			asUINT before = CountScriptInterface(as_engine);
+			
+			module->Register(as_engine);
+			
+			if (CountScriptInterface(as_engine) != before) {
+				this->scriptedModules.insert(name);
+			}
+		}
+		this->modules[name] = module;
+		
+		ModuleTiming& timing = this->timings[name];
+		if (!timing.configured && ModuleInterface::GetInterfaceVersion(module) >= 2) {
+			timing.priority = module->GetUpdatePriority();
+			timing.budget = module->GetUpdateBudget() / 1000.0;
+		}
+		this->updateOrderDirty = true;
+	}
 }
 
 /**
 * \param name The filename of the module/library to check.
-* \return LOADED if the modules is loaded otherwise EXISTS if a library exists by that name else NOT_FOUND.
+* \return LOADED if the modules is loaded, LOADING if it is being loaded in the background, otherwise EXISTS if a library exists by that name else NOT_FOUND.
 */
 MODULE_STATUS::TYPE ModuleManager::GetStatus( const std::string &name ) {
 	// Check if already loaded.
 	if (this->libraries.find(name) != this->libraries.end()) {
 		return MODULE_STATUS::LOADED;
 	}
-
-	std::string libFileName = name;
-
-	// Attempt to load the library
-#ifdef _WIN32
-	libFileName += ".dll";
-	HMODULE libdll = LoadLibrary(libFileName.c_str());
-#else
-	libFileName += ".so";
-	void * libdll = dlopen(libFileName.c_str(), RTLD_LAZY);
-#endif
-
-	// If it loaded, unload it and return success.
-	if (libdll != NULL) {
-#ifdef _WIN32
-		FreeLibrary(libdll);
-#else
-		dlclose(libdll);
-#endif
+	
+	for (auto it = this->pending.begin(); it != this->pending.end(); ++it) {
+		if ((*it)->name == name) {
+			return MODULE_STATUS::LOADING;
+		}
+	}
+	
+	// Only look for the file: opening the library just to close it again would run all of its static initialization.
+	boost::system::error_code error;
+	if (boost::filesystem::is_regular_file(GetLibraryLocation(this->os, name), error)) {
 		return MODULE_STATUS::EXISTS;
 	}
-
-	// Failed to load so return failure.
+	
 	return MODULE_STATUS::NOT_FOUND;
 }
 
@@ -172,18 +455,31 @@ void ModuleManager::Unload( std::string name) {
 		LOG(LOG_PRIORITY::CONFIG, "Can't unload a library with no name.");
 		return;
 	}
-	if (this->libraries.find(name) != this->libraries.end()) { // Lib WAS found
-		if (this->modules.find(name) != this->modules.end()) { // Mod WAS found
-			delete this->modules[name];
-			this->modules.erase(name);
+	
+	this->FinishLoading();
+	
+	// A rebuild still being loaded would have nothing left to replace.
+	for (auto it = this->reloads.begin(); it != this->reloads.end(); ) {
+		if ((*it)->name == name) {
+			(*it)->Discard();
+			it = this->reloads.erase(it);
 		}
-
-#ifdef _WIN32
-		if (FreeLibrary(this->libraries[name]) != 0) {
-#else
-		if (dlclose(this->libraries[name])) {
-#endif
+		else {
+			++it;
+		}
+	}
+	
+	if (this->modules.find(name) != this->modules.end()) { // Mod WAS found
+		DeleteModule(this->modules[name]);
+		this->modules.erase(name);
+		this->timings.erase(name);
+		this->updateOrderDirty = true;
+	}
+	this->scriptedModules.erase(name);
+	if (this->libraries.find(name) != this->libraries.end()) { // Lib WAS found
+		if (CloseLibrary(this->libraries[name])) {
 			this->libraries.erase(name);
+			this->ForgetLibrary(name);
 		}
 		else {
 			LOG(LOG_PRIORITY::RESTART, "Unable to unload the library '" + name + "'!");
@@ -191,32 +487,178 @@ void ModuleManager::Unload( std::string name) {
 	}
 }
 
+/**
+* \param enable Whether to watch for rebuilt libraries.
+*/
+void ModuleManager::SetHotReload(bool enable) {
+	if (enable && !this->libraries.empty()) {
+		LOG(LOG_PRIORITY::CONFIG, "Hot reloading only applies to modules loaded after it is turned on.");
+	}
+	
+	this->hotReload = enable;
+}
+
 /**
 * \param dt The amount of time that has passed since the last call to update.
 */
 void ModuleManager::Update( double dt /*= 0.0f*/ ) {
-	for (auto it = this->modules.begin(); it != this->modules.end(); ++it) {
-		if (it->second != nullptr) {
-			it->second->Update(dt);
+	if (this->hotReload) {
+		// Between frames is the one time no module is running, so the only safe time to swap one.
+		this->SwapReloadedModules();
+		this->CheckForRebuilds();
+	}
+	
+	if (this->updateOrderDirty) {
+		this->updateOrder.clear();
+		for (unsigned int priority = 0; priority < UPDATE_PRIORITY::COUNT; ++priority) {
+			for (auto it = this->modules.begin(); it != this->modules.end(); ++it) {
+				ModuleTiming& timing = this->timings[it->first];
+				if (it->second != nullptr && timing.priority == priority) {
+					timing.name = it->first;
+					timing.module = it->second;
+					this->updateOrder.push_back(&timing);
+				}
+			}
+		}
+		this->updateOrderDirty = false;
+	}
+	
+	double frame_time = 0.0;
+	
+	for (auto it = this->updateOrder.begin(); it != this->updateOrder.end(); ++it) {
+		ModuleTiming& timing = **it;
+		
+		timing.pendingDt += dt;
+		++timing.framesSinceUpdate;
+		
+		bool due = (timing.framesSinceUpdate >= this->updateInterval[timing.priority]);
+		
+		// Once the frame is over budget, low priority modules wait for the next one, within the same limit the governor has.
+		if (due && timing.priority == UPDATE_PRIORITY::LOW && this->frameBudget > 0.0 && frame_time > this->frameBudget && timing.framesSinceUpdate < MAX_UPDATE_INTERVAL) {
+			due = false;
+		}
+		
+		if (!due) {
+			++timing.skipped;
+			continue;
 		}
+		
+		boost::chrono::steady_clock::time_point start = boost::chrono::steady_clock::now();
+		timing.module->Update(timing.pendingDt);
+		double elapsed = boost::chrono::duration<double>(boost::chrono::steady_clock::now() - start).count();
+		
+		timing.pendingDt = 0.0;
+		timing.framesSinceUpdate = 0;
+		
+		timing.lastTime = elapsed;
+		timing.averageTime = (timing.updates == 0) ? elapsed : timing.averageTime + (elapsed - timing.averageTime) * TIME_SMOOTHING;
+		if (elapsed > timing.maxTime) {
+			timing.maxTime = elapsed;
+		}
+		++timing.updates;
+		
+		if (timing.budget > 0.0 && elapsed > timing.budget) {
+			// Logging every time would only make a slow frame slower.
+			if (timing.overBudget % 100 == 0) {
+				LOG(LOG_PRIORITY::WARN, "Module '" + timing.name + "' took " + FormatMilliseconds(elapsed) + " to update, over its budget of " + FormatMilliseconds(timing.budget) + ".  Over budget " + boost::lexical_cast<std::string>(timing.overBudget + 1) + " times so far.");
+			}
+			++timing.overBudget;
+		}
+		
+		frame_time += elapsed;
 	}
+	
+	this->frameTime = frame_time;
+	
+	this->Govern(frame_time);
+	this->LogMetrics();
+}
+
+/**
+* \param budget Milliseconds, or 0 for no budget.
+*/
+void ModuleManager::SetFrameBudget(double budget) {
+	this->frameBudget = (budget > 0.0) ? budget / 1000.0 : 0.0;
+	
+	if (this->frameBudget == 0.0) {
+		for (unsigned int priority = 0; priority < UPDATE_PRIORITY::COUNT; ++priority) {
+			this->updateInterval[priority] = 1;
+		}
+	}
+}
+
+/**
+* \param name The name of the module, which needn't be loaded yet.
+* \param priority How readily the module's updates may be skipped.
+* \param budget Milliseconds an update is expected to take at most, or 0 for no limit.
+*/
+void ModuleManager::SetModuleBudget(const std::string &name, UPDATE_PRIORITY::TYPE priority, double budget) {
+	if (priority < 0 || priority >= UPDATE_PRIORITY::COUNT) {
+		LOG(LOG_PRIORITY::CONFIG, "Invalid update priority for module '" + name + "'.");
+		return;
+	}
+	
+	ModuleTiming& timing = this->timings[name];
+	timing.configured = true;
+	timing.priority = priority;
+	timing.budget = (budget > 0.0) ? budget / 1000.0 : 0.0;
+	
+	this->updateOrderDirty = true;
+}
+
+double ModuleManager::GetFrameTime() const {
+	return this->frameTime * 1000.0;
+}
+
+double ModuleManager::GetModuleAverageTime(const std::string &name) const {
+	auto timing = this->timings.find(name);
+	return (timing != this->timings.end()) ? timing->second.averageTime * 1000.0 : 0.0;
+}
+
+double ModuleManager::GetModuleLastTime(const std::string &name) const {
+	auto timing = this->timings.find(name);
+	return (timing != this->timings.end()) ? timing->second.lastTime * 1000.0 : 0.0;
+}
+
+double ModuleManager::GetModuleMaxTime(const std::string &name) const {
+	auto timing = this->timings.find(name);
+	return (timing != this->timings.end()) ? timing->second.maxTime * 1000.0 : 0.0;
+}
+
+unsigned int ModuleManager::GetModuleUpdateInterval(const std::string &name) const {
+	auto timing = this->timings.find(name);
+	return (timing != this->timings.end()) ? this->updateInterval[timing->second.priority] : 1;
+}
+
+unsigned int ModuleManager::GetModuleSkippedUpdates(const std::string &name) const {
+	auto timing = this->timings.find(name);
+	return (timing != this->timings.end()) ? timing->second.skipped : 0;
 }
 
 void ModuleManager::Shutdown() {
+	this->FinishLoading();
+	
+	for (auto it = this->reloads.begin(); it != this->reloads.end(); ++it) {
+		(*it)->Discard();
+	}
+	this->reloads.clear();
+	
 	for (auto itr = this->modules.begin(); itr != this->modules.end(); ++itr) {
 		LOG(LOG_PRIORITY::INFO, "Deleting module '" + itr->first + "'!");
-		delete itr->second;
+		DeleteModule(itr->second);
 	}
 
 	for (auto itr = this->libraries.begin(); itr != this->libraries.end(); ++itr) {
 		LOG(LOG_PRIORITY::INFO, "Unloading library '" + itr->first + "'!");
-#ifdef _WIN32
-		if (FreeLibrary(this->libraries[itr->first]) != 0) {
-#else
-		if (dlclose(this->libraries[itr->first])) {
-#endif
-		}
+		CloseLibrary(itr->second);
+		this->ForgetLibrary(itr->first);
 	}
+	
+	this->modules.clear();
+	this->libraries.clear();
+	this->scriptedModules.clear();
+	this->timings.clear();
+	this->updateOrder.clear();
 }
 
 void ModuleManager::RegisterScriptEngine(ScriptEngine* const engine) {
@@ -232,12 +674,265 @@ void ModuleManager::RegisterScriptEngine(ScriptEngine* const engine) {
 	ret = as_engine->RegisterEnumValue("MODULE_STATUS", "LOAD_ERROR",  ::MODULE_STATUS::LOAD_ERROR); assert(ret >= 0);
 	ret = as_engine->RegisterEnumValue("MODULE_STATUS", "START_ERROR", ::MODULE_STATUS::START_ERROR); assert(ret >= 0);
 	ret = as_engine->RegisterEnumValue("MODULE_STATUS", "LOADED",      ::MODULE_STATUS::LOADED); assert(ret >= 0);
+	ret = as_engine->RegisterEnumValue("MODULE_STATUS", "LOADING",     ::MODULE_STATUS::LOADING); assert(ret >= 0);
+	
+	ret = as_engine->RegisterEnum("UPDATE_PRIORITY"); assert(ret >= 0);
+	ret = as_engine->RegisterEnumValue("UPDATE_PRIORITY", "CRITICAL", ::UPDATE_PRIORITY::CRITICAL); assert(ret >= 0);
+	ret = as_engine->RegisterEnumValue("UPDATE_PRIORITY", "HIGH",     ::UPDATE_PRIORITY::HIGH); assert(ret >= 0);
+	ret = as_engine->RegisterEnumValue("UPDATE_PRIORITY", "NORMAL",   ::UPDATE_PRIORITY::NORMAL); assert(ret >= 0);
+	ret = as_engine->RegisterEnumValue("UPDATE_PRIORITY", "LOW",      ::UPDATE_PRIORITY::LOW); assert(ret >= 0);
 	
 	ret = as_engine->RegisterObjectType("modldr", 0, asOBJ_REF | asOBJ_NOHANDLE);
 	ret = as_engine->RegisterGlobalProperty("modldr ModuleLoader", this);
 	ret = as_engine->RegisterObjectMethod("modldr", "MODULE_STATUS LoadModule(const string &in)", asMETHOD(ModuleManager, Load), asCALL_THISCALL); assert(ret >= 0);
+	ret = as_engine->RegisterObjectMethod("modldr", "MODULE_STATUS LoadModuleAsync(const string &in)", asMETHOD(ModuleManager, LoadAsync), asCALL_THISCALL); assert(ret >= 0);
+	ret = as_engine->RegisterObjectMethod("modldr", "void FinishLoadingModules()", asMETHOD(ModuleManager, FinishLoading), asCALL_THISCALL); assert(ret >= 0);
 	ret = as_engine->RegisterObjectMethod("modldr", "MODULE_STATUS GetModuleStatus(const string &in)", asMETHOD(ModuleManager, GetStatus), asCALL_THISCALL); assert(ret >= 0);
+	ret = as_engine->RegisterObjectMethod("modldr", "void SetHotReload(bool)", asMETHOD(ModuleManager, SetHotReload), asCALL_THISCALL); assert(ret >= 0);
+	ret = as_engine->RegisterObjectMethod("modldr", "void SetFrameBudget(double)", asMETHOD(ModuleManager, SetFrameBudget), asCALL_THISCALL); assert(ret >= 0);
+	ret = as_engine->RegisterObjectMethod("modldr", "void SetModuleBudget(const string &in, UPDATE_PRIORITY, double)", asMETHOD(ModuleManager, SetModuleBudget), asCALL_THISCALL); assert(ret >= 0);
 	
 	// Clean up after myself
 	ret = as_engine->SetDefaultNamespace(""); assert(ret >= 0);
 }
+
+void ModuleManager::RegisterMetricsScriptEngine(ScriptEngine* const engine) {
+	asIScriptEngine* as_engine = engine->GetasIScriptEngine();
+	int ret = 0;
+	
+	ret = as_engine->SetDefaultNamespace("Engine"); assert(ret >= 0);
+	
+	// Times are in milliseconds.
+	ret = as_engine->RegisterObjectType("ModuleMetrics", 0, asOBJ_REF | asOBJ_NOHANDLE); assert(ret >= 0);
+	ret = as_engine->RegisterGlobalProperty("ModuleMetrics gModuleMetrics", this); assert(ret >= 0);
+	ret = as_engine->RegisterObjectMethod("ModuleMetrics", "double GetFrameTime() const", asMETHOD(ModuleManager, GetFrameTime), asCALL_THISCALL); assert(ret >= 0);
+	ret = as_engine->RegisterObjectMethod("ModuleMetrics", "double GetAverageTime(const string &in) const", asMETHOD(ModuleManager, GetModuleAverageTime), asCALL_THISCALL); assert(ret >= 0);
+	ret = as_engine->RegisterObjectMethod("ModuleMetrics", "double GetLastTime(const string &in) const", asMETHOD(ModuleManager, GetModuleLastTime), asCALL_THISCALL); assert(ret >= 0);
+	ret = as_engine->RegisterObjectMethod("ModuleMetrics", "double GetMaxTime(const string &in) const", asMETHOD(ModuleManager, GetModuleMaxTime), asCALL_THISCALL); assert(ret >= 0);
+	ret = as_engine->RegisterObjectMethod("ModuleMetrics", "uint GetUpdateInterval(const string &in) const", asMETHOD(ModuleManager, GetModuleUpdateInterval), asCALL_THISCALL); assert(ret >= 0);
+	ret = as_engine->RegisterObjectMethod("ModuleMetrics", "uint GetSkippedUpdates(const string &in) const", asMETHOD(ModuleManager, GetModuleSkippedUpdates), asCALL_THISCALL); assert(ret >= 0);
+	
+	ret = as_engine->SetDefaultNamespace(""); assert(ret >= 0);
+}
+
+/**
+* \param frame_time Seconds all module updates took this frame.
+*/
+void ModuleManager::Govern(double frame_time) {
+	if (this->frameBudget <= 0.0) {
+		return;
+	}
+	
+	this->smoothedFrameTime += (frame_time - this->smoothedFrameTime) * TIME_SMOOTHING;
+	++this->framesSinceGoverned;
+	
+	if (this->smoothedFrameTime > this->frameBudget) {
+		if (this->framesSinceGoverned < GOVERNOR_SETTLE_FRAMES) {
+			return;
+		}
+		
+		// Update the lowest priority that has modules and can still be slowed less often.  Critical modules never are.
+		for (int priority = UPDATE_PRIORITY::LOW; priority > UPDATE_PRIORITY::CRITICAL; --priority) {
+			bool in_use = false;
+			for (auto it = this->updateOrder.begin(); it != this->updateOrder.end() && !in_use; ++it) {
+				in_use = ((*it)->priority == priority);
+			}
+			
+			if (in_use && this->updateInterval[priority] < MAX_UPDATE_INTERVAL) {
+				this->updateInterval[priority] *= 2;
+				this->framesSinceGoverned = 0;
+				
+				LOG(LOG_PRIORITY::INFO, "Module updates are taking " + FormatMilliseconds(this->smoothedFrameTime) + " of a " + FormatMilliseconds(this->frameBudget) + " budget, updating " + PRIORITY_NAMES[priority] + " priority modules every " + boost::lexical_cast<std::string>(this->updateInterval[priority]) + " frames.");
+				return;
+			}
+		}
+	}
+	else if (this->smoothedFrameTime < this->frameBudget / 2.0) {
+		if (this->framesSinceGoverned < GOVERNOR_RELAX_FRAMES) {
+			return;
+		}
+		
+		// Undo the slowing down in reverse, highest priority first.
+		for (int priority = UPDATE_PRIORITY::HIGH; priority < UPDATE_PRIORITY::COUNT; ++priority) {
+			if (this->updateInterval[priority] > 1) {
+				this->updateInterval[priority] /= 2;
+				this->framesSinceGoverned = 0;
+				
+				LOG(LOG_PRIORITY::INFO, "Module updates are taking " + FormatMilliseconds(this->smoothedFrameTime) + " of a " + FormatMilliseconds(this->frameBudget) + " budget, updating " + PRIORITY_NAMES[priority] + " priority modules every " + boost::lexical_cast<std::string>(this->updateInterval[priority]) + " frames.");
+				return;
+			}
+		}
+	}
+	else {
+		this->framesSinceGoverned = 0; // Only relax after a run of frames well under budget.
+	}
+}
+
+void ModuleManager::LogMetrics() {
+	boost::chrono::steady_clock::time_point now = boost::chrono::steady_clock::now();
+	if (now - this->lastMetricsLog < METRICS_LOG_PERIOD) {
+		return;
+	}
+	this->lastMetricsLog = now;
+	
+	for (auto it = this->updateOrder.begin(); it != this->updateOrder.end(); ++it) {
+		const ModuleTiming& timing = **it;
+		
+		LOG(LOG_PRIORITY::INFO, "Module '" + timing.name + "' (" + PRIORITY_NAMES[timing.priority] + " priority): average " + FormatMilliseconds(timing.averageTime) + ", slowest " + FormatMilliseconds(timing.maxTime)
+			+ ", updated every " + boost::lexical_cast<std::string>(this->updateInterval[timing.priority]) + " frames, " + boost::lexical_cast<std::string>(timing.skipped) + " updates skipped, "
+			+ boost::lexical_cast<std::string>(timing.overBudget) + " over budget.");
+	}
+}
+
+/**
+* \param name The name of the module.
+* \param[out] write_time The write time of the library that was copied, left alone if not copying.
+*/
+std::string ModuleManager::GetLoadLocation(const std::string &name, std::time_t &write_time) {
+	std::string location = GetLibraryLocation(this->os, name);
+	
+	if (!this->hotReload) {
+		return location;
+	}
+	
+	// Loading a copy means the original can be rebuilt while loaded, and that a rebuild is seen as a new library by the OS.
+	boost::system::error_code error;
+	write_time = boost::filesystem::last_write_time(location, error);
+	std::string copy = error ? "" : CopyLibrary(name, location);
+	
+	if (!copy.empty()) {
+		this->ForgetLibrary(name);
+		this->libraryCopies[name] = copy;
+		this->libraryTimes[name] = write_time;
+	}
+	else if (error) {
+		LOG(LOG_PRIORITY::RESTART, "Unable to find library '" + name + "' for hot reloading: " + error.message());
+	}
+	
+	return copy;
+}
+
+/**
+* \param name The name of the module.
+*/
+void ModuleManager::ForgetLibrary(const std::string &name) {
+	auto copy = this->libraryCopies.find(name);
+	if (copy != this->libraryCopies.end()) {
+		boost::system::error_code error;
+		boost::filesystem::remove(copy->second, error);
+		this->libraryCopies.erase(copy);
+	}
+	
+	this->libraryTimes.erase(name);
+	this->rebuiltTimes.erase(name);
+}
+
+void ModuleManager::CheckForRebuilds() {
+	// Checking once a second is plenty, and sees a library that is still being written before it is loaded.
+	boost::chrono::steady_clock::time_point now = boost::chrono::steady_clock::now();
+	if (now - this->lastRebuildCheck < boost::chrono::seconds(1)) {
+		return;
+	}
+	this->lastRebuildCheck = now;
+	
+	for (auto it = this->libraryTimes.begin(); it != this->libraryTimes.end(); ++it) {
+		const std::string& name = it->first;
+		
+		if (this->modules.find(name) == this->modules.end() || this->scriptedModules.count(name) != 0) {
+			continue;
+		}
+		
+		bool reloading = false;
+		for (auto reload = this->reloads.begin(); reload != this->reloads.end() && !reloading; ++reload) {
+			reloading = ((*reload)->name == name);
+		}
+		if (reloading) {
+			continue;
+		}
+		
+		boost::system::error_code error;
+		std::time_t write_time = boost::filesystem::last_write_time(GetLibraryLocation(this->os, name), error);
+		if (error || write_time == it->second) {
+			continue; // Missing while being rebuilt, or unchanged.
+		}
+		
+		auto rebuilt = this->rebuiltTimes.find(name);
+		if (rebuilt == this->rebuiltTimes.end() || rebuilt->second != write_time) {
+			this->rebuiltTimes[name] = write_time; // Wait for it to settle.
+			continue;
+		}
+		this->rebuiltTimes.erase(rebuilt);
+		
+		LOG(LOG_PRIORITY::INFO, "Library '" + name + "' was rebuilt, reloading it.");
+		
+		// *NOTE: Not GetLoadLocation, as the old copy stays in use until the swap.
+		std::string copy = CopyLibrary(name, GetLibraryLocation(this->os, name));
+		if (copy.empty()) {
+			continue;
+		}
+		
+		boost::shared_ptr<PendingLoad> load(new PendingLoad(name));
+		load->location = copy;
+		load->writeTime = write_time;
+		load->Start(this->os);
+		this->reloads.push_back(load);
+	}
+}
+
+void ModuleManager::SwapReloadedModules() {
+	for (auto it = this->reloads.begin(); it != this->reloads.end(); ) {
+		boost::shared_ptr<PendingLoad> load = *it;
+		
+		if (!load->worker.timed_join(boost::posix_time::milliseconds(0))) {
+			++it;
+			continue;
+		}
+		it = this->reloads.erase(it);
+		
+		// Unload discards the reloads of the modules it unloads, but the module must still be there to be swapped.
+		auto module_it = this->modules.find(load->name);
+		auto library_it = this->libraries.find(load->name);
+		if (module_it == this->modules.end() || library_it == this->libraries.end()) {
+			load->Discard();
+			continue;
+		}
+		
+		EnvelopeSPTR state(new Envelope());
+		ModuleInterface* old_module = module_it->second;
+		
+		// *NOTE: Both builds must have SaveState and RestoreState, which came with version 2 of the interface.
+		bool reloadable = ModuleInterface::GetInterfaceVersion(old_module) >= 2 && (load->module == nullptr || ModuleInterface::GetInterfaceVersion(load->module) >= 2);
+		
+		if (load->status != MODULE_STATUS::LOADED || !reloadable || !old_module->SaveState(state)) {
+			if (load->status == MODULE_STATUS::LOADED) {
+				LOG(LOG_PRIORITY::WARN, "Module '" + load->name + "' doesn't support hot reloading, keeping the old build.");
+			}
+			else {
+				LOG(LOG_PRIORITY::RESTART, "Reloading module '" + load->name + "' failed, keeping the old build.");
+			}
+			
+			load->Discard();
+			
+			// Don't try again until it is rebuilt again.
+			this->libraryTimes[load->name] = load->writeTime;
+			continue;
+		}
+		
+		// The old module takes its components with it, so it must go before its library and before the new module restores them.
+		DeleteModule(old_module);
+		load->module->RestoreState(state);
+		module_it->second = load->module;
+		this->timings[load->name].module = load->module;
+		
+		if (!CloseLibrary(library_it->second)) {
+			LOG(LOG_PRIORITY::WARN, "Unable to unload the old build of library '" + load->name + "'.");
+		}
+		this->ForgetLibrary(load->name);
+		
+		library_it->second = load->library;
+		this->libraryCopies[load->name] = load->location;
+		this->libraryTimes[load->name] = load->writeTime;
+		
+		LOG(LOG_PRIORITY::INFO, "Reloaded module '" + load->name + "'.");
+	}
+}
@@ -7,18 +7,23 @@
 #pragma once
 
 // System Library Includes
+#include <ctime>
 #include <string>
 #include <map>
+#include <set>
+#include <vector>
 
 // Application Library Includes
+#include <boost/chrono.hpp>
+#include <boost/shared_ptr.hpp>
 
 // Local Includes
 #include "OSInterface_fwd.h"
+#include "ModuleInterface.h"
 
 // Forward Declarations
 class EventLogger;
 class ScriptEngine;
-class ModuleInterface;
 
 // Typedefs
 typedef ModuleInterface* (*ModuleInstanceFactory)(OSInterfaceSPTR); /**< Used to find the address of the create system function. */
@@ -41,6 +46,7 @@ namespace MODULE_STATUS {
 		LOAD_ERROR, /**< Error loading the library. */
 		START_ERROR, /**< Error starting the module. */
 		LOADED, /**< Library loaded and module started. */
+		LOADING, /**< Library is being loaded in the background, see ModuleManager::LoadAsync. */
 	};
 }
 
@@ -54,15 +60,35 @@ namespace MODULE_STATUS {
 class ModuleManager {
 public:
 	/**
-	* \param engine A pointer to an instance of our script engine.
+	* \param os The OS interface handed to each module's factory, and used to locate the module libraries.
 	*/
-	ModuleManager() { }
+	ModuleManager(OSInterfaceSPTR os);
+
+	~ModuleManager();
 
 	/**
 	* \brief Loads a module.
 	*/
 	MODULE_STATUS::TYPE Load(const std::string &);
 	
+	/**
+	* \brief Starts loading a module on a worker thread, returning LOADING right away.
+	* \details The library is opened and the module constructed on the worker.  The module is registered with the script
+	* engine on the calling thread by FinishLoading, so several modules load in parallel but register in the order asked for.
+	* Module factories must therefore not depend on other modules having been constructed first.
+	*/
+	MODULE_STATUS::TYPE LoadAsync(const std::string &);
+	
+	/**
+	* \brief Waits for all background loads, then registers their modules in the order they were asked for.
+	*/
+	void FinishLoading();
+	
+	/**
+	* \brief Adds an already constructed module that has no library of its own, such as one linked into the executable.
+	*/
+	bool AddModule(const std::string &, ModuleInterface*);
+	
 	/**
 	* \brief Checks the status or existence a module/library.
 	*/
@@ -74,10 +100,42 @@ public:
 	void Unload(std::string);
 
 	/**
-	* \brief Calls the update method for all loaded modules.
+	* \brief Turns on hot reloading: the libraries of loaded modules are watched, and rebuilt ones swapped in during Update.
+	* \details Must be called before any modules are loaded, as libraries are then loaded from copies in the temporary
+	* folder, leaving the originals free to be rebuilt.  See ModuleInterface::SaveState for what a module must support.
+	*/
+	void SetHotReload(bool);
+	
+	/**
+	* \brief Calls the update method for all loaded modules, first swapping in any that have been reloaded.
+	* \details Modules are updated in priority order and timed.  With a frame budget set, low priority modules are updated
+	* less often while the module updates run over it, each then getting the time since its last update as dt.
 	*/
 	void Update(double = 0.0f);
 	
+	/**
+	* \brief Sets the milliseconds all module updates together should take each frame, or 0 to always update every module.
+	*/
+	void SetFrameBudget(double);
+	
+	/**
+	* \brief Overrides the priority and budget, in milliseconds, that a module declares for itself.
+	*/
+	void SetModuleBudget(const std::string &, UPDATE_PRIORITY::TYPE, double);
+	
+	/// Milliseconds all module updates took in the last frame.
+	double GetFrameTime() const;
+	/// Milliseconds the module's updates take, averaged over recent updates.
+	double GetModuleAverageTime(const std::string &) const;
+	/// Milliseconds the module's last update took.
+	double GetModuleLastTime(const std::string &) const;
+	/// Milliseconds the module's slowest update took.
+	double GetModuleMaxTime(const std::string &) const;
+	/// Every how many frames the module is being updated.
+	unsigned int GetModuleUpdateInterval(const std::string &) const;
+	/// How many frames the module has not been updated in.
+	unsigned int GetModuleSkippedUpdates(const std::string &) const;
+	
 	/**
 	* \brief Used to control when unloading of all modules occurs.
 	*/
@@ -87,9 +145,97 @@ public:
 	* \brief Angelscript register for ModuleManager. Only registered for the config phase.
 	*/
 	void RegisterScriptEngine(ScriptEngine* const engine);
+	
+	/**
+	* \brief Angelscript register for the update metrics, for the game play phase.
+	*/
+	void RegisterMetricsScriptEngine(ScriptEngine* const engine);
 private:
+	struct PendingLoad;
+	
+	/**
+	* \brief Update timing and scheduling of one module.
+	*/
+	struct ModuleTiming {
+		ModuleTiming() : module(nullptr), configured(false), priority(UPDATE_PRIORITY::NORMAL), budget(0.0), pendingDt(0.0), framesSinceUpdate(0), lastTime(0.0), averageTime(0.0), maxTime(0.0), updates(0), skipped(0), overBudget(0) { }
+		
+		std::string name;
+		ModuleInterface* module;
+		bool configured; ///< Whether priority and budget were set by SetModuleBudget rather than by the module.
+		UPDATE_PRIORITY::TYPE priority;
+		double budget; ///< Seconds, or 0 for none.
+		
+		double pendingDt; ///< Time since the module was last updated.
+		unsigned int framesSinceUpdate;
+		
+		// Seconds
+		double lastTime;
+		double averageTime;
+		double maxTime;
+		
+		unsigned int updates;
+		unsigned int skipped;
+		unsigned int overBudget;
+	};
+	
+	/**
+	* \brief Adjusts how often each priority is updated, given how long the module updates took this frame.
+	*/
+	void Govern(double);
+	
+	/**
+	* \brief Writes the update metrics of each module to the log, every so often.
+	*/
+	void LogMetrics();
+	
+	/**
+	* \brief Stores a loaded library and module, registering the module with the script engine.
+	*/
+	void Attach(const std::string &, DLLHANDLE, ModuleInterface*);
+	
+	/**
+	* \brief Gets the path to load a library from: with hot reloading on, a fresh copy of the library.
+	* \return The path, or empty if the library couldn't be copied.
+	*/
+	std::string GetLoadLocation(const std::string &, std::time_t &);
+	
+	/**
+	* \brief Removes the copy of a library that is no longer loaded, along with its hot reload tracking.
+	*/
+	void ForgetLibrary(const std::string &);
+	
+	/**
+	* \brief Starts reloading any library that has been rebuilt and not changed since the last check.
+	*/
+	void CheckForRebuilds();
+	
+	/**
+	* \brief Swaps in the modules that have finished reloading, handing over the state of the old ones.
+	*/
+	void SwapReloadedModules();
+	
 	std::map<std::string, ModuleInterface*> modules; /**< A mapping of each module to its filename. */
 	std::map<std::string, DLLHANDLE> libraries; /**< A mapping of each loaded library to a its filename */
+	std::vector<boost::shared_ptr<PendingLoad> > pending; /**< Background loads not yet attached, in the order they were asked for. */
+	
+	bool hotReload; /**< Whether to watch the libraries for rebuilds. */
+	boost::chrono::steady_clock::time_point lastRebuildCheck; /**< When the libraries were last checked for rebuilds. */
+	std::map<std::string, std::string> libraryCopies; /**< The copy each library was loaded from, by module name. */
+	std::map<std::string, std::time_t> libraryTimes; /**< Write time of each library when it was copied, by module name. */
+	std::map<std::string, std::time_t> rebuiltTimes; /**< Write time of rebuilt libraries, which are reloaded once it stops changing. */
+	std::set<std::string> scriptedModules; /**< Modules that registered a script interface, and so can't be reloaded. */
+	std::vector<boost::shared_ptr<PendingLoad> > reloads; /**< New builds of loaded modules, swapped in once ready. */
+	
+	std::map<std::string, ModuleTiming> timings; /**< Update timing of each module, by name. */
+	std::vector<ModuleTiming*> updateOrder; /**< Loaded modules by priority, then name.  Rebuilt when modules come or go. */
+	bool updateOrderDirty;
+	double frameBudget; /**< Seconds, or 0 for no budget. */
+	double frameTime; /**< Seconds all module updates took in the last frame. */
+	double smoothedFrameTime; /**< Seconds, averaged over recent frames. */
+	unsigned int updateInterval[UPDATE_PRIORITY::COUNT]; /**< Every how many frames each priority is updated. */
+	unsigned int framesSinceGoverned; /**< Frames since the intervals were last changed. */
+	boost::chrono::steady_clock::time_point lastMetricsLog;
 
+	OSInterfaceSPTR os; /**< The OS of the owning engine instance. */
 	ScriptEngine* engine; /**< Pointer to the current script engine instance. Used during module loading. */
 };
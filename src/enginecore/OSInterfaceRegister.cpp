@@ -0,0 +1,52 @@
+/**
+* \file
+* \author agent
+* \date 2026-10-19
+* \brief OSInterface registration function
+*
+*/
+
+// System Library Includes
+#include <cassert>
+
+// Application Library Includes
+
+// Local Includes
+#include "../sharedbase/OSInterface.h"
+#include "ScriptEngine.h"
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+// The actual registration function
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**
+* \param[in] engine A pointer to the script engine instance.
+*/
+void OSInterface::RegisterScriptEngine(ScriptEngine* const engine) {
+	asIScriptEngine* const as_engine = engine->GetasIScriptEngine();
+	assert(as_engine != nullptr);
+	
+	int ret = 0;
+	
+	// Register Enum
+	ret = as_engine->SetDefaultNamespace("Engine"); assert(ret >= 0);
+	
+	ret = as_engine->RegisterEnum("SYSTEM_DIRS"); assert(ret >= 0);
+	ret = as_engine->RegisterEnumValue("SYSTEM_DIRS", "USER",       ::SYSTEM_DIRS::USER); assert(ret >= 0);
+	ret = as_engine->RegisterEnumValue("SYSTEM_DIRS", "DOCUMENTS",  ::SYSTEM_DIRS::DOCUMENTS); assert(ret >= 0);
+	ret = as_engine->RegisterEnumValue("SYSTEM_DIRS", "PICTURES",   ::SYSTEM_DIRS::PICTURES); assert(ret >= 0);
+	ret = as_engine->RegisterEnumValue("SYSTEM_DIRS", "MUSIC",      ::SYSTEM_DIRS::MUSIC); assert(ret >= 0);
+	ret = as_engine->RegisterEnumValue("SYSTEM_DIRS", "VIDEO",      ::SYSTEM_DIRS::VIDEO); assert(ret >= 0);
+	ret = as_engine->RegisterEnumValue("SYSTEM_DIRS", "DESKTOP",    ::SYSTEM_DIRS::DESKTOP); assert(ret >= 0);
+	ret = as_engine->RegisterEnumValue("SYSTEM_DIRS", "EXECUTABLE", ::SYSTEM_DIRS::EXECUTABLE); assert(ret >= 0);
+	
+	ret = as_engine->SetDefaultNamespace(""); assert(ret >= 0);
+	
+	// Register the OS object
+	ret = as_engine->RegisterObjectType("OSInterface", 0, asOBJ_REF | asOBJ_NOHANDLE); assert(ret >= 0);
+	ret = as_engine->RegisterGlobalProperty("OSInterface OS", this); assert(ret >= 0);
+	ret = as_engine->RegisterObjectMethod("OSInterface", "string GetPath(SYSTEM_DIRS)",       asMETHOD(OSInterface, GetPath),     asCALL_THISCALL); assert(ret >= 0);
+	ret = as_engine->RegisterObjectMethod("OSInterface", "void ShowInfo(string, string)",     asMETHOD(OSInterface, ShowInfo),    asCALL_THISCALL); assert(ret >= 0);
+	ret = as_engine->RegisterObjectMethod("OSInterface", "void ShowWarning(string, string)",  asMETHOD(OSInterface, ShowWarning), asCALL_THISCALL); assert(ret >= 0);
+	ret = as_engine->RegisterObjectMethod("OSInterface", "void ShowError(string, string)",    asMETHOD(OSInterface, ShowError),   asCALL_THISCALL); assert(ret >= 0);
+	ret = as_engine->RegisterObjectMethod("OSInterface", "bool IsHeadless()",                 asMETHOD(OSInterface, IsHeadless),  asCALL_THISCALL); assert(ret >= 0);
+}
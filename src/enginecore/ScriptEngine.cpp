@@ -17,9 +17,14 @@
 #include <angelscript/scriptarray.h>
 #include <angelscript/scriptdictionary.h>
 #include <angelscript/scriptstdstring.h>
+#ifdef NLS_ENGINE_AS_JIT
+#include <as_jit.h>
+#endif
 
 // Local Includes
 #include "../sharedbase/EventLogger.h"
+#include "ScriptProfiler.h"
+#include "ScriptScheduler.h"
 
 // Static class member initialization
 
@@ -50,7 +55,10 @@ Target stringCast(const std::string& src) {
 	}
 }
 
-ScriptEngine::ScriptEngine() : engine(nullptr), isRunning(true) {
+/**
+* \param[in] useJIT Whether to compile scripts to native code as they are built, if the JIT was built in.
+*/
+ScriptEngine::ScriptEngine(bool useJIT) : engine(nullptr), isRunning(true), tickRate(0.0), scriptTimeout(0.0) {
 	int ret = 0;
 
 	// Create the script engine
@@ -64,13 +72,24 @@ ScriptEngine::ScriptEngine() : engine(nullptr), isRunning(true) {
 	// Set the message callback to receive information on errors in human readable form.
 	ret = this->engine->SetMessageCallback(asMETHOD(ScriptEngine, MessageCallback), this, asCALL_THISCALL); assert(ret >=0);
 
+#ifdef NLS_ENGINE_AS_JIT
+	if (useJIT) {
+		// The JIT needs the compiler to mark the places where it may enter the bytecode of each function.
+		ret = this->engine->SetEngineProperty(asEP_INCLUDE_JIT_INSTRUCTIONS, true); assert(ret >= 0);
+
+		this->jitCompiler.reset(new asCJITCompiler(0));
+		ret = this->engine->SetJITCompiler(this->jitCompiler.get()); assert(ret >= 0);
+	}
+#endif
+
 	// Create our context we will use for enginecore
 	asIScriptContext* ctx = this->engine->CreateContext(); assert( ctx != nullptr );
 
 	// Set the exception callback to receive information on errors in human readable form.
 	ret = ctx->SetExceptionCallback(asMETHOD(ScriptEngine, ExceptionCallback), this, asCALL_THISCALL); assert(ret >=0);
 
-	this->scriptexec.SetContext(ctx);
+	this->scriptexec.SetContext(ctx, this);
+	this->scheduler.reset(new ScriptScheduler(this));
 	this->builder.StartNewModule(this->engine, "enginecore");
 
 	// Script add-ons
@@ -92,7 +111,22 @@ ScriptEngine::ScriptEngine() : engine(nullptr), isRunning(true) {
 	ret = engine->RegisterGlobalProperty("ScriptEngine Engine", this); assert(ret >= 0);
 	ret = engine->RegisterObjectMethod("ScriptEngine", "void Shutdown()", asMETHOD(ScriptEngine, Shutdown), asCALL_THISCALL); assert(ret >= 0);
 	ret = engine->RegisterObjectMethod("ScriptEngine", "void SetUserDataFolder(const string &in)", asMETHOD(ScriptEngine, SetUserDataFolder), asCALL_THISCALL); assert(ret >= 0);
+	ret = engine->RegisterObjectMethod("ScriptEngine", "void SetLogFile(const string &in)", asMETHOD(ScriptEngine, SetLogFile), asCALL_THISCALL); assert(ret >= 0);
 	ret = engine->RegisterObjectMethod("ScriptEngine", "void SetGameScript(const string &in)", asMETHOD(ScriptEngine, SetGameScript), asCALL_THISCALL); assert(ret >= 0);
+	ret = engine->RegisterObjectMethod("ScriptEngine", "void SetTickRate(double)", asMETHOD(ScriptEngine, SetTickRate), asCALL_THISCALL); assert(ret >= 0);
+	ret = engine->RegisterObjectMethod("ScriptEngine", "double GetTickRate()", asMETHOD(ScriptEngine, GetTickRate), asCALL_THISCALL); assert(ret >= 0);
+	ret = engine->RegisterObjectMethod("ScriptEngine", "void SetScriptTimeout(double)", asMETHOD(ScriptEngine, SetScriptTimeout), asCALL_THISCALL); assert(ret >= 0);
+	ret = engine->RegisterObjectMethod("ScriptEngine", "double GetScriptTimeout()", asMETHOD(ScriptEngine, GetScriptTimeout), asCALL_THISCALL); assert(ret >= 0);
+	ret = engine->RegisterObjectMethod("ScriptEngine", "void StartProfiler(const string &in, double = 0.001)", asMETHOD(ScriptEngine, StartProfiler), asCALL_THISCALL); assert(ret >= 0);
+	ret = engine->RegisterObjectMethod("ScriptEngine", "void StopProfiler()", asMETHOD(ScriptEngine, StopProfiler), asCALL_THISCALL); assert(ret >= 0);
+	ret = engine->RegisterFuncdef("void Coroutine()"); assert(ret >= 0);
+	ret = engine->RegisterObjectMethod("ScriptEngine", "uint StartCoroutine(Coroutine@)", asMETHOD(ScriptEngine, StartCoroutine), asCALL_THISCALL); assert(ret >= 0);
+	ret = engine->RegisterObjectMethod("ScriptEngine", "bool StopCoroutine(uint)", asMETHOD(ScriptEngine, StopCoroutine), asCALL_THISCALL); assert(ret >= 0);
+	ret = engine->RegisterObjectMethod("ScriptEngine", "void Yield()", asMETHOD(ScriptEngine, Yield), asCALL_THISCALL); assert(ret >= 0);
+	ret = engine->RegisterObjectMethod("ScriptEngine", "void Wait(double)", asMETHOD(ScriptEngine, Wait), asCALL_THISCALL); assert(ret >= 0);
+	ret = engine->RegisterObjectMethod("ScriptEngine", "uint GetCoroutineCount()", asMETHOD(ScriptEngine, GetCoroutineCount), asCALL_THISCALL); assert(ret >= 0);
+	ret = engine->RegisterObjectMethod("ScriptEngine", "void SetCoroutineBudget(double)", asMETHOD(ScriptEngine, SetCoroutineBudget), asCALL_THISCALL); assert(ret >= 0);
+	ret = engine->RegisterObjectMethod("ScriptEngine", "double GetCoroutineBudget()", asMETHOD(ScriptEngine, GetCoroutineBudget), asCALL_THISCALL); assert(ret >= 0);
 
 	ret = this->engine->SetDefaultNamespace("Engine"); assert(ret >= 0);
 
@@ -109,6 +143,12 @@ ScriptEngine::ScriptEngine() : engine(nullptr), isRunning(true) {
 }
 
 ScriptEngine::~ScriptEngine() {
+	// Write out anything profiled, as the scripts may never have stopped the profiler.
+	this->StopProfiler();
+
+	// The coroutines' contexts must go before the engine.
+	this->scheduler.reset();
+
 	if (this->engine != nullptr) {
 		if (this->engine->Release() <= 0) {
 			this->engine = nullptr;
@@ -185,7 +225,7 @@ ScriptExecutor* ScriptEngine::ScriptExecutorFactory() {
 		// Set the exception callback to receive information on errors in human readable form.
 		int ret = ctx->SetExceptionCallback(asMETHOD(ScriptEngine, ExceptionCallback), this, asCALL_THISCALL); assert(ret >=0);
 
-		exec->SetContext(ctx);
+		exec->SetContext(ctx, this);
 
 		return exec;
 	}
@@ -264,6 +304,117 @@ void ScriptEngine::SetLogFile( const std::string &filename ) {
 	EventLogger::GetEventLogger()->SetLogFile(this->userDataFolder + filename);
 }
 
+/**
+* \param[in] seconds How long each call into scripts may run before it is aborted.  0 or less is no limit.
+*/
+void ScriptEngine::SetScriptTimeout(double seconds) {
+	this->scriptTimeout = (seconds > 0.0) ? seconds : 0.0;
+}
+
+/**
+* \return The seconds each call into scripts may run, or 0 if unlimited.
+*/
+double ScriptEngine::GetScriptTimeout() {
+	return this->scriptTimeout;
+}
+
+/**
+* \param[in] filename The file in the user data folder to write the folded stacks to once stopped.
+* \param[in] interval Seconds between samples.
+*
+* A profiler already running is stopped first, writing out what it found.
+*/
+void ScriptEngine::StartProfiler(const std::string &filename, double interval) {
+	this->StopProfiler();
+
+	this->profiler.reset(new ScriptProfiler((interval > 0.0) ? interval : 0.001));
+	this->profilerFile = this->userDataFolder + filename;
+}
+
+void ScriptEngine::StopProfiler() {
+	if (!this->profiler) {
+		return;
+	}
+
+	if (this->profiler->SaveFoldedStacks(this->profilerFile)) {
+		LOG(LOG_PRIORITY::INFO, "Script profile written to '" + this->profilerFile + "'.");
+	}
+	else {
+		LOG(LOG_PRIORITY::ERR, "Unable to write the script profile to '" + this->profilerFile + "'.");
+	}
+
+	// Any executor still sampling holds on to the profiler until it finishes.
+	this->profiler.reset();
+}
+
+/**
+* \return The running profiler, or an empty pointer if it is stopped.
+*/
+boost::shared_ptr<ScriptProfiler> ScriptEngine::GetProfiler() {
+	return this->profiler;
+}
+
+/**
+* \param[in] func The function to run as a coroutine.  The handle's reference is released.
+* \return The ID of the coroutine, or 0 if it couldn't be started.
+*/
+unsigned int ScriptEngine::StartCoroutine(asIScriptFunction* func) {
+	unsigned int id = this->scheduler->Start(func);
+
+	if (func != nullptr) {
+		func->Release();
+	}
+
+	return id;
+}
+
+/**
+* \param[in] id The ID given by StartCoroutine.
+* \return False if the coroutine had already finished.
+*/
+bool ScriptEngine::StopCoroutine(unsigned int id) {
+	return this->scheduler->Stop(id);
+}
+
+void ScriptEngine::Yield() {
+	this->scheduler->Suspend(0.0);
+}
+
+/**
+* \param[in] seconds How long to wait, in seconds of game time.
+*/
+void ScriptEngine::Wait(double seconds) {
+	this->scheduler->Suspend(seconds);
+}
+
+/**
+* \return The number of coroutines started and not yet finished or stopped.
+*/
+unsigned int ScriptEngine::GetCoroutineCount() {
+	return this->scheduler->GetCount();
+}
+
+/**
+* \param[in] seconds How long each update may spend resuming coroutines.  0 or less is no limit.
+*/
+void ScriptEngine::SetCoroutineBudget(double seconds) {
+	this->scheduler->SetBudget(seconds);
+}
+
+/**
+* \return The seconds each update may spend resuming coroutines, or 0 if unlimited.
+*/
+double ScriptEngine::GetCoroutineBudget() {
+	return this->scheduler->GetBudget();
+}
+
+/**
+* \param[in] elapsed Seconds of game time since the last update.
+*/
+void ScriptEngine::UpdateCoroutines(double elapsed) {
+	this->scheduler->Update(elapsed);
+}
+
 /**
 * \return True if the engine is running.
 */
@@ -289,6 +440,20 @@ const std::string ScriptEngine::GetGameScript() {
 	return this->userDataFolder + this->gameplayScript;
 }
 
+/**
+* \param[in] rate Updates per second.  0 or less returns to a variable rate.
+*/
+void ScriptEngine::SetTickRate(double rate) {
+	this->tickRate = (rate > 0.0) ? rate : 0.0;
+}
+
+/**
+* \return The fixed updates per second, or 0 when running at a variable rate.
+*/
+double ScriptEngine::GetTickRate() {
+	return this->tickRate;
+}
+
 /**
 */
 void ScriptEngine::AbortExecution() {
@@ -12,11 +12,15 @@
 // Application Library Includes
 #include <angelscript.h>
 #include <angelscript/scriptbuilder.h>
+#include <boost/scoped_ptr.hpp>
+#include <boost/shared_ptr.hpp>
 
 // Local Includes
 #include "ScriptExecutor.h"
 
 // Forward Declarations
+class ScriptProfiler;
+class ScriptScheduler;
 
 // Typedefs
 
@@ -51,8 +55,11 @@ public: // Structors
 	* Additionally it registers some basic add-ons provide by Angelscript for strings,
 	* arrays, math functions, any type, and dictionary data type. Lastly a default executor
 	* is made with a context, and a default module "enginecore".
+	* \param[in] useJIT Whether to compile scripts to native code as they are built.  Only takes
+	* effect when the engine was built with the NLS_ENGINE_AS_JIT option; otherwise scripts are
+	* always run by the bytecode interpreter.
 	*/
-	ScriptEngine();
+	explicit ScriptEngine(bool useJIT = true);
 	~ScriptEngine();
 
 public: // API Methods
@@ -92,7 +99,8 @@ public: // API Methods
 	void SetUserDataFolder(const std::string &);
 
 	/**
-	* \brief Called by script to set the log file used by EventLogger.
+	* \brief Called by script to set the log file used by EventLogger, in the user data folder.
+	* \details Sets the file of the logger bound to the calling thread, so an engine with a private log gives it a file of its own.
 	*/
 	void SetLogFile(const std::string &);
 
@@ -106,6 +114,81 @@ public: // API Methods
 	*/
 	const std::string GetGameScript();
 
+	/**
+	* \brief Called by script to run the engine at a fixed number of updates per second.  0 updates as fast as the OS allows.
+	*/
+	void SetTickRate(double);
+
+	/**
+	* \brief Gets the fixed number of updates per second, or 0 if not running at a fixed rate.
+	*/
+	double GetTickRate();
+
+	/**
+	* \brief Called by script to limit how many seconds each call from the engine into scripts may run.  0 is no limit.
+	*/
+	void SetScriptTimeout(double);
+
+	/**
+	* \brief Gets the seconds each call from the engine into scripts may run, or 0 if unlimited.
+	*/
+	double GetScriptTimeout();
+
+	/**
+	* \brief Called by script to start sampling where scripts spend their time, for writing to the given file in the user data folder.
+	*/
+	void StartProfiler(const std::string &, double);
+
+	/**
+	* \brief Called by script to stop the profiler and write what it found.
+	*/
+	void StopProfiler();
+
+	/**
+	* \brief Gets the running profiler, or an empty pointer if it is stopped.
+	*/
+	boost::shared_ptr<ScriptProfiler> GetProfiler();
+
+	/**
+	* \brief Called by script to start a coroutine, running from the next update until it returns.
+	*/
+	unsigned int StartCoroutine(asIScriptFunction*);
+
+	/**
+	* \brief Called by script to stop a coroutine where it is.
+	*/
+	bool StopCoroutine(unsigned int);
+
+	/**
+	* \brief Called by a script coroutine to carry on from the next update.
+	*/
+	void Yield();
+
+	/**
+	* \brief Called by a script coroutine to carry on once the given number of seconds have passed.
+	*/
+	void Wait(double);
+
+	/**
+	* \brief Gets the number of coroutines not yet finished.
+	*/
+	unsigned int GetCoroutineCount();
+
+	/**
+	* \brief Called by script to limit how many seconds each update may spend resuming coroutines.  0 is no limit.
+	*/
+	void SetCoroutineBudget(double);
+
+	/**
+	* \brief Gets the seconds each update may spend resuming coroutines, or 0 if unlimited.
+	*/
+	double GetCoroutineBudget();
+
+	/**
+	* \brief Resumes the coroutines that are due, given the seconds since the last update.
+	*/
+	void UpdateCoroutines(double);
+
 	/**
 	* \brief Returns if the engine is still running.
 	*/
@@ -137,9 +220,15 @@ private: // Internal methods
 private: // Data
 	bool isRunning; ///< Running flag.
 	asIScriptEngine *engine; ///< The script engine.
+	boost::scoped_ptr<asIJITCompiler> jitCompiler; ///< Compiles scripts to native code, if in use.  Declared before scriptexec so that it outlives the engine, which hands back its compiled functions as it is destroyed.
 	ScriptExecutor scriptexec; ///< The script executor.
 	CScriptBuilder builder; ///< Used for building scripts from files.
 
 	std::string userDataFolder; ///< Location where user data is stored such as saves or profiles.
 	std::string gameplayScript; ///< The gameplay phase script.
+	double tickRate; ///< Fixed updates per second, or 0 for a variable rate.
+	double scriptTimeout; ///< Seconds each call into scripts may run, or 0 for no limit.
+	boost::shared_ptr<ScriptProfiler> profiler; ///< The running profiler, if any.
+	std::string profilerFile; ///< Where the running profiler is to write to.
+	boost::scoped_ptr<ScriptScheduler> scheduler; ///< Runs the script coroutines.
 };
@@ -15,13 +15,32 @@
 // Application Library Includes
 #include <angelscript.h>
 #include <cassert>
+#include <boost/chrono.hpp>
+#include <boost/lexical_cast.hpp>
 
 // Local Includes
+#include "../sharedbase/EventLogger.h"
+#include "ScriptEngine.h"
+#include "ScriptProfiler.h"
 
 // Forward Declarations
 
 // Typedefs
 
+// Local Functions
+namespace {
+	/// Lines run between reading the clock when only enforcing a time limit, which needn't be exact.
+	const unsigned int TIMEOUT_CHECK_LINES = 1000;
+
+	/// Seconds of the steady clock.
+	double Now() {
+		return boost::chrono::duration<double>(boost::chrono::steady_clock::now().time_since_epoch()).count();
+	}
+}
+
+ScriptExecutor::ScriptExecutor( void ) : ctx(nullptr), scriptEngine(nullptr), limited(false), deadline(0.0), nextSample(0.0), lastSample(0.0), checkInterval(1), linesUntilCheck(1) {
+}
+
 ScriptExecutor::~ScriptExecutor( void ) {
 	if (this->ctx != nullptr) {
 		if (this->ctx->Release() <= 0) {
@@ -99,10 +118,40 @@ int ScriptExecutor::SetFunctionParam(int argIndex, unsigned int param) {
 }
 
 /**
-* \return Negative number on failure.
+* \return Negative number on failure, otherwise the context's execution state: asEXECUTION_ABORTED if it ran out of time.
 */
 int ScriptExecutor::ExecuteFunction() {
-	return this->ctx->Execute();
+	return this->ExecuteFunction((this->scriptEngine != nullptr) ? this->scriptEngine->GetScriptTimeout() : 0.0);
+}
+
+/**
+* \param[in] timeout Seconds the function may run before being aborted, or 0 for no limit.
+* \return Negative number on failure, otherwise the context's execution state: asEXECUTION_ABORTED if it ran out of time.
+*/
+int ScriptExecutor::ExecuteFunction(double timeout) {
+	this->profiler = (this->scriptEngine != nullptr) ? this->scriptEngine->GetProfiler() : boost::shared_ptr<ScriptProfiler>();
+	this->limited = (timeout > 0.0);
+
+	if (!this->limited && !this->profiler) {
+		return this->ctx->Execute();
+	}
+
+	double now = Now();
+	this->deadline = now + timeout;
+	this->lastSample = now;
+	this->nextSample = this->profiler ? now + this->profiler->GetInterval() : 0.0;
+
+	// The profiler needs to look at every line to sample on time, while the time limit can wait.
+	this->checkInterval = this->profiler ? 1 : TIMEOUT_CHECK_LINES;
+	this->linesUntilCheck = this->checkInterval;
+
+	int ret = this->ctx->SetLineCallback(asMETHOD(ScriptExecutor, LineCallback), this, asCALL_THISCALL); assert(ret >= 0);
+	ret = this->ctx->Execute();
+	this->ctx->ClearLineCallback();
+
+	this->profiler.reset();
+
+	return ret;
 }
 
 /**
@@ -114,8 +163,46 @@ float ScriptExecutor::GetReturnFloat() {
 
 /**
 * \param[in] ctx The script context.
+* \param[in] engine The engine the context was created from, or nullptr to run without its time limit and profiler.
 */
-void ScriptExecutor::SetContext( asIScriptContext* ctx ) {
+void ScriptExecutor::SetContext( asIScriptContext* ctx, ScriptEngine* engine ) {
 	assert(ctx != nullptr);
 	this->ctx = ctx;
+	this->scriptEngine = engine;
+}
+
+/**
+* \return The script context.  No refCount increase/decrease happens/needs to happen.
+*/
+asIScriptContext* ScriptExecutor::GetContext() {
+	return this->ctx;
+}
+
+/**
+* \param[in] ctx The executing context.
+*/
+void ScriptExecutor::LineCallback(asIScriptContext* ctx) {
+	if (--this->linesUntilCheck > 0) {
+		return;
+	}
+	this->linesUntilCheck = this->checkInterval;
+
+	double now = Now();
+
+	if (this->profiler && now >= this->nextSample) {
+		this->profiler->Sample(ctx, now - this->lastSample);
+		this->lastSample = now;
+		this->nextSample = now + this->profiler->GetInterval();
+	}
+
+	if (this->limited && now >= this->deadline) {
+		this->limited = false; // Only the once, should the script take a few more lines to stop.
+
+		asIScriptFunction* func = ctx->GetFunction();
+		const char* section = nullptr;
+		int line = ctx->GetLineNumber(0, nullptr, &section);
+		LOG(LOG_PRIORITY::WARN, "Script ran past its time limit and was aborted, in " + std::string(section != nullptr ? section : "?") + "(" + boost::lexical_cast<std::string>(line) + "):" + std::string(func != nullptr ? func->GetDeclaration() : "?"));
+
+		ctx->Abort();
+	}
 }
@@ -10,22 +10,28 @@
 #include <string>
 
 // Application Library Includes
+#include <boost/shared_ptr.hpp>
 
 // Local Includes
 
 // Forward Declarations
 class asIScriptContext;
 class asIScriptFunction;
+class ScriptEngine;
+class ScriptProfiler;
 
 // Typedefs
 
 /**
 * \brief A script context wrapper.
-* \details Wraps a script context with several script building and executing functions
+* \details Wraps a script context with several script building and executing functions.
+* While a function executes the executor can watch it from the context's line callback: to abort it once it has run
+* past a time limit, and to sample it for the ScriptEngine's profiler.  When neither is wanted no line callback is set,
+* so that the script runs at full speed.
 */
 class ScriptExecutor {
 public:
-	ScriptExecutor(void) { };
+	ScriptExecutor(void);
 	~ScriptExecutor(void);
 
 	/**
@@ -59,19 +65,44 @@ public:
 	int SetFunctionParam(int argIndex, unsigned int param);
 
 	/**
-	* \brief Executes the function.
+	* \brief Executes the function, with the time limit of the ScriptEngine the executor came from.
 	*/
 	int ExecuteFunction();
 	
+	/**
+	* \brief Executes the function, aborting it if it runs for longer than the given number of seconds.  0 is no limit.
+	*/
+	int ExecuteFunction(double);
+	
 	/**
 	* \brief Gets the return value from the executed function.
 	*/
 	float GetReturnFloat();
 	
 	/**
-	* \brief Sets the script context.
+	* \brief Sets the script context, and the ScriptEngine whose time limit and profiler apply to it.
+	*/
+	void SetContext(asIScriptContext*, ScriptEngine* = nullptr);
+	
+	/**
+	* \brief Gets the script context, for suspending or aborting the function from outside.
 	*/
-	void SetContext(asIScriptContext*);
+	asIScriptContext* GetContext();
 private:
+	/**
+	* \brief Enforces the time limit and samples for the profiler, called by the context before each line.
+	*/
+	void LineCallback(asIScriptContext*);
+	
 	asIScriptContext *ctx; /**< The script context */
+	ScriptEngine* scriptEngine; /**< The engine the context belongs to, if any. */
+	
+	// The state of the execution being watched by LineCallback.
+	boost::shared_ptr<ScriptProfiler> profiler; /**< Held for the whole execution, in case the script stops the profiler. */
+	bool limited; /**< Whether there is a deadline. */
+	double deadline; /**< When to abort, in seconds of the steady clock. */
+	double nextSample; /**< When to next sample, in seconds of the steady clock. */
+	double lastSample; /**< When the last sample, or the execution, started, in seconds of the steady clock. */
+	unsigned int checkInterval; /**< How many lines to run between looking at the clock. */
+	unsigned int linesUntilCheck;
 };
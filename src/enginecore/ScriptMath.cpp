@@ -10,6 +10,7 @@
 
 // System Library Includes
 #include <cassert>
+#include <cstddef>
 
 // Application Library Includes
 #include <angelscript/scriptmath.h>
@@ -18,6 +19,7 @@
 
 // Local Includes
 #include "../sharedbase/EventLogger.h"
+#include "../sharedbase/MathArrays.h"
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 // Helper function prototypes
@@ -50,15 +52,232 @@ glm::quat SlerpCopy(const glm::quat&, const glm::quat&, const float&);
 float AngleBetween(const glm::quat&, const glm::quat&);
 glm::quat operator/(const glm::quat&, const glm::quat&);
 
+void MatrixFactory(glm::mat4*);
+void MatrixFactory(const glm::mat4&, glm::mat4*);
+void MatrixFactory(const glm::vec3&, const glm::quat&, const float&, glm::mat4*);
+glm::mat4 MatrixMultiply(const glm::mat4&, const glm::mat4&);
+glm::vec3 MatrixTransformPoint(const glm::mat4&, const glm::vec3&);
+glm::vec3 MatrixTransformDirection(const glm::mat4&, const glm::vec3&);
+glm::mat4 MatrixInverse(const glm::mat4&);
+glm::mat4 MatrixTranspose(const glm::mat4&);
+glm::vec3 MatrixGetTranslation(const glm::mat4&);
+float MatrixGet(const glm::mat4&, unsigned int, unsigned int);
+void MatrixSet(glm::mat4&, unsigned int, unsigned int, float);
+
+
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+// The binding tables
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+namespace {
+	/// Which of the engine's registration calls a binding is for.
+	enum ScriptBindingKind {
+		BINDING_BEHAVIOUR,
+		BINDING_METHOD,
+		BINDING_PROPERTY
+	};
+	
+	/**
+	* \brief One row of a binding table: the arguments to a single RegisterObjectBehaviour, RegisterObjectMethod, or RegisterObjectProperty call.
+	*/
+	struct ScriptBinding {
+		ScriptBindingKind kind;
+		asEBehaviours behaviour; /**< Only used by behaviours. */
+		const char* declaration;
+		asSFuncPtr function; /**< Not used by properties. */
+		asDWORD callConv; /**< Not used by properties. */
+		int offset; /**< Only used by properties. */
+	};
+	
+	ScriptBinding Behaviour(asEBehaviours behaviour, const char* declaration, const asSFuncPtr& function, asDWORD callConv) {
+		ScriptBinding binding = {BINDING_BEHAVIOUR, behaviour, declaration, function, callConv, 0};
+		return binding;
+	}
+	
+	ScriptBinding Method(const char* declaration, const asSFuncPtr& function, asDWORD callConv) {
+		ScriptBinding binding = {BINDING_METHOD, asBEHAVE_CONSTRUCT, declaration, function, callConv, 0};
+		return binding;
+	}
+	
+	ScriptBinding Property(const char* declaration, int offset) {
+		ScriptBinding binding = {BINDING_PROPERTY, asBEHAVE_CONSTRUCT, declaration, asSFuncPtr(0), 0, offset};
+		return binding;
+	}
+	
+	/*
+	The bindings shared by a type and its aliases are written once as a macro taking the type's name, so that the
+	compiler joins the string literals of each declaration.  Nothing is built at runtime, and the tables can be walked
+	as they are, say to document the script API.
+	*/
+	
+	// Vector3/Vector
+#define NLS_VECTOR3_BINDINGS(TYPE) \
+		/* General purpose ctors */ \
+		Behaviour(asBEHAVE_CONSTRUCT, "void f()", asFUNCTIONPR(VectorFactory, (glm::vec3*), void), asCALL_CDECL_OBJLAST), \
+		Behaviour(asBEHAVE_CONSTRUCT, "void f(const float &in, const float &in, const float &in)", asFUNCTIONPR(VectorFactory, (const float&, const float&, const float&, glm::vec3*), void), asCALL_CDECL_OBJLAST), \
+		\
+		/* Copy ctor */ \
+		Behaviour(asBEHAVE_CONSTRUCT, "void f(const " TYPE " &in)", asFUNCTIONPR(VectorFactory, (const glm::vec3&, glm::vec3*), void), asCALL_CDECL_OBJLAST), \
+		\
+		/* Properties */ \
+		Property("float x", asOFFSET(glm::vec3, x)), \
+		Property("float y", asOFFSET(glm::vec3, y)), \
+		Property("float z", asOFFSET(glm::vec3, z)), \
+		Property("float r", asOFFSET(glm::vec3, r)), \
+		Property("float g", asOFFSET(glm::vec3, g)), \
+		Property("float b", asOFFSET(glm::vec3, b)), \
+		\
+		/* Methods */ \
+		/* Note that there is no function in GLM for the square of the magnitude (aka "length") of a vector, hence the custom functions. */ \
+		Method("float MagnitudeSq() const", asFUNCTIONPR(Vec3MagSq, (const glm::vec3 &), float), asCALL_CDECL_OBJFIRST), \
+		Method("float Magnitude() const", asFUNCTIONPR(glm::length, (const glm::vec3 &), float), asCALL_CDECL_OBJFIRST), \
+		Method("float DistanceSq(const " TYPE " &in) const", asFUNCTIONPR(Vec3DistSq, (const glm::vec3 &, const glm::vec3 &), float), asCALL_CDECL_OBJFIRST), \
+		Method("float Distance(const " TYPE " &in) const", asFUNCTIONPR(glm::distance, (const glm::vec3 &, const glm::vec3 &), float), asCALL_CDECL_OBJFIRST), \
+		Method("void Normalize()", asFUNCTIONPR(Vec3Normalize, (glm::vec3 &), void), asCALL_CDECL_OBJFIRST), \
+		Method(TYPE " NormalizedCopy() const", asFUNCTIONPR(glm::normalize, (const glm::vec3 &), glm::vec3), asCALL_CDECL_OBJFIRST), \
+		Method("float Dot(const " TYPE " &in) const", asFUNCTIONPR(glm::dot, (const glm::vec3 &, const glm::vec3 &), float), asCALL_CDECL_OBJFIRST), \
+		Method("void Cross(const " TYPE " &in)", asFUNCTIONPR(Vec3Cross, (glm::vec3 &, const glm::vec3 &), void), asCALL_CDECL_OBJFIRST), \
+		Method(TYPE " CrossCopy(const " TYPE " &in) const", asFUNCTIONPR(glm::cross, (const glm::vec3 &, const glm::vec3 &), glm::vec3), asCALL_CDECL_OBJFIRST), \
+		Method("void ApplyRotation(const Rotation &in) const",   asFUNCTION(Vec3ApplyRotation), asCALL_CDECL_OBJFIRST), \
+		Method("void ApplyRotation(const Quaternion &in) const", asFUNCTION(Vec3ApplyRotation), asCALL_CDECL_OBJFIRST), \
+		Method(TYPE " ApplyRotationCopy(const Rotation &in) const",   asFUNCTION(Vec3ApplyRotationCopy), asCALL_CDECL_OBJFIRST), \
+		Method(TYPE " ApplyRotationCopy(const Quaternion &in) const", asFUNCTION(Vec3ApplyRotationCopy), asCALL_CDECL_OBJFIRST), \
+		Method("void ApplyRotationInv(const Rotation &in) const",   asFUNCTION(Vec3ApplyRotationConj), asCALL_CDECL_OBJFIRST), \
+		Method("void ApplyRotationInv(const Quaternion &in) const", asFUNCTION(Vec3ApplyRotationConj), asCALL_CDECL_OBJFIRST), \
+		Method(TYPE " ApplyRotationInvCopy(const Rotation &in) const",   asFUNCTION(Vec3ApplyRotationConjCopy), asCALL_CDECL_OBJFIRST), \
+		Method(TYPE " ApplyRotationInvCopy(const Quaternion &in) const", asFUNCTION(Vec3ApplyRotationConjCopy), asCALL_CDECL_OBJFIRST), \
+		\
+		/* Unary operators */ \
+		Method(TYPE " opNeg(const " TYPE " &in) const", asFUNCTIONPR(glm::detail::operator-, (const glm::vec3 &), glm::vec3), asCALL_CDECL_OBJFIRST), \
+		\
+		/* Binary operators */ \
+		Method(TYPE " opAdd(const " TYPE " &in) const", asFUNCTIONPR(glm::detail::operator+, (const glm::vec3 &, const glm::vec3 &), glm::vec3), asCALL_CDECL_OBJFIRST), \
+		Method(TYPE " opSub(const " TYPE " &in) const", asFUNCTIONPR(glm::detail::operator-, (const glm::vec3 &, const glm::vec3 &), glm::vec3), asCALL_CDECL_OBJFIRST), \
+		Method("float opMul(const " TYPE " &in) const", asFUNCTIONPR(glm::dot, (const glm::vec3 &, const glm::vec3 &), float), asCALL_CDECL_OBJFIRST), \
+		Method(TYPE " opMod(const " TYPE " &in) const", asFUNCTIONPR(glm::cross, (const glm::vec3 &, const glm::vec3 &), glm::vec3), asCALL_CDECL_OBJFIRST), \
+		Method(TYPE " opMul(const Rotation &in) const",   asFUNCTION(Vec3ApplyRotationCopy), asCALL_CDECL_OBJFIRST), \
+		Method(TYPE " opMul(const Quaternion &in) const", asFUNCTION(Vec3ApplyRotationCopy), asCALL_CDECL_OBJFIRST), \
+		Method(TYPE " opDiv(const Rotation &in) const",   asFUNCTION(Vec3ApplyRotationConjCopy), asCALL_CDECL_OBJFIRST), \
+		Method(TYPE " opDiv(const Quaternion &in) const", asFUNCTION(Vec3ApplyRotationConjCopy), asCALL_CDECL_OBJFIRST)
+	
+	// Having both implicit and explicit casts between the same types doesn't seem to be supported yet.  However, the implicit seems to also give explict. ~Ricky 20120528, AngelScript 2.23.1
+	const ScriptBinding VECTOR_BINDINGS[] = {
+		NLS_VECTOR3_BINDINGS("Vector"),
+		Behaviour(asBEHAVE_IMPLICIT_VALUE_CAST, "Vector3 f() const", asFUNCTIONPR(VectorCast, (const glm::vec3&), glm::vec3), asCALL_CDECL_OBJLAST),
+	};
+	
+	const ScriptBinding VECTOR3_BINDINGS[] = {
+		NLS_VECTOR3_BINDINGS("Vector3"),
+		Behaviour(asBEHAVE_IMPLICIT_VALUE_CAST, "Vector f() const", asFUNCTIONPR(VectorCast, (const glm::vec3&), glm::vec3), asCALL_CDECL_OBJLAST),
+	};
+	
+#undef NLS_VECTOR3_BINDINGS
+	
+	// Quaternion/Rotation
+#define NLS_QUATERNION_BINDINGS(TYPE) \
+		/* General purpose ctors */ \
+		Behaviour(asBEHAVE_CONSTRUCT, "void f()", asFUNCTIONPR(QuaternionFactory, (glm::quat*), void), asCALL_CDECL_OBJLAST), \
+		Behaviour(asBEHAVE_CONSTRUCT, "void f(const float &in, const float &in, const float &in, const float &in)", asFUNCTIONPR(QuaternionFactory, (const float&, const float&, const float&, const float&, glm::quat*), void), asCALL_CDECL_OBJLAST), \
+		\
+		/* Euler conversion ctors */ \
+		Behaviour(asBEHAVE_CONSTRUCT, "void f(const float &in, const float &in, const float &in)", asFUNCTIONPR(QuaternionFactory, (const float&, const float&, const float&, glm::quat*), void), asCALL_CDECL_OBJLAST), \
+		Behaviour(asBEHAVE_CONSTRUCT, "void f(const Vector &in)", asFUNCTIONPR(QuaternionFactory, (const glm::vec3&, glm::quat*), void), asCALL_CDECL_OBJLAST), \
+		\
+		/* Axis-angle conversion ctor */ \
+		Behaviour(asBEHAVE_CONSTRUCT, "void f(const Vector &in, const float &in)", asFUNCTIONPR(QuaternionFactory, (const glm::vec3&, const float&, glm::quat*), void), asCALL_CDECL_OBJLAST), \
+		\
+		/* Copy ctor */ \
+		Behaviour(asBEHAVE_CONSTRUCT, "void f(const " TYPE " &in)", asFUNCTIONPR(QuaternionFactory, (const glm::quat&, glm::quat*), void), asCALL_CDECL_OBJLAST), \
+		\
+		/* Properties */ \
+		Property("float x", asOFFSET(glm::quat, x)), \
+		Property("float y", asOFFSET(glm::quat, y)), \
+		Property("float z", asOFFSET(glm::quat, z)), \
+		Property("float s", asOFFSET(glm::quat, w)), \
+		\
+		/* Methods */ \
+		Method("Vector ToEuler() const", asFUNCTION(ToEuler), asCALL_CDECL_OBJFIRST), \
+		Method("Vector ToAxis() const", asFUNCTION(ToAxis), asCALL_CDECL_OBJFIRST), \
+		Method("float ToAngle() const", asFUNCTION(ToAngle), asCALL_CDECL_OBJFIRST), \
+		Method("void Slerp(const " TYPE " &in, const float &in) const", asFUNCTION(Slerp), asCALL_CDECL_OBJFIRST), \
+		Method(TYPE " SlerpCopy(const " TYPE " &in, const float &in) const", asFUNCTION(SlerpCopy), asCALL_CDECL_OBJFIRST), \
+		Method("float AngleTo(const " TYPE " &in) const", asFUNCTION(AngleBetween), asCALL_CDECL_OBJFIRST), \
+		\
+		/* Binary operators */ \
+		Method(TYPE " opMul(const " TYPE " &in) const", asFUNCTIONPR(glm::detail::operator*, (const glm::quat &, const glm::quat &), glm::quat), asCALL_CDECL_OBJLAST), \
+		Method(TYPE " opDiv(const " TYPE " &in) const", asFUNCTIONPR(operator/, (const glm::quat &, const glm::quat &), glm::quat), asCALL_CDECL_OBJLAST)
+	
+	const ScriptBinding ROTATION_BINDINGS[] = {
+		NLS_QUATERNION_BINDINGS("Rotation"),
+		Behaviour(asBEHAVE_IMPLICIT_VALUE_CAST, "Quaternion f() const", asFUNCTIONPR(QuaternionCast, (const glm::quat&), glm::quat), asCALL_CDECL_OBJLAST),
+	};
+	
+	const ScriptBinding QUATERNION_BINDINGS[] = {
+		NLS_QUATERNION_BINDINGS("Quaternion"),
+		Behaviour(asBEHAVE_IMPLICIT_VALUE_CAST, "Rotation   f() const", asFUNCTIONPR(QuaternionCast, (const glm::quat&), glm::quat), asCALL_CDECL_OBJLAST),
+	};
+	
+#undef NLS_QUATERNION_BINDINGS
+	
+	// Matrix: 4x4, column major, as used for the affine transforms of entities
+	const ScriptBinding MATRIX_BINDINGS[] = {
+		// Ctors
+		Behaviour(asBEHAVE_CONSTRUCT, "void f()", asFUNCTIONPR(MatrixFactory, (glm::mat4*), void), asCALL_CDECL_OBJLAST),
+		Behaviour(asBEHAVE_CONSTRUCT, "void f(const Matrix &in)", asFUNCTIONPR(MatrixFactory, (const glm::mat4&, glm::mat4*), void), asCALL_CDECL_OBJLAST),
+		Behaviour(asBEHAVE_CONSTRUCT, "void f(const Vector &in, const Rotation &in, const float &in)", asFUNCTIONPR(MatrixFactory, (const glm::vec3&, const glm::quat&, const float&, glm::mat4*), void), asCALL_CDECL_OBJLAST),
+		
+		// Methods
+		Method("float Get(uint, uint) const", asFUNCTION(MatrixGet), asCALL_CDECL_OBJFIRST),
+		Method("void Set(uint, uint, float)", asFUNCTION(MatrixSet), asCALL_CDECL_OBJFIRST),
+		Method("Vector GetTranslation() const", asFUNCTION(MatrixGetTranslation), asCALL_CDECL_OBJFIRST),
+		Method("Vector TransformPoint(const Vector &in) const", asFUNCTION(MatrixTransformPoint), asCALL_CDECL_OBJFIRST),
+		Method("Vector TransformDirection(const Vector &in) const", asFUNCTION(MatrixTransformDirection), asCALL_CDECL_OBJFIRST),
+		Method("Matrix Inverse() const", asFUNCTION(MatrixInverse), asCALL_CDECL_OBJFIRST),
+		Method("Matrix Transpose() const", asFUNCTION(MatrixTranspose), asCALL_CDECL_OBJFIRST),
+		
+		// Binary operators
+		Method("Matrix opMul(const Matrix &in) const", asFUNCTION(MatrixMultiply), asCALL_CDECL_OBJFIRST),
+		Method("Vector opMul(const Vector &in) const", asFUNCTION(MatrixTransformPoint), asCALL_CDECL_OBJFIRST),
+	};
+	
+	/**
+	* \brief A value type of the Engine namespace and the table of what it offers scripts.
+	*/
+	struct ScriptMathType {
+		const char* name;
+		int size;
+		const ScriptBinding* bindings;
+		std::size_t count;
+	};
+	
+#define NLS_MATH_TYPE(NAME, NATIVE, TABLE) {NAME, sizeof(NATIVE), TABLE, sizeof(TABLE) / sizeof(TABLE[0])}
+	
+	/*
+	*HACK: It would have been better to have been able to
+	RegisterTypedef("Vector3","Vector"), but this cannot be done due to a
+	limitation of AS: "Currently typedefs can only be registered for built-in
+	primitive types."  So instead we have multiple types that are freely
+	castable between them, and could cause havoc in the "any" type system...
+	*/
+	// *TODO: Vector2, Vector2i, Vector3i, Vector4, ColorRGB, ColorRGBA/Color
+	const ScriptMathType MATH_TYPES[] = {
+		NLS_MATH_TYPE("Vector",     glm::vec3, VECTOR_BINDINGS),
+		NLS_MATH_TYPE("Vector3",    glm::vec3, VECTOR3_BINDINGS),
+		NLS_MATH_TYPE("Rotation",   glm::quat, ROTATION_BINDINGS),
+		NLS_MATH_TYPE("Quaternion", glm::quat, QUATERNION_BINDINGS),
+		NLS_MATH_TYPE("Matrix",     glm::mat4, MATRIX_BINDINGS),
+	};
+	
+#undef NLS_MATH_TYPE
+}
 
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 // The actual registration function
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /**
-* \brief A simple function to cast a string type to a Target type
-* \param[in] src The source string.
-* \return The lexical_cast of string to Target, or a default constructed instance of Target.
+* \brief Registers the math value types, and the containers of them, to the Engine namespace.
+* \param[in] as_engine A pointer to the Angelscript engine instance.
 */
 void ScriptEngine::RegisterMathTypes(asIScriptEngine* const as_engine) {
 	int ret = 0;
@@ -70,167 +289,41 @@ void ScriptEngine::RegisterMathTypes(asIScriptEngine* const as_engine) {
 	// All these types are under the Engine namespace
 	ret = as_engine->SetDefaultNamespace("Engine"); assert(ret >= 0);
 	
-	{ // Register the types
-		/*
-		*HACK: It would have been better to have been able to
-		RegisterTypedef("Vector3","Vector"), but this cannot be done due to a
-		limitation of AS: "Currently typedefs can only be registered for built-in
-		primitive types."  So instead we have multiple types that are freely
-		castable between them, and could cause havoc in the "any" type system...
-		*/
-		
-		// *TODO: Vector2
-		
-		// *TODO: Vector2i
-		
-		// Vector3/Vector
-		ret = as_engine->RegisterObjectType("Vector",  sizeof(glm::vec3), asOBJ_VALUE | asOBJ_POD | asOBJ_APP_CLASS_CDAK); assert(ret >= 0);
-		ret = as_engine->RegisterObjectType("Vector3", sizeof(glm::vec3), asOBJ_VALUE | asOBJ_POD | asOBJ_APP_CLASS_CDAK); assert(ret >= 0);
-		
-		// *TODO: Vector3i
-		
-		// Vector4
-		
-		// Quaternion/Rotation
-		ret = as_engine->RegisterObjectType("Rotation",   sizeof(glm::quat), asOBJ_VALUE | asOBJ_POD | asOBJ_APP_CLASS_CDAK); assert(ret >= 0);
-		ret = as_engine->RegisterObjectType("Quaternion", sizeof(glm::quat), asOBJ_VALUE | asOBJ_POD | asOBJ_APP_CLASS_CDAK); assert(ret >= 0);
-		
-		// ColorRGB, ColorRGBA/Color
-		//ret = as_engine->RegisterObjectType("ColorRGB", sizeof(glm::vec3), asOBJ_VALUE | asOBJ_POD | asOBJ_APP_CLASS_CDAK); assert(ret >= 0);
-		//ret = as_engine->RegisterObjectType("ColorRGBA", sizeof(glm::vec4), asOBJ_VALUE | asOBJ_POD | asOBJ_APP_CLASS_CDAK); assert(ret >= 0);
-		//ret = as_engine->RegisterObjectType("Color",     sizeof(glm::vec4), asOBJ_VALUE | asOBJ_POD | asOBJ_APP_CLASS_CDAK); assert(ret >= 0);
+	const std::size_t type_count = sizeof(MATH_TYPES) / sizeof(MATH_TYPES[0]);
+	
+	// Register the types, all of them first as the declarations refer to each other.
+	for (std::size_t type_index = 0; type_index < type_count; ++type_index) {
+		ret = as_engine->RegisterObjectType(MATH_TYPES[type_index].name, MATH_TYPES[type_index].size, asOBJ_VALUE | asOBJ_POD | asOBJ_APP_CLASS_CDAK); assert(ret >= 0);
 	}
 	
-	{ // Register the methods and operators
-		{ // *TODO: Vector2
-		}
-		
-		{ // *TODO: Vector2i
-		}
-		
-		{ // Vector3
-			const char* list[] = {"Vector", "Vector3"};
-			for (unsigned int index = 0; index < 2; ++index) {
-				std::string type(list[index]);
-				
-				// General purpose ctors
-				ret = as_engine->RegisterObjectBehaviour(type.c_str(), asBEHAVE_CONSTRUCT, "void f()", asFUNCTIONPR(VectorFactory, (glm::vec3*), void), asCALL_CDECL_OBJLAST); assert(ret >= 0);
-				ret = as_engine->RegisterObjectBehaviour(type.c_str(), asBEHAVE_CONSTRUCT, "void f(const float &in, const float &in, const float &in)", asFUNCTIONPR(VectorFactory, (const float&, const float&, const float&, glm::vec3*), void), asCALL_CDECL_OBJLAST); assert(ret >= 0);
-				
-				// Copy ctor
-				ret = as_engine->RegisterObjectBehaviour(type.c_str(), asBEHAVE_CONSTRUCT, ("void f(const " + type + " &in)").c_str(), asFUNCTIONPR(VectorFactory, (const glm::vec3&, glm::vec3*), void), asCALL_CDECL_OBJLAST); assert(ret >= 0);
-				
-				// Casting operators
-				if (std::string(type) != "Vector") {
-					ret = as_engine->RegisterObjectBehaviour(type.c_str(), asBEHAVE_IMPLICIT_VALUE_CAST, "Vector f() const",   asFUNCTIONPR(VectorCast, (const glm::vec3&), glm::vec3), asCALL_CDECL_OBJLAST); assert(ret >= 0);
-					// Having both implicit and explicit casts between the same types doesn't seem to be supported yet.  However, the implicit seems to also give explict. ~Ricky 20120528, AngelScript 2.23.1
-				}
-				if (std::string(type) != "Vector3") {
-					ret = as_engine->RegisterObjectBehaviour(type.c_str(), asBEHAVE_IMPLICIT_VALUE_CAST, "Vector3 f() const",  asFUNCTIONPR(VectorCast, (const glm::vec3&), glm::vec3), asCALL_CDECL_OBJLAST); assert(ret >= 0);
-					// Having both implicit and explicit casts between the same types doesn't seem to be supported yet.  However, the implicit seems to also give explict. ~Ricky 20120528, AngelScript 2.23.1
-				}
-				
-				// Properties
-				ret = as_engine->RegisterObjectProperty(type.c_str(), "float x", asOFFSET(glm::vec3, x)); assert(ret >= 0);
-				ret = as_engine->RegisterObjectProperty(type.c_str(), "float y", asOFFSET(glm::vec3, y)); assert(ret >= 0);
-				ret = as_engine->RegisterObjectProperty(type.c_str(), "float z", asOFFSET(glm::vec3, z)); assert(ret >= 0);
-				ret = as_engine->RegisterObjectProperty(type.c_str(), "float r", asOFFSET(glm::vec3, r)); assert(ret >= 0);
-				ret = as_engine->RegisterObjectProperty(type.c_str(), "float g", asOFFSET(glm::vec3, g)); assert(ret >= 0);
-				ret = as_engine->RegisterObjectProperty(type.c_str(), "float b", asOFFSET(glm::vec3, b)); assert(ret >= 0);
-				
-				// Methods
-				// Note that there is no function in GLM for the square of the magnitude (aka "length") of a vector, hence the custom functions.
-				ret = as_engine->RegisterObjectMethod(type.c_str(), "float MagnitudeSq() const", asFUNCTIONPR(Vec3MagSq, (const glm::vec3 &), float), asCALL_CDECL_OBJFIRST); assert( ret >= 0 );
-				ret = as_engine->RegisterObjectMethod(type.c_str(), "float Magnitude() const", asFUNCTIONPR(glm::length, (const glm::vec3 &), float), asCALL_CDECL_OBJFIRST); assert( ret >= 0 );
-				ret = as_engine->RegisterObjectMethod(type.c_str(), ("float DistanceSq(const " + type + " &in) const").c_str(), asFUNCTIONPR(Vec3DistSq, (const glm::vec3 &, const glm::vec3 &), float), asCALL_CDECL_OBJFIRST); assert( ret >= 0 );
-				ret = as_engine->RegisterObjectMethod(type.c_str(), ("float Distance(const " + type + " &in) const").c_str(), asFUNCTIONPR(glm::distance, (const glm::vec3 &, const glm::vec3 &), float), asCALL_CDECL_OBJFIRST); assert( ret >= 0 );
-				ret = as_engine->RegisterObjectMethod(type.c_str(), "void Normalize()", asFUNCTIONPR(Vec3Normalize, (glm::vec3 &), void), asCALL_CDECL_OBJFIRST); assert( ret >= 0 );
-				ret = as_engine->RegisterObjectMethod(type.c_str(), (type + " NormalizedCopy() const").c_str(), asFUNCTIONPR(glm::normalize, (const glm::vec3 &), glm::vec3), asCALL_CDECL_OBJFIRST); assert( ret >= 0 );
-				ret = as_engine->RegisterObjectMethod(type.c_str(), ("float Dot(const " + type + " &in) const").c_str(), asFUNCTIONPR(glm::dot, (const glm::vec3 &, const glm::vec3 &), float), asCALL_CDECL_OBJFIRST); assert( ret >= 0 );
-				ret = as_engine->RegisterObjectMethod(type.c_str(), ("void Cross(const " + type + " &in)").c_str(), asFUNCTIONPR(Vec3Cross, (glm::vec3 &, const glm::vec3 &), void), asCALL_CDECL_OBJFIRST); assert( ret >= 0 );
-				ret = as_engine->RegisterObjectMethod(type.c_str(), (type + " CrossCopy(const " + type + " &in) const").c_str(), asFUNCTIONPR(glm::cross, (const glm::vec3 &, const glm::vec3 &), glm::vec3), asCALL_CDECL_OBJFIRST); assert( ret >= 0 );
-				ret = as_engine->RegisterObjectMethod(type.c_str(), "void ApplyRotation(const Rotation &in) const",   asFUNCTION(Vec3ApplyRotation), asCALL_CDECL_OBJFIRST); assert( ret >= 0 );
-				ret = as_engine->RegisterObjectMethod(type.c_str(), "void ApplyRotation(const Quaternion &in) const", asFUNCTION(Vec3ApplyRotation), asCALL_CDECL_OBJFIRST); assert( ret >= 0 );
-				ret = as_engine->RegisterObjectMethod(type.c_str(), (type + " ApplyRotationCopy(const Rotation &in) const").c_str(),   asFUNCTION(Vec3ApplyRotationCopy), asCALL_CDECL_OBJFIRST); assert( ret >= 0 );
-				ret = as_engine->RegisterObjectMethod(type.c_str(), (type + " ApplyRotationCopy(const Quaternion &in) const").c_str(), asFUNCTION(Vec3ApplyRotationCopy), asCALL_CDECL_OBJFIRST); assert( ret >= 0 );
-				ret = as_engine->RegisterObjectMethod(type.c_str(), "void ApplyRotationInv(const Rotation &in) const",   asFUNCTION(Vec3ApplyRotationConj), asCALL_CDECL_OBJFIRST); assert( ret >= 0 );
-				ret = as_engine->RegisterObjectMethod(type.c_str(), "void ApplyRotationInv(const Quaternion &in) const", asFUNCTION(Vec3ApplyRotationConj), asCALL_CDECL_OBJFIRST); assert( ret >= 0 );
-				ret = as_engine->RegisterObjectMethod(type.c_str(), (type + " ApplyRotationInvCopy(const Rotation &in) const").c_str(),   asFUNCTION(Vec3ApplyRotationConjCopy), asCALL_CDECL_OBJFIRST); assert( ret >= 0 );
-				ret = as_engine->RegisterObjectMethod(type.c_str(), (type + " ApplyRotationInvCopy(const Quaternion &in) const").c_str(), asFUNCTION(Vec3ApplyRotationConjCopy), asCALL_CDECL_OBJFIRST); assert( ret >= 0 );
-				
-				// Unary operators
-				ret = as_engine->RegisterObjectMethod(type.c_str(), (type + " opNeg(const " + type + " &in) const").c_str(), asFUNCTIONPR(glm::detail::operator-, (const glm::vec3 &), glm::vec3), asCALL_CDECL_OBJFIRST); assert( ret >= 0 );
-				
-				// Binary operators
-				ret = as_engine->RegisterObjectMethod(type.c_str(), (type + " opAdd(const " + type + " &in) const").c_str(), asFUNCTIONPR(glm::detail::operator+, (const glm::vec3 &, const glm::vec3 &), glm::vec3), asCALL_CDECL_OBJFIRST); assert( ret >= 0 );
-				ret = as_engine->RegisterObjectMethod(type.c_str(), (type + " opSub(const " + type + " &in) const").c_str(), asFUNCTIONPR(glm::detail::operator-, (const glm::vec3 &, const glm::vec3 &), glm::vec3), asCALL_CDECL_OBJFIRST); assert( ret >= 0 );
-				ret = as_engine->RegisterObjectMethod(type.c_str(), ("float opMul(const " + type + " &in) const").c_str(), asFUNCTIONPR(glm::dot, (const glm::vec3 &, const glm::vec3 &), float), asCALL_CDECL_OBJFIRST); assert( ret >= 0 );
-				ret = as_engine->RegisterObjectMethod(type.c_str(), (type + " opMod(const " + type + " &in) const").c_str(), asFUNCTIONPR(glm::cross, (const glm::vec3 &, const glm::vec3 &), glm::vec3), asCALL_CDECL_OBJFIRST); assert( ret >= 0 );
-				ret = as_engine->RegisterObjectMethod(type.c_str(), (type + " opMul(const Rotation &in) const").c_str(),   asFUNCTION(Vec3ApplyRotationCopy), asCALL_CDECL_OBJFIRST); assert( ret >= 0 );
-				ret = as_engine->RegisterObjectMethod(type.c_str(), (type + " opMul(const Quaternion &in) const").c_str(), asFUNCTION(Vec3ApplyRotationCopy), asCALL_CDECL_OBJFIRST); assert( ret >= 0 );
-				ret = as_engine->RegisterObjectMethod(type.c_str(), (type + " opDiv(const Rotation &in) const").c_str(),   asFUNCTION(Vec3ApplyRotationConjCopy), asCALL_CDECL_OBJFIRST); assert( ret >= 0 );
-				ret = as_engine->RegisterObjectMethod(type.c_str(), (type + " opDiv(const Quaternion &in) const").c_str(), asFUNCTION(Vec3ApplyRotationConjCopy), asCALL_CDECL_OBJFIRST); assert( ret >= 0 );
-			}
-		}
+	// Register the methods and operators
+	for (std::size_t type_index = 0; type_index < type_count; ++type_index) {
+		const ScriptMathType& type = MATH_TYPES[type_index];
 		
-		{ // *TODO: Vector3i
-		}
-		
-		{ // *TODO: Vector4
+		for (std::size_t index = 0; index < type.count; ++index) {
+			const ScriptBinding& binding = type.bindings[index];
 			
-		}
-		
-		{ // Quaternion
-			const char* list[] = {"Rotation", "Quaternion"};
-			for (unsigned int index = 0; index < 2; ++index) {
-				std::string type(list[index]);
-				
-				// General purpose ctors
-				ret = as_engine->RegisterObjectBehaviour(type.c_str(), asBEHAVE_CONSTRUCT, "void f()", asFUNCTIONPR(QuaternionFactory, (glm::quat*), void), asCALL_CDECL_OBJLAST); assert(ret >= 0);
-				ret = as_engine->RegisterObjectBehaviour(type.c_str(), asBEHAVE_CONSTRUCT, "void f(const float &in, const float &in, const float &in, const float &in)", asFUNCTIONPR(QuaternionFactory, (const float&, const float&, const float&, const float&, glm::quat*), void), asCALL_CDECL_OBJLAST); assert(ret >= 0);
-				
-				// Euler conversion ctors
-				ret = as_engine->RegisterObjectBehaviour(type.c_str(), asBEHAVE_CONSTRUCT, "void f(const float &in, const float &in, const float &in)", asFUNCTIONPR(QuaternionFactory, (const float&, const float&, const float&, glm::quat*), void), asCALL_CDECL_OBJLAST); assert(ret >= 0);
-				ret = as_engine->RegisterObjectBehaviour(type.c_str(), asBEHAVE_CONSTRUCT, "void f(const Vector &in)", asFUNCTIONPR(QuaternionFactory, (const glm::vec3&, glm::quat*), void), asCALL_CDECL_OBJLAST); assert(ret >= 0);
-				
-				// Axis-angle conversion ctor
-				ret = as_engine->RegisterObjectBehaviour(type.c_str(), asBEHAVE_CONSTRUCT, "void f(const Vector &in, const float &in)", asFUNCTIONPR(QuaternionFactory, (const glm::vec3&, const float&, glm::quat*), void), asCALL_CDECL_OBJLAST); assert(ret >= 0);
-				
-				// Copy ctor
-				ret = as_engine->RegisterObjectBehaviour(type.c_str(), asBEHAVE_CONSTRUCT, ("void f(const " + type + " &in)").c_str(), asFUNCTIONPR(QuaternionFactory, (const glm::quat&, glm::quat*), void), asCALL_CDECL_OBJLAST); assert(ret >= 0);
-				
-				// Casting operators
-				if (type != "Rotation") {
-					ret = as_engine->RegisterObjectBehaviour(type.c_str(), asBEHAVE_IMPLICIT_VALUE_CAST, "Rotation   f() const", asFUNCTIONPR(QuaternionCast, (const glm::quat&), glm::quat), asCALL_CDECL_OBJLAST); assert(ret >= 0);
-					// Having both implicit and explicit casts between the same types doesn't seem to be supported yet.  However, the implicit seems to also give explict. ~Ricky 20120528, AngelScript 2.23.1
+			switch (binding.kind) {
+				case BINDING_BEHAVIOUR: {
+					ret = as_engine->RegisterObjectBehaviour(type.name, binding.behaviour, binding.declaration, binding.function, binding.callConv); assert(ret >= 0);
 				}
-				if (type != "Quaternion") {
-					ret = as_engine->RegisterObjectBehaviour(type.c_str(), asBEHAVE_IMPLICIT_VALUE_CAST, "Quaternion f() const", asFUNCTIONPR(QuaternionCast, (const glm::quat&), glm::quat), asCALL_CDECL_OBJLAST); assert(ret >= 0);
-					// Having both implicit and explicit casts between the same types doesn't seem to be supported yet.  However, the implicit seems to also give explict. ~Ricky 20120528, AngelScript 2.23.1
+				break;
+				case BINDING_METHOD: {
+					ret = as_engine->RegisterObjectMethod(type.name, binding.declaration, binding.function, binding.callConv); assert(ret >= 0);
 				}
-				
-				// Properties
-				ret = as_engine->RegisterObjectProperty(type.c_str(), "float x", asOFFSET(glm::quat, x)); assert(ret >= 0);
-				ret = as_engine->RegisterObjectProperty(type.c_str(), "float y", asOFFSET(glm::quat, y)); assert(ret >= 0);
-				ret = as_engine->RegisterObjectProperty(type.c_str(), "float z", asOFFSET(glm::quat, z)); assert(ret >= 0);
-				ret = as_engine->RegisterObjectProperty(type.c_str(), "float s", asOFFSET(glm::quat, w)); assert(ret >= 0);
-				
-				// Methods
-				ret = as_engine->RegisterObjectMethod(type.c_str(), "Vector ToEuler() const", asFUNCTION(ToEuler), asCALL_CDECL_OBJFIRST); assert( ret >= 0 );
-				ret = as_engine->RegisterObjectMethod(type.c_str(), "Vector ToAxis() const", asFUNCTION(ToAxis), asCALL_CDECL_OBJFIRST); assert( ret >= 0 );
-				ret = as_engine->RegisterObjectMethod(type.c_str(), "float ToAngle() const", asFUNCTION(ToAngle), asCALL_CDECL_OBJFIRST); assert( ret >= 0 );
-				ret = as_engine->RegisterObjectMethod(type.c_str(), ("void Slerp(const " + type + " &in, const float &in) const").c_str(), asFUNCTION(Slerp), asCALL_CDECL_OBJFIRST); assert( ret >= 0 );
-				ret = as_engine->RegisterObjectMethod(type.c_str(), (type + " SlerpCopy(const " + type + " &in, const float &in) const").c_str(), asFUNCTION(SlerpCopy), asCALL_CDECL_OBJFIRST); assert( ret >= 0 );
-				ret = as_engine->RegisterObjectMethod(type.c_str(), ("float AngleTo(const " + type + " &in) const").c_str(), asFUNCTION(AngleBetween), asCALL_CDECL_OBJFIRST); assert( ret >= 0 );
-				
-				// Binary operators
-				ret = as_engine->RegisterObjectMethod(type.c_str(), (type + " opMul(const " + type + " &in) const").c_str(), asFUNCTIONPR(glm::detail::operator*, (const glm::quat &, const glm::quat &), glm::quat), asCALL_CDECL_OBJLAST); assert( ret >= 0 );
-				ret = as_engine->RegisterObjectMethod(type.c_str(), (type + " opDiv(const " + type + " &in) const").c_str(), asFUNCTIONPR(operator/, (const glm::quat &, const glm::quat &), glm::quat), asCALL_CDECL_OBJLAST); assert( ret >= 0 );
+				break;
+				case BINDING_PROPERTY: {
+					ret = as_engine->RegisterObjectProperty(type.name, binding.declaration, binding.offset); assert(ret >= 0);
+				}
+				break;
 			}
 		}
-		
 	}
-
+	
+	// The containers, which change the default namespace themselves.
+	RotationArray::Register(as_engine);
+	VectorArray::Register(as_engine);
+	
 	// Clean up after myself
 	ret = as_engine->SetDefaultNamespace(""); assert(ret >= 0);
 }
@@ -635,3 +728,138 @@ float AngleBetween(const glm::quat& rot, const glm::quat& other) {
 glm::quat operator/ (const glm::quat& q, const glm::quat& p) {
 	return glm::conjugate(q) * p; // Passes test, but is test correct?  SecondLife's LSL rotation division operator might not be the sanest implmentation... (IIRC there are bugs in it at this level...) ~Ricky 20120530
 }
+
+
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**
+* \brief The placement factory for a matrix, which starts as the identity.
+* \param[out] address The address where the matrix will be created.
+*/
+void MatrixFactory(glm::mat4* address) {
+	new(address) glm::mat4(1.0f);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**
+* \brief The placement factory for a copy of a matrix.
+* \param[in] other The matrix to copy.
+* \param[out] address The address where the matrix will be created.
+*/
+void MatrixFactory(const glm::mat4& other, glm::mat4* address) {
+	new(address) glm::mat4(other);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**
+* \brief The placement factory for a transform matrix, the same composition as an entity's local matrix.
+* \param[in] translation The translation, applied last.
+* \param[in] rotation The rotation, applied after the scale.
+* \param[in] scale The uniform scale, applied first.
+* \param[out] address The address where the matrix will be created.
+*/
+void MatrixFactory(const glm::vec3& translation, const glm::quat& rotation, const float& scale, glm::mat4* address) {
+	glm::mat4* matrix = new(address) glm::mat4(glm::mat4_cast(rotation));
+	
+	(*matrix)[0] = (*matrix)[0] * scale;
+	(*matrix)[1] = (*matrix)[1] * scale;
+	(*matrix)[2] = (*matrix)[2] * scale;
+	(*matrix)[3] = glm::vec4(translation, 1.0f);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**
+* \brief Matrix multiplication.
+* \param[in] left The matrix applied last.
+* \param[in] right The matrix applied first.
+* \return The product.
+*/
+glm::mat4 MatrixMultiply(const glm::mat4& left, const glm::mat4& right) {
+	return left * right;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**
+* \brief Transforms a position: translation applies.
+* \param[in] matrix The matrix.
+* \param[in] point The position.
+* \return The transformed position.
+*/
+glm::vec3 MatrixTransformPoint(const glm::mat4& matrix, const glm::vec3& point) {
+	glm::vec4 result = matrix * glm::vec4(point, 1.0f);
+	return glm::vec3(result.x, result.y, result.z);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**
+* \brief Transforms a direction: translation doesn't apply.
+* \param[in] matrix The matrix.
+* \param[in] direction The direction.
+* \return The transformed direction.
+*/
+glm::vec3 MatrixTransformDirection(const glm::mat4& matrix, const glm::vec3& direction) {
+	glm::vec4 result = matrix * glm::vec4(direction, 0.0f);
+	return glm::vec3(result.x, result.y, result.z);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**
+* \brief Calculates the inverse of a matrix.
+* \param[in] matrix The matrix.
+* \return The inverse.
+*/
+glm::mat4 MatrixInverse(const glm::mat4& matrix) {
+	return glm::inverse(matrix);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**
+* \brief Calculates the transpose of a matrix.
+* \param[in] matrix The matrix.
+* \return The transpose.
+*/
+glm::mat4 MatrixTranspose(const glm::mat4& matrix) {
+	return glm::transpose(matrix);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**
+* \brief Gets the translation of an affine matrix.
+* \param[in] matrix The matrix.
+* \return The translation, the first three rows of the last column.
+*/
+glm::vec3 MatrixGetTranslation(const glm::mat4& matrix) {
+	return glm::vec3(matrix[3].x, matrix[3].y, matrix[3].z);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**
+* \brief Gets an element of a matrix, raising a script exception if out of range.
+* \param[in] matrix The matrix.
+* \param[in] column, row The element's position, each from 0 to 3.
+* \return The element, or 0 if out of range.
+*/
+float MatrixGet(const glm::mat4& matrix, unsigned int column, unsigned int row) {
+	if (column > 3 || row > 3) {
+		asGetActiveContext()->SetException("Matrix element out of range");
+		return 0.0f;
+	}
+	
+	return matrix[column][row];
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**
+* \brief Sets an element of a matrix, raising a script exception if out of range.
+* \param[in,out] matrix The matrix.
+* \param[in] column, row The element's position, each from 0 to 3.
+* \param[in] value The new value of the element.
+*/
+void MatrixSet(glm::mat4& matrix, unsigned int column, unsigned int row, float value) {
+	if (column > 3 || row > 3) {
+		asGetActiveContext()->SetException("Matrix element out of range");
+		return;
+	}
+	
+	matrix[column][row] = value;
+}
@@ -0,0 +1,91 @@
+/**
+* \file
+* \author agent
+* \date 2026-10-19
+* \brief ScriptProfiler definitions.
+*/
+
+#include "ScriptProfiler.h"
+
+// System Library Includes
+#include <fstream>
+#include <ostream>
+
+// Application Library Includes
+#include <angelscript.h>
+#include <boost/lexical_cast.hpp>
+
+// Local Includes
+
+// Static class member initialization
+
+// Class methods in the order they are defined within the class header
+
+/**
+* \param[in] interval Seconds between samples.
+*/
+ScriptProfiler::ScriptProfiler(double interval) : interval(interval) {
+}
+
+/**
+* \return Seconds between samples.
+*/
+double ScriptProfiler::GetInterval() const {
+	return this->interval;
+}
+
+/**
+* \param[in] ctx The context to sample, which must be executing.
+* \param[in] elapsed Seconds since the context's last sample.
+*/
+void ScriptProfiler::Sample(asIScriptContext* ctx, double elapsed) {
+	std::string stack;
+	
+	// The outermost frame comes first.
+	for (asUINT level = ctx->GetCallstackSize(); level-- > 0; ) {
+		asIScriptFunction* func = ctx->GetFunction(level);
+		if (func == nullptr) {
+			continue;
+		}
+		
+		if (!stack.empty()) {
+			stack += ';';
+		}
+		if (func->GetNamespace() != nullptr && func->GetNamespace()[0] != '\0') {
+			stack += func->GetNamespace();
+			stack += "::";
+		}
+		stack += func->GetName();
+		stack += ':';
+		stack += boost::lexical_cast<std::string>(ctx->GetLineNumber(level));
+	}
+	
+	boost::mutex::scoped_lock lock(this->stacksMutex);
+	this->stacks[stack] += elapsed;
+}
+
+/**
+* \param[out] out The stream to write to.
+*/
+void ScriptProfiler::WriteFoldedStacks(std::ostream& out) const {
+	boost::mutex::scoped_lock lock(this->stacksMutex);
+	
+	for (std::map<std::string, double>::const_iterator stack_it = this->stacks.begin(); stack_it != this->stacks.end(); ++stack_it) {
+		out << stack_it->first << ' ' << static_cast<unsigned long>(stack_it->second * 1000000.0 + 0.5) << '\n';
+	}
+}
+
+/**
+* \param[in] filename The file to write.
+* \return False if the file couldn't be written.
+*/
+bool ScriptProfiler::SaveFoldedStacks(const std::string& filename) const {
+	std::ofstream out(filename.c_str());
+	if (!out) {
+		return false;
+	}
+	
+	this->WriteFoldedStacks(out);
+	
+	return !out.fail();
+}
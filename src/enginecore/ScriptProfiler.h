@@ -0,0 +1,68 @@
+/**
+* \file
+* \author agent
+* \date 2026-10-19
+* \brief ScriptProfiler declaration: where scripts spend their time, as sampled from the line callbacks of their contexts.
+*/
+#pragma once
+
+// System Library Includes
+#include <iosfwd>
+#include <map>
+#include <string>
+
+// Application Library Includes
+#include <boost/thread/mutex.hpp>
+
+// Local Includes
+
+// Forward Declarations
+class asIScriptContext;
+
+// Typedefs
+
+/**
+* \brief Totals the time scripts spend in each call stack.
+* \details The ScriptExecutors of a ScriptEngine call Sample from their line callbacks, at most once an interval, with
+* the time since their last sample.  The time is put against the whole call stack at that moment, each frame being the
+* function and the line it is on, so that the totals can be read either by function or by line.  The totals are written
+* as folded stacks, one line per stack of semicolon separated frames from the outermost in, followed by the
+* microseconds spent in it: the input format of flamegraph.pl.
+*/
+class ScriptProfiler {
+public:
+	/**
+	* \param[in] interval Seconds between samples.
+	*/
+	explicit ScriptProfiler(double interval);
+	
+	/**
+	* \brief Seconds between samples.
+	*/
+	double GetInterval() const;
+	
+	/**
+	* \brief Puts the seconds given against the current call stack of the context.
+	*/
+	void Sample(asIScriptContext*, double);
+	
+	/**
+	* \brief Writes the totals as folded stacks.
+	*/
+	void WriteFoldedStacks(std::ostream&) const;
+	
+	/**
+	* \brief Writes the totals as folded stacks to the given file, replacing it.
+	* \return False if the file couldn't be written.
+	*/
+	bool SaveFoldedStacks(const std::string&) const;
+
+private:
+	ScriptProfiler(const ScriptProfiler&);
+	ScriptProfiler& operator=(const ScriptProfiler&);
+	
+	double interval;
+	
+	mutable boost::mutex stacksMutex; /**< Executors on other threads may be sampling. */
+	std::map<std::string, double> stacks; /**< Seconds spent, by folded stack. */
+};
@@ -0,0 +1,239 @@
+/**
+* \file
+* \author agent
+* \date 2026-10-19
+* \brief ScriptScheduler definitions.
+*/
+
+#include "ScriptScheduler.h"
+
+// System Library Includes
+#include <cassert>
+
+// Application Library Includes
+#include <angelscript.h>
+#include <boost/chrono.hpp>
+
+// Local Includes
+#include "ScriptEngine.h"
+#include "ScriptExecutor.h"
+
+// Static class member initialization
+
+// Local Functions
+namespace {
+	/// Seconds of the steady clock.
+	double Now() {
+		return boost::chrono::duration<double>(boost::chrono::steady_clock::now().time_since_epoch()).count();
+	}
+}
+
+// Class methods in the order they are defined within the class header
+
+/**
+* \param[in] engine The engine to take contexts from.
+*/
+ScriptScheduler::ScriptScheduler(ScriptEngine* engine) : scriptEngine(engine), nextID(1), running(0), time(0.0), budget(0.0) {
+	assert(engine != nullptr);
+}
+
+ScriptScheduler::~ScriptScheduler() {
+	this->Clear();
+}
+
+/**
+* \param[in] func The function to run, taking no arguments and returning nothing.  The caller keeps its reference.
+* \return The ID of the coroutine, or 0 if it couldn't be started.
+*/
+unsigned int ScriptScheduler::Start(asIScriptFunction* func) {
+	if (func == nullptr) {
+		return 0;
+	}
+	
+	ScriptExecutor* exec = nullptr;
+	if (this->pool.empty()) {
+		exec = this->scriptEngine->ScriptExecutorFactory();
+		if (exec == nullptr) {
+			return 0;
+		}
+	}
+	else {
+		exec = this->pool.back();
+		this->pool.pop_back();
+	}
+	
+	if (exec->PrepareFunction(func) < 0) {
+		this->pool.push_back(exec);
+		return 0;
+	}
+	
+	unsigned int id = this->nextID++;
+	if (this->nextID == 0) {
+		this->nextID = 1; // 0 is kept for no coroutine.
+	}
+	
+	Coroutine coroutine;
+	coroutine.exec = exec;
+	coroutine.wakeTime = this->time;
+	this->coroutines[id] = coroutine;
+	this->ready.push_back(id);
+	
+	return id;
+}
+
+/**
+* \param[in] id The ID of the coroutine.
+* \return False if there is no such coroutine, as it has already finished.
+*/
+bool ScriptScheduler::Stop(unsigned int id) {
+	CoroutineMap::iterator co_it = this->coroutines.find(id);
+	if (co_it == this->coroutines.end()) {
+		return false;
+	}
+	
+	if (id == this->running) {
+		// A coroutine stopping itself: Resume releases it once the context has unwound.
+		co_it->second.exec->GetContext()->Abort();
+		return true;
+	}
+	
+	this->Release(co_it);
+	return true;
+}
+
+void ScriptScheduler::Clear() {
+	for (CoroutineMap::iterator co_it = this->coroutines.begin(); co_it != this->coroutines.end(); ++co_it) {
+		asIScriptContext* ctx = co_it->second.exec->GetContext();
+		if (ctx->GetState() == asEXECUTION_SUSPENDED) {
+			// Unwinds the script's stack, releasing the objects on it, which a suspended context won't do when destroyed.
+			ctx->Abort();
+		}
+		delete co_it->second.exec;
+	}
+	this->coroutines.clear();
+	this->ready.clear();
+	this->waiting = std::priority_queue<WakeEntry, std::vector<WakeEntry>, std::greater<WakeEntry> >();
+	
+	for (std::vector<ScriptExecutor*>::iterator exec_it = this->pool.begin(); exec_it != this->pool.end(); ++exec_it) {
+		delete *exec_it;
+	}
+	this->pool.clear();
+}
+
+/**
+* \param[in] seconds How long to sleep, in seconds of game time.  0 or less resumes on the next Update.
+*
+* Sets a script exception if called from anything other than the coroutine being resumed.
+*/
+void ScriptScheduler::Suspend(double seconds) {
+	asIScriptContext* ctx = asGetActiveContext();
+	
+	CoroutineMap::iterator co_it = this->coroutines.find(this->running);
+	if (co_it == this->coroutines.end() || co_it->second.exec->GetContext() != ctx) {
+		if (ctx != nullptr) {
+			ctx->SetException("Only a coroutine may yield or wait");
+		}
+		return;
+	}
+	
+	co_it->second.wakeTime = this->time + ((seconds > 0.0) ? seconds : 0.0);
+	
+	// The context stops once the call back into the engine returns.
+	ctx->Suspend();
+}
+
+/**
+* \param[in] elapsed Seconds of game time since the last update.
+*/
+void ScriptScheduler::Update(double elapsed) {
+	this->time += (elapsed > 0.0) ? elapsed : 0.0;
+	
+	while (!this->waiting.empty() && this->waiting.top().first <= this->time) {
+		this->ready.push_back(this->waiting.top().second);
+		this->waiting.pop();
+	}
+	
+	// Only the coroutines due now are resumed: one that yields goes to the back of the queue, for the next update.
+	std::deque<unsigned int>::size_type due = this->ready.size();
+	double deadline = Now() + this->budget;
+	
+	// At least one is resumed each update, however small the budget, so that they all get there in the end.
+	for (; due > 0; --due) {
+		unsigned int id = this->ready.front();
+		this->ready.pop_front();
+		this->Resume(id);
+		
+		if (this->budget > 0.0 && Now() >= deadline) {
+			break; // The rest stay at the front of the queue.
+		}
+	}
+}
+
+/**
+* \return The number of coroutines started and not yet finished or stopped.
+*/
+unsigned int ScriptScheduler::GetCount() const {
+	return static_cast<unsigned int>(this->coroutines.size());
+}
+
+/**
+* \param[in] seconds How long each Update may spend resuming coroutines.  0 or less is no limit.
+*/
+void ScriptScheduler::SetBudget(double seconds) {
+	this->budget = (seconds > 0.0) ? seconds : 0.0;
+}
+
+/**
+* \return The seconds each Update may spend resuming coroutines, or 0 if unlimited.
+*/
+double ScriptScheduler::GetBudget() const {
+	return this->budget;
+}
+
+/**
+* \param[in] id The ID of the coroutine, which is skipped if it has been stopped.
+*/
+void ScriptScheduler::Resume(unsigned int id) {
+	CoroutineMap::iterator co_it = this->coroutines.find(id);
+	if (co_it == this->coroutines.end()) {
+		return;
+	}
+	
+	// Should the context be suspended by anything other than Suspend, it carries on next update.
+	co_it->second.wakeTime = this->time;
+	
+	this->running = id;
+	int ret = co_it->second.exec->ExecuteFunction();
+	this->running = 0;
+	
+	// *NOTE: The script can start and stop other coroutines, but can't remove this one while it runs, so co_it is still good.
+	if (ret == asEXECUTION_SUSPENDED) {
+		if (co_it->second.wakeTime > this->time) {
+			this->waiting.push(WakeEntry(co_it->second.wakeTime, id));
+		}
+		else {
+			this->ready.push_back(id);
+		}
+	}
+	else {
+		// Finished, stopped, out of time, or thrown an exception, which the engine has already logged.
+		this->Release(co_it);
+	}
+}
+
+/**
+* \param[in] co_it The coroutine, which must not be executing.
+*/
+void ScriptScheduler::Release(CoroutineMap::iterator co_it) {
+	ScriptExecutor* exec = co_it->second.exec;
+	asIScriptContext* ctx = exec->GetContext();
+	
+	if (ctx->GetState() == asEXECUTION_SUSPENDED) {
+		ctx->Abort();
+	}
+	// Lets go of the function and anything left on the stack, so that the context is ready to prepare again.
+	ctx->Unprepare();
+	
+	this->pool.push_back(exec);
+	this->coroutines.erase(co_it);
+}
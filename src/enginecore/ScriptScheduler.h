@@ -0,0 +1,113 @@
+/**
+* \file
+* \author agent
+* \date 2026-10-19
+* \brief ScriptScheduler declaration.
+*/
+#pragma once
+
+// System Library Includes
+#include <deque>
+#include <functional>
+#include <map>
+#include <queue>
+#include <utility>
+#include <vector>
+
+// Application Library Includes
+
+// Local Includes
+
+// Forward Declarations
+class asIScriptFunction;
+class ScriptEngine;
+class ScriptExecutor;
+
+// Typedefs
+
+/**
+* \brief Runs script coroutines: script functions that suspend themselves part way through and carry on in a later frame.
+* \details A coroutine gives up the rest of the frame with Engine.Yield(), or sleeps for a time with Engine.Wait(seconds).
+* Each keeps its call stack in a context of its own, taken from a pool of idle executors so that short-lived coroutines
+* don't create and destroy a context each.  Update resumes the coroutines that are due, in the order they became due,
+* until the frame's time budget runs out; any left over are resumed first in the next frame.
+* Each resume is a separate call into scripts, so the ScriptEngine's time limit and profiler apply to it.
+*/
+class ScriptScheduler {
+public:
+	/**
+	* \param[in] engine The engine to take contexts from, which is to outlive the scheduler.
+	*/
+	explicit ScriptScheduler(ScriptEngine* engine);
+	~ScriptScheduler();
+	
+	/**
+	* \brief Starts a coroutine running the function, from the next Update.
+	*/
+	unsigned int Start(asIScriptFunction*);
+	
+	/**
+	* \brief Stops a coroutine where it is.
+	*/
+	bool Stop(unsigned int);
+	
+	/**
+	* \brief Stops every coroutine and releases the pooled contexts.
+	*/
+	void Clear();
+	
+	/**
+	* \brief Called by the running coroutine to suspend itself for the given number of seconds.  0 resumes it next Update.
+	*/
+	void Suspend(double);
+	
+	/**
+	* \brief Advances the scheduler's clock and resumes the coroutines that are due.
+	*/
+	void Update(double);
+	
+	/**
+	* \brief Gets the number of coroutines not yet finished.
+	*/
+	unsigned int GetCount() const;
+	
+	/**
+	* \brief Sets the seconds Update may spend resuming coroutines.  0 is no limit.
+	*/
+	void SetBudget(double);
+	
+	/**
+	* \brief Gets the seconds Update may spend resuming coroutines, or 0 if unlimited.
+	*/
+	double GetBudget() const;
+private:
+	ScriptScheduler(const ScriptScheduler&);
+	ScriptScheduler& operator=(const ScriptScheduler&);
+	
+	struct Coroutine {
+		ScriptExecutor* exec;
+		double wakeTime; /**< When to resume, in seconds of the scheduler's clock. */
+	};
+	typedef std::map<unsigned int, Coroutine> CoroutineMap;
+	typedef std::pair<double, unsigned int> WakeEntry; /**< The wake time of a coroutine, and its ID. */
+	
+	/**
+	* \brief Resumes a coroutine, and queues it again or releases it depending on how it stopped.
+	*/
+	void Resume(unsigned int);
+	
+	/**
+	* \brief Gives the coroutine's executor back to the pool and forgets it.
+	*/
+	void Release(CoroutineMap::iterator);
+	
+	ScriptEngine* scriptEngine;
+	CoroutineMap coroutines; /**< Every unfinished coroutine by ID.  The queues only hold IDs, so that stopped ones are skipped. */
+	std::deque<unsigned int> ready; /**< Coroutines to resume, in order. */
+	std::priority_queue<WakeEntry, std::vector<WakeEntry>, std::greater<WakeEntry> > waiting; /**< Coroutines waiting, soonest first. */
+	std::vector<ScriptExecutor*> pool; /**< Idle executors, each with a context ready for another coroutine. */
+	unsigned int nextID;
+	unsigned int running; /**< The ID of the coroutine being resumed, or 0. */
+	double time; /**< Seconds of game time since the scheduler was made, advanced by Update. */
+	double budget;
+};
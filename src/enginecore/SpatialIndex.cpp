@@ -0,0 +1,506 @@
+/**
+* \file
+* \author agent
+* \date 2026-10-19
+* \brief SpatialIndex definitions: a uniform hash grid over entity world positions.
+*/
+
+#include "SpatialIndex.h"
+
+// System Library Includes
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <utility>
+
+// Application Library Includes
+#include <angelscript.h>
+#include <angelscript/scriptarray.h>
+#include <boost/bind.hpp>
+#include <boost/lexical_cast.hpp>
+
+// Local Includes
+#include "../sharedbase/Entity.h"
+#include "../sharedbase/EventLogger.h"
+#include "EntityMap.h"
+#include "ScriptEngine.h"
+
+// Local Types
+namespace {
+	const float DEFAULT_CELL_SIZE = 10.0f;
+	
+	// *NOTE: Cell coordinates are packed 21 bits apiece into the key, so cells over a million apart share keys.  That only costs a few wasted distance checks.
+	const unsigned int KEY_BITS = 21;
+	const boost::uint64_t KEY_MASK = (1ull << KEY_BITS) - 1;
+	
+	/// Collects the entities of the visited cells that are within a sphere.
+	struct RadiusVisitor {
+		RadiusVisitor(const glm::vec3& center, float radius) : center(center), radiusSquared(radius * radius) { }
+		
+		template <typename ItemList> void Visit(const ItemList& items) {
+			for (typename ItemList::const_iterator item_it = items.begin(); item_it != items.end(); ++item_it) {
+				glm::vec3 offset = item_it->position - this->center;
+				if (glm::dot(offset, offset) <= this->radiusSquared) {
+					this->found.push_back(item_it->entry);
+				}
+			}
+		}
+		
+		glm::vec3 center;
+		float radiusSquared;
+		std::vector<unsigned int> found;
+	};
+	
+	/// Collects the entities of the visited cells that are within a box.
+	struct BoxVisitor {
+		BoxVisitor(const glm::vec3& low, const glm::vec3& high) : low(low), high(high) { }
+		
+		template <typename ItemList> void Visit(const ItemList& items) {
+			for (typename ItemList::const_iterator item_it = items.begin(); item_it != items.end(); ++item_it) {
+				const glm::vec3& position = item_it->position;
+				if (position.x >= this->low.x && position.y >= this->low.y && position.z >= this->low.z &&
+					position.x <= this->high.x && position.y <= this->high.y && position.z <= this->high.z) {
+					this->found.push_back(item_it->entry);
+				}
+			}
+		}
+		
+		glm::vec3 low, high;
+		std::vector<unsigned int> found;
+	};
+	
+	/// Keeps the closest entities of the visited cells, as a max heap on the squared distance.
+	struct NearestVisitor {
+		typedef std::pair<float, unsigned int> Candidate;
+		
+		NearestVisitor(const glm::vec3& point, unsigned int count) : point(point), count(count) { }
+		
+		template <typename ItemList> void Visit(const ItemList& items) {
+			for (typename ItemList::const_iterator item_it = items.begin(); item_it != items.end(); ++item_it) {
+				glm::vec3 offset = item_it->position - this->point;
+				Candidate candidate(glm::dot(offset, offset), item_it->entry);
+				
+				if (this->heap.size() < this->count) {
+					this->heap.push_back(candidate);
+					std::push_heap(this->heap.begin(), this->heap.end());
+				}
+				else if (candidate < this->heap.front()) {
+					std::pop_heap(this->heap.begin(), this->heap.end());
+					this->heap.back() = candidate;
+					std::push_heap(this->heap.begin(), this->heap.end());
+				}
+			}
+		}
+		
+		bool IsFull() const { return this->heap.size() >= this->count; }
+		
+		glm::vec3 point;
+		unsigned int count;
+		std::vector<Candidate> heap;
+	};
+}
+
+/**
+* \param[in] entities The entities to index.  Those already in it are indexed straight away, and the rest as they are added.
+*/
+SpatialIndex::SpatialIndex(EntityMap& entities) : entities(entities), cellSize(DEFAULT_CELL_SIZE), entityArrayType(nullptr) {
+	this->entities.AddObserver(boost::bind(&SpatialIndex::Insert, this, _1), boost::bind(&SpatialIndex::Erase, this, _1));
+	
+	const NamedEntityMap& entity_map = this->entities.GetEntities();
+	for (NamedEntityMap::const_iterator entity_it = entity_map.begin(); entity_it != entity_map.end(); ++entity_it) {
+		this->Insert(entity_it->second);
+	}
+}
+
+SpatialIndex::~SpatialIndex() {
+}
+
+/**
+* \param[in] size The edge length of a cell, in world units.
+*/
+void SpatialIndex::SetCellSize(float size) {
+	if (!(size > 0.0f)) {
+		LOG(LOG_PRIORITY::CONFIG, "ERROR: The spatial index's cell size must be positive, not " + boost::lexical_cast<std::string>(size) + ".");
+		return;
+	}
+	
+	this->cellSize = size;
+	
+	this->cells.clear();
+	this->freeCells.clear();
+	this->cellLookup.clear();
+	
+	for (unsigned int entry = 0; entry < this->entries.size(); ++entry) {
+		this->AddToCell(entry);
+	}
+}
+
+/**
+* \return The edge length of a cell, in world units.
+*/
+float SpatialIndex::GetCellSize() const {
+	return this->cellSize;
+}
+
+void SpatialIndex::Update() {
+	if (this->entries.empty()) {
+		return;
+	}
+	
+	this->worldPositions.resize(this->entries.size());
+	Entity::GetWorldTransforms(this->entryEntities, &this->worldPositions[0], nullptr, nullptr);
+	
+	for (unsigned int entry_index = 0; entry_index < this->entries.size(); ++entry_index) {
+		Entry& entry = this->entries[entry_index];
+		
+		const glm::vec3& position = this->worldPositions[entry_index];
+		if (position == entry.position) {
+			continue;
+		}
+		entry.position = position;
+		
+		Cell& cell = this->cells[entry.cell];
+		if (cell.key == SpatialIndex::KeyOf(this->CellOf(position))) {
+			cell.items[entry.slot].position = position;
+		}
+		else {
+			this->RemoveFromCell(entry_index);
+			this->AddToCell(entry_index);
+		}
+	}
+}
+
+/**
+* \param[in] center The center of the sphere.
+* \param[in] radius The radius of the sphere.
+* \param[out] found Has the entities found appended.
+* \return The number of entities found.
+*/
+unsigned int SpatialIndex::FindInRadius(const glm::vec3& center, float radius, std::vector<EntitySPTR>& found) const {
+	if (radius < 0.0f) {
+		return 0;
+	}
+	
+	glm::vec3 extent(radius, radius, radius);
+	RadiusVisitor visitor(center, radius);
+	this->VisitCells(this->CellOf(center - extent), this->CellOf(center + extent), visitor);
+	
+	for (std::vector<unsigned int>::const_iterator entry_it = visitor.found.begin(); entry_it != visitor.found.end(); ++entry_it) {
+		found.push_back(this->entryEntities[*entry_it]);
+	}
+	
+	return static_cast<unsigned int>(visitor.found.size());
+}
+
+/**
+* \param[in] low The minimum corner of the box.
+* \param[in] high The maximum corner of the box.
+* \param[out] found Has the entities found appended.
+* \return The number of entities found.
+*/
+unsigned int SpatialIndex::FindInBox(const glm::vec3& low, const glm::vec3& high, std::vector<EntitySPTR>& found) const {
+	if (low.x > high.x || low.y > high.y || low.z > high.z) {
+		return 0;
+	}
+	
+	BoxVisitor visitor(low, high);
+	this->VisitCells(this->CellOf(low), this->CellOf(high), visitor);
+	
+	for (std::vector<unsigned int>::const_iterator entry_it = visitor.found.begin(); entry_it != visitor.found.end(); ++entry_it) {
+		found.push_back(this->entryEntities[*entry_it]);
+	}
+	
+	return static_cast<unsigned int>(visitor.found.size());
+}
+
+/**
+* \param[in] point The point to measure from.
+* \param[in] count The most entities to find.
+* \param[out] found Has the entities found appended, closest first.
+* \return The number of entities found.
+*/
+unsigned int SpatialIndex::FindNearest(const glm::vec3& point, unsigned int count, std::vector<EntitySPTR>& found) const {
+	if (count == 0 || this->entries.empty()) {
+		return 0;
+	}
+	
+	NearestVisitor visitor(point, count);
+	glm::ivec3 center = this->CellOf(point);
+	
+	// Search shells of cells ever further out.  The point is inside the center cell, so every cell in shell ring + 1
+	// is at least ring cells away: once the heap is full and its farthest is closer than that, the search is done.
+	for (int ring = 0; ; ++ring) {
+		long long side = 2 * ring + 1;
+		long long shell_cells = (ring == 0) ? 1 : side * side * side - (side - 2) * (side - 2) * (side - 2);
+		
+		if (shell_cells > static_cast<long long>(this->cellLookup.size())) {
+			// Past here visiting every occupied cell is cheaper than visiting the shell.  Cells already visited are
+			// seen again, so start over.
+			visitor.heap.clear();
+			this->VisitCells(glm::ivec3(1, 1, 1), glm::ivec3(0, 0, 0), visitor);
+			break;
+		}
+		
+		glm::ivec3 low(center - glm::ivec3(ring, ring, ring));
+		glm::ivec3 high(center + glm::ivec3(ring, ring, ring));
+		for (int x = low.x; x <= high.x; ++x) {
+			for (int y = low.y; y <= high.y; ++y) {
+				bool x_or_y_edge = (x == low.x || x == high.x || y == low.y || y == high.y);
+				
+				// Only the shell: the inside was done by the earlier rings.
+				for (int z = low.z; z <= high.z; z += (x_or_y_edge || ring == 0) ? 1 : (high.z - low.z)) {
+					boost::unordered_map<CellKey, unsigned int>::const_iterator cell_it = this->cellLookup.find(SpatialIndex::KeyOf(glm::ivec3(x, y, z)));
+					if (cell_it != this->cellLookup.end()) {
+						visitor.Visit(this->cells[cell_it->second].items);
+					}
+				}
+			}
+		}
+		
+		float reach = ring * this->cellSize;
+		if (visitor.IsFull() && visitor.heap.front().first <= reach * reach) {
+			break;
+		}
+	}
+	
+	std::sort_heap(visitor.heap.begin(), visitor.heap.end());
+	for (std::vector<NearestVisitor::Candidate>::const_iterator candidate_it = visitor.heap.begin(); candidate_it != visitor.heap.end(); ++candidate_it) {
+		found.push_back(this->entryEntities[candidate_it->second]);
+	}
+	
+	return static_cast<unsigned int>(visitor.heap.size());
+}
+
+/**
+* \return The number of entities indexed.
+*/
+unsigned int SpatialIndex::GetCount() const {
+	return static_cast<unsigned int>(this->entries.size());
+}
+
+/**
+* \param[in] engine The script engine, on which Entity must already be registered.
+*/
+void SpatialIndex::RegisterScriptEngine(ScriptEngine* const engine) {
+	asIScriptEngine* const as_engine = engine->GetasIScriptEngine();
+	assert(as_engine != nullptr);
+	int ret = 0;
+	
+	ret = as_engine->SetDefaultNamespace("Engine"); assert(ret >= 0);
+	
+	ret = as_engine->RegisterObjectType("SpatialIndex", 0, asOBJ_REF | asOBJ_NOHANDLE); assert(ret >= 0);
+	ret = as_engine->RegisterGlobalProperty("SpatialIndex gSpatialIndex", this); assert(ret >= 0);
+	ret = as_engine->RegisterObjectMethod("SpatialIndex", "void SetCellSize(float)", asMETHOD(SpatialIndex, SetCellSize), asCALL_THISCALL); assert(ret >= 0);
+	ret = as_engine->RegisterObjectMethod("SpatialIndex", "float GetCellSize()", asMETHOD(SpatialIndex, GetCellSize), asCALL_THISCALL); assert(ret >= 0);
+	ret = as_engine->RegisterObjectMethod("SpatialIndex", "uint GetCount()", asMETHOD(SpatialIndex, GetCount), asCALL_THISCALL); assert(ret >= 0);
+	ret = as_engine->RegisterObjectMethod("SpatialIndex", "array<Entity@>@ FindInRadius(const Vector &in, float)", asMETHOD(SpatialIndex, FindInRadiusForScript), asCALL_THISCALL); assert(ret >= 0);
+	ret = as_engine->RegisterObjectMethod("SpatialIndex", "array<Entity@>@ FindInBox(const Vector &in, const Vector &in)", asMETHOD(SpatialIndex, FindInBoxForScript), asCALL_THISCALL); assert(ret >= 0);
+	ret = as_engine->RegisterObjectMethod("SpatialIndex", "array<Entity@>@ FindNearest(const Vector &in, uint)", asMETHOD(SpatialIndex, FindNearestForScript), asCALL_THISCALL); assert(ret >= 0);
+	
+	// Registering the methods above made the array type.
+	this->entityArrayType = as_engine->GetObjectTypeById(as_engine->GetTypeIdByDecl("array<Entity@>"));
+	assert(this->entityArrayType != nullptr);
+	
+	// Clean up after myself
+	ret = as_engine->SetDefaultNamespace(""); assert(ret >= 0);
+}
+
+/**
+* \param[in] entity The entity added to the EntityMap.
+*/
+void SpatialIndex::Insert(EntitySPTR entity) {
+	if (this->entryLookup.find(entity.get()) != this->entryLookup.end()) {
+		return;
+	}
+	
+	unsigned int entry_index = static_cast<unsigned int>(this->entries.size());
+	
+	Entry entry;
+	entry.position = entity->GetWorldPosition();
+	entry.cell = 0;
+	entry.slot = 0;
+	
+	this->entries.push_back(entry);
+	this->entryEntities.push_back(entity);
+	this->entryLookup[entity.get()] = entry_index;
+	
+	this->AddToCell(entry_index);
+}
+
+/**
+* \param[in] entity The entity removed from the EntityMap.
+*/
+void SpatialIndex::Erase(EntitySPTR entity) {
+	boost::unordered_map<const Entity*, unsigned int>::iterator lookup_it = this->entryLookup.find(entity.get());
+	if (lookup_it == this->entryLookup.end()) {
+		return;
+	}
+	
+	unsigned int entry_index = lookup_it->second;
+	this->entryLookup.erase(lookup_it);
+	this->RemoveFromCell(entry_index);
+	
+	// Move the last entry into the gap, and point its cell item and lookup at the new place.
+	unsigned int last = static_cast<unsigned int>(this->entries.size()) - 1;
+	if (entry_index != last) {
+		Entry& moved = this->entries[entry_index];
+		moved = this->entries[last];
+		this->cells[moved.cell].items[moved.slot].entry = entry_index;
+		this->entryEntities[entry_index] = this->entryEntities[last];
+		this->entryLookup[this->entryEntities[entry_index].get()] = entry_index;
+	}
+	this->entries.pop_back();
+	this->entryEntities.pop_back();
+}
+
+/**
+* \param[in] position A world position.
+* \return The coordinates of the cell containing it.
+*/
+glm::ivec3 SpatialIndex::CellOf(const glm::vec3& position) const {
+	return glm::ivec3(
+		static_cast<int>(std::floor(position.x / this->cellSize)),
+		static_cast<int>(std::floor(position.y / this->cellSize)),
+		static_cast<int>(std::floor(position.z / this->cellSize))
+	);
+}
+
+/**
+* \param[in] coordinates The coordinates of a cell.
+* \return The key of the cell.
+*/
+SpatialIndex::CellKey SpatialIndex::KeyOf(const glm::ivec3& coordinates) {
+	return
+		((static_cast<CellKey>(coordinates.x) & KEY_MASK) << (2 * KEY_BITS)) |
+		((static_cast<CellKey>(coordinates.y) & KEY_MASK) << KEY_BITS) |
+		(static_cast<CellKey>(coordinates.z) & KEY_MASK);
+}
+
+/**
+* \param[in] coordinates The coordinates of the cell.
+* \return The index of the cell in cells.
+*/
+unsigned int SpatialIndex::FindOrAddCell(const glm::ivec3& coordinates) {
+	CellKey key = SpatialIndex::KeyOf(coordinates);
+	
+	boost::unordered_map<CellKey, unsigned int>::const_iterator cell_it = this->cellLookup.find(key);
+	if (cell_it != this->cellLookup.end()) {
+		return cell_it->second;
+	}
+	
+	unsigned int cell_index;
+	if (!this->freeCells.empty()) {
+		cell_index = this->freeCells.back();
+		this->freeCells.pop_back();
+	}
+	else {
+		cell_index = static_cast<unsigned int>(this->cells.size());
+		this->cells.push_back(Cell());
+	}
+	
+	this->cells[cell_index].key = key;
+	this->cellLookup[key] = cell_index;
+	
+	return cell_index;
+}
+
+/**
+* \param[in] entry_index The entry, whose position is already set.
+*/
+void SpatialIndex::AddToCell(unsigned int entry_index) {
+	Entry& entry = this->entries[entry_index];
+	
+	entry.cell = this->FindOrAddCell(this->CellOf(entry.position));
+	
+	std::vector<CellItem>& items = this->cells[entry.cell].items;
+	entry.slot = static_cast<unsigned int>(items.size());
+	
+	CellItem item;
+	item.position = entry.position;
+	item.entry = entry_index;
+	items.push_back(item);
+}
+
+/**
+* \param[in] entry_index The entry.
+*/
+void SpatialIndex::RemoveFromCell(unsigned int entry_index) {
+	const Entry& entry = this->entries[entry_index];
+	Cell& cell = this->cells[entry.cell];
+	
+	// Move the cell's last item into the gap.
+	if (entry.slot + 1 != cell.items.size()) {
+		cell.items[entry.slot] = cell.items.back();
+		this->entries[cell.items[entry.slot].entry].slot = entry.slot;
+	}
+	cell.items.pop_back();
+	
+	if (cell.items.empty()) {
+		this->cellLookup.erase(cell.key);
+		this->freeCells.push_back(entry.cell);
+	}
+}
+
+/**
+* \param[in] low, high The corners of the range of cells, inclusive.  A range with low above high visits every occupied cell.
+* \param[in] visitor Has Visit called with the items of each cell.
+*/
+template <typename Visitor> void SpatialIndex::VisitCells(const glm::ivec3& low, const glm::ivec3& high, Visitor& visitor) const {
+	bool everything = (low.x > high.x || low.y > high.y || low.z > high.z);
+	
+	if (!everything) {
+		double range_cells = double(high.x - low.x + 1) * double(high.y - low.y + 1) * double(high.z - low.z + 1);
+		everything = (range_cells > double(this->cellLookup.size()));
+	}
+	
+	if (everything) {
+		// *NOTE: Free cells are empty, so needn't be skipped.
+		for (std::vector<Cell>::const_iterator cell_it = this->cells.begin(); cell_it != this->cells.end(); ++cell_it) {
+			visitor.Visit(cell_it->items);
+		}
+		return;
+	}
+	
+	for (int x = low.x; x <= high.x; ++x) {
+		for (int y = low.y; y <= high.y; ++y) {
+			for (int z = low.z; z <= high.z; ++z) {
+				boost::unordered_map<CellKey, unsigned int>::const_iterator cell_it = this->cellLookup.find(SpatialIndex::KeyOf(glm::ivec3(x, y, z)));
+				if (cell_it != this->cellLookup.end()) {
+					visitor.Visit(this->cells[cell_it->second].items);
+				}
+			}
+		}
+	}
+}
+
+/**
+* \param[in] found The entities to return to the script.
+* \return A new array<Entity@> holding handles to them.
+*/
+CScriptArray* SpatialIndex::ToScriptArray(const std::vector<EntitySPTR>& found) const {
+	CScriptArray* array = new CScriptArray(static_cast<asUINT>(found.size()), this->entityArrayType);
+	
+	for (asUINT index = 0; index < found.size(); ++index) {
+		*static_cast<Entity**>(array->At(index)) = Entity::ToScriptHandle(found[index]);
+	}
+	
+	return array;
+}
+
+CScriptArray* SpatialIndex::FindInRadiusForScript(const glm::vec3& center, float radius) const {
+	std::vector<EntitySPTR> found;
+	this->FindInRadius(center, radius, found);
+	return this->ToScriptArray(found);
+}
+
+CScriptArray* SpatialIndex::FindInBoxForScript(const glm::vec3& low, const glm::vec3& high) const {
+	std::vector<EntitySPTR> found;
+	this->FindInBox(low, high, found);
+	return this->ToScriptArray(found);
+}
+
+CScriptArray* SpatialIndex::FindNearestForScript(const glm::vec3& point, unsigned int count) const {
+	std::vector<EntitySPTR> found;
+	this->FindNearest(point, count, found);
+	return this->ToScriptArray(found);
+}
@@ -0,0 +1,147 @@
+/**
+* \file
+* \author agent
+* \date 2026-10-19
+* \brief SpatialIndex declaration: finding the entities near a point or in a region.
+*/
+#pragma once
+
+// System Library Includes
+#include <vector>
+
+// Application Library Includes
+#include <boost/cstdint.hpp>
+#include <boost/unordered_map.hpp>
+#include <glm/glm.hpp>
+
+// Local Includes
+#include "../sharedbase/Entity_fwd.h"
+
+// Forward Declarations
+class asIObjectType;
+class CScriptArray;
+class Entity;
+class EntityMap;
+class ScriptEngine;
+
+// Typedefs
+
+/**
+* \brief A uniform hash grid over the world positions of every entity in an EntityMap.
+* \details Entities are bucketed by the grid cell their world position falls in, so a query only looks at the cells
+* it overlaps rather than at every entity.  Entities join and leave the grid as they are added to and removed from the
+* EntityMap.  Their positions are refreshed by Update, once a frame, which only touches the grid for entities that
+* moved; queries see the positions as of the last Update or, for entities added since, as of when they were added.
+* Pick a cell size around the radius of the typical query: much smaller and queries visit many empty cells, much
+* larger and each cell holds many entities that are too far away.
+*/
+class SpatialIndex {
+public:
+	SpatialIndex(EntityMap&);
+	~SpatialIndex();
+	
+	/**
+	* \brief Sets the edge length of the grid cells, rebuilding the grid.
+	*/
+	void SetCellSize(float);
+	
+	float GetCellSize() const;
+	
+	/**
+	* \brief Refreshes the positions of all entities, moving those that changed cell.
+	*/
+	void Update();
+	
+	/**
+	* @name Queries
+	* \brief Each appends the matching entities to the given list, and returns how many were appended.
+	*/
+	/**@{*/
+	/**
+	* \brief Finds the entities within the radius of the center.
+	*/
+	unsigned int FindInRadius(const glm::vec3&, float, std::vector<EntitySPTR>&) const;
+	
+	/**
+	* \brief Finds the entities inside the axis aligned box with the given minimum and maximum corners.
+	*/
+	unsigned int FindInBox(const glm::vec3&, const glm::vec3&, std::vector<EntitySPTR>&) const;
+	
+	/**
+	* \brief Finds up to the given number of entities closest to the point, closest first.
+	*/
+	unsigned int FindNearest(const glm::vec3&, unsigned int, std::vector<EntitySPTR>&) const;
+	/**@}*/
+	
+	/**
+	* \brief How many entities are indexed.
+	*/
+	unsigned int GetCount() const;
+	
+	/**
+	* \brief Angelscript registration for the spatial index.
+	*/
+	void RegisterScriptEngine(ScriptEngine* const);
+
+private:
+	SpatialIndex(const SpatialIndex&);
+	SpatialIndex& operator=(const SpatialIndex&);
+	
+	typedef boost::uint64_t CellKey;
+	
+	/// An entity as listed in a cell: its position is kept here so that queries needn't look anywhere else.
+	struct CellItem {
+		glm::vec3 position;
+		unsigned int entry;
+	};
+	
+	struct Cell {
+		CellKey key;
+		std::vector<CellItem> items;
+	};
+	
+	struct Entry {
+		glm::vec3 position;
+		unsigned int cell; ///< Index into cells.
+		unsigned int slot; ///< Index into the cell's items.
+	};
+	
+	void Insert(EntitySPTR);
+	void Erase(EntitySPTR);
+	
+	/// Cell coordinates of a position.
+	glm::ivec3 CellOf(const glm::vec3&) const;
+	static CellKey KeyOf(const glm::ivec3&);
+	
+	/// Returns the index of the cell with the given coordinates, creating the cell if need be.
+	unsigned int FindOrAddCell(const glm::ivec3&);
+	/// Lists the entry in its cell, which is set from its position.
+	void AddToCell(unsigned int entry);
+	/// Takes the entry out of its cell, freeing the cell once empty.
+	void RemoveFromCell(unsigned int entry);
+	
+	/**
+	* \brief Calls the visitor with each cell overlapping the range of cell coordinates.
+	* \details Visits every occupied cell instead when that is fewer than are in the range, as for a query far larger than the world.
+	*/
+	template <typename Visitor> void VisitCells(const glm::ivec3& low, const glm::ivec3& high, Visitor& visitor) const;
+	
+	CScriptArray* ToScriptArray(const std::vector<EntitySPTR>&) const;
+	CScriptArray* FindInRadiusForScript(const glm::vec3&, float) const;
+	CScriptArray* FindInBoxForScript(const glm::vec3&, const glm::vec3&) const;
+	CScriptArray* FindNearestForScript(const glm::vec3&, unsigned int) const;
+	
+	EntityMap& entities;
+	float cellSize;
+	
+	std::vector<Entry> entries;
+	std::vector<EntitySPTR> entryEntities; /**< The entity of each entry, kept apart so that all their world positions can be had in one batch. */
+	std::vector<glm::vec3> worldPositions; /**< Scratch space for Update, kept to save reallocating it every frame. */
+	boost::unordered_map<const Entity*, unsigned int> entryLookup; /**< Index into entries of each entity. */
+	
+	std::vector<Cell> cells; /**< Both occupied and free cells, so that entries can refer to cells by index. */
+	std::vector<unsigned int> freeCells; /**< Indices of the empty cells in cells, for reuse. */
+	boost::unordered_map<CellKey, unsigned int> cellLookup; /**< Index into cells of each occupied cell. */
+	
+	asIObjectType* entityArrayType; /**< The script type array<Entity@>, for returning query results. */
+};
@@ -0,0 +1,601 @@
+/**
+* \file
+* \author agent
+* \date 2026-10-19
+* \brief WorldSnapshot definitions.
+*/
+
+#include "WorldSnapshot.h"
+
+// System Library Includes
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+// Application Library Includes
+#include <boost/bind.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/filesystem.hpp>
+#include <boost/lexical_cast.hpp>
+
+// Local Includes
+#include "../sharedbase/AsyncDiskOperation.h"
+#include "../sharedbase/Entity.h"
+#include "../sharedbase/Envelope.h"
+#include "../sharedbase/EventLogger.h"
+#include "EntityMap.h"
+#include "ScriptEngine.h"
+
+// Local Consts
+const std::string SNAPSHOT_EXTENSION(".snapshot");
+const std::string JOURNAL_EXTENSION(".journal");
+
+// Local Functions
+namespace {
+	/// Runs on the disk worker thread.
+	bool WriteFullSnapshot(const EnvelopeSPTR& record, const std::string& path) {
+		if (!SaveToDiskBinary(record, path + SNAPSHOT_EXTENSION)) {
+			return false;
+		}
+		
+		// The journal is now stale.  Its records are numbered below the snapshot, so aren't replayed even if left.
+		std::string journal_file = path + JOURNAL_EXTENSION;
+		std::ofstream journal(journal_file.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+		journal.close();
+		
+		if (journal.fail()) {
+			LOG(LOG_PRIORITY::ERR, "Unable to empty journal '" + journal_file + "'.");
+			return false;
+		}
+		
+		return true;
+	}
+	
+	/// A record read from the journal, and where in the file it ends.
+	struct JournalRecord {
+		EnvelopeSPTR record;
+		std::size_t end;
+	};
+	
+	/**
+	* \brief Reads the whole records at the start of a journal, stopping at the first that can't be read.
+	* \param[in] journal_file The journal to read, which need not exist.  Anything other than a file reads as empty.
+	* \param[out] records The records read, in order.
+	* \return The size of the journal.
+	*/
+	std::size_t ReadJournal(const std::string& journal_file, std::vector<JournalRecord>& records) {
+		std::vector<char> journal;
+		
+		boost::system::error_code error;
+		if (!boost::filesystem::is_regular_file(journal_file, error)) {
+			return 0;
+		}
+		
+		{
+			std::ifstream stream(journal_file.c_str(), std::ios::in | std::ios::binary);
+			
+			if (stream) {
+				journal.assign(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+			}
+		}
+		
+		std::size_t valid_bytes = 0;
+		
+		while (journal.size() - valid_bytes >= sizeof(boost::uint32_t)) {
+			boost::uint32_t length = 0;
+			std::memcpy(&length, &journal[valid_bytes], sizeof(length));
+			
+			std::size_t start = valid_bytes + sizeof(length);
+			if (journal.size() - start < length) {
+				break;
+			}
+			
+			std::shared_ptr<std::vector<char> > buffer(new std::vector<char>(journal.begin() + start, journal.begin() + start + length));
+			EnvelopeSPTR record(new Envelope());
+			
+			if (!record->LoadFromBinaryBuffer(buffer) || record->msgid != SNAPSHOT_RECORD::DELTA) {
+				break;
+			}
+			
+			valid_bytes = start + length;
+			
+			JournalRecord journal_record = {record, valid_bytes};
+			records.push_back(journal_record);
+		}
+		
+		return journal.size();
+	}
+}
+
+// Static class member initialization
+
+// Class methods in the order they are defined within the class header
+
+/**
+* \param[in] entities The map of entities whose state is saved and restored.
+*/
+WorldSnapshot::WorldSnapshot(EntityMap& entities) :
+	entities(entities),
+	sequence(0),
+	needsFull(true),
+	journalRecords(0),
+	journalBytes(0),
+	maxJournalRecords(64),
+	maxJournalBytes(4 * 1024 * 1024),
+	pendingSave(nullptr)
+	{
+	this->entities.AddObserver(boost::bind(&WorldSnapshot::NoteAdded, this, _1), boost::bind(&WorldSnapshot::NoteRemoved, this, _1));
+}
+
+/**
+* \param[in] path The base path of the snapshot files.  ".snapshot" and ".journal" are appended to it.
+*/
+void WorldSnapshot::SetPath(const std::string& path) {
+	this->FinishPendingSave();
+	
+	if (this->path != path) {
+		// Whatever was saved before belongs to the other files.
+		this->saved.clear();
+		this->needsFull = true;
+		this->journalRecords = 0;
+		this->journalBytes = 0;
+		
+		this->path = path;
+		
+		// Carry on the numbering of the files there, so that records of an earlier run are never taken for newer ones.
+		this->sequence = std::max(this->sequence, this->ReadLastSequence());
+	}
+}
+
+/**
+* \param[in] records The number of delta records the journal may hold.
+* \param[in] bytes The size in bytes the journal may grow to.
+*/
+void WorldSnapshot::SetCompactionLimits(unsigned int records, unsigned int bytes) {
+	this->maxJournalRecords = records;
+	this->maxJournalBytes = bytes;
+}
+
+WorldSnapshot::~WorldSnapshot() {
+	this->FinishPendingSave();
+}
+
+/**
+* \return True if the snapshot was written.
+*/
+bool WorldSnapshot::SaveFull() {
+	AsyncDiskOperation* operation = this->SaveFullAsync();
+	
+	if (operation == nullptr) {
+		return false;
+	}
+	
+	operation->Release();
+	
+	return this->FinishPendingSave();
+}
+
+/**
+* \details The entity states are captured immediately; encoding and writing happen on the disk worker thread.
+* Any other snapshot call waits for the write to finish first.
+* \return The pending operation, with a reference held for the caller, or nullptr if there is no path set.
+*/
+AsyncDiskOperation* WorldSnapshot::SaveFullAsync() {
+	this->FinishPendingSave();
+	
+	if (this->path.empty()) {
+		LOG(LOG_PRIORITY::CONFIG, "ERROR: Unable to save a snapshot without a path.");
+		return nullptr;
+	}
+	
+	EntityStateMap current;
+	this->CaptureState(current);
+	this->ForgetChanges();
+	
+	EnvelopeSPTR record(new Envelope());
+	record->msgid = SNAPSHOT_RECORD::FULL;
+	record->AddData(this->sequence + 1);
+	
+	for (EntityStateMap::const_iterator state_it = current.begin(); state_it != current.end(); ++state_it) {
+		record->AddData(PackState(state_it->first, state_it->second));
+	}
+	
+	LOG(LOG_PRIORITY::INFO, "Saving full snapshot of " + boost::lexical_cast<std::string>(current.size()) + " entities.");
+	
+	// Assume success; FinishPendingSave forces the next save to be a full one should the write fail.
+	this->saved.swap(current);
+	++this->sequence;
+	this->needsFull = false;
+	this->journalRecords = 0;
+	this->journalBytes = 0;
+	
+	this->pendingSave = QueueDiskOperation(this->path + SNAPSHOT_EXTENSION, boost::bind(&WriteFullSnapshot, record, this->path));
+	this->pendingSave->Addref();
+	
+	return this->pendingSave;
+}
+
+/**
+* \return True if the changes were written, or if there were no changes to write.
+*/
+bool WorldSnapshot::SaveDelta() {
+	this->FinishPendingSave();
+	
+	if (this->needsFull || this->journalRecords >= this->maxJournalRecords || this->journalBytes >= this->maxJournalBytes) {
+		// Nothing to build on, or time to compact.
+		return this->SaveFull();
+	}
+	
+	EnvelopeSPTR record(new Envelope());
+	record->msgid = SNAPSHOT_RECORD::DELTA;
+	record->AddData(this->sequence + 1);
+	
+	// *NOTE: The saved state is brought up to date as the record is built.  Should the record fail to be written the
+	// next save is made a full one, as the changes are no longer noted anywhere else.
+	
+	// Removals go first, so that an entity since added under the same name is written after its predecessor is gone.
+	for (std::set<std::string>::const_iterator name_it = this->removedNames.begin(); name_it != this->removedNames.end(); ++name_it) {
+		EntityStateMap::iterator saved_it = this->saved.find(*name_it);
+		if (saved_it == this->saved.end()) {
+			continue; // Never saved.
+		}
+		
+		EnvelopeSPTR entity(new Envelope());
+		entity->msgid = SNAPSHOT_RECORD::REMOVED;
+		entity->AddData(*name_it);
+		
+		record->AddData(entity);
+		this->saved.erase(saved_it);
+	}
+	this->removedNames.clear();
+	
+	this->entities.TakeChangedEntities(this->changedEntities);
+	
+	for (std::vector<EntitySPTR>::const_iterator entity_it = this->changedEntities.begin(); entity_it != this->changedEntities.end(); ++entity_it) {
+		EntityState state;
+		CaptureState(**entity_it, state);
+		
+		EntityStateMap::iterator saved_it = this->saved.find((*entity_it)->GetName());
+		if (saved_it == this->saved.end()) {
+			// Added since the last save.
+			this->saved.insert(EntityStateMap::value_type((*entity_it)->GetName(), state));
+		}
+		else if (state != saved_it->second) {
+			saved_it->second = state;
+		}
+		else {
+			continue; // Set back to how it was saved.
+		}
+		
+		record->AddData(PackState((*entity_it)->GetName(), state));
+	}
+	this->changedEntities.clear();
+	
+	unsigned int changes = record->GetCount() - 1;
+	if (changes == 0) {
+		return true;
+	}
+	
+	std::vector<char> buffer;
+	record->SaveToBinaryBuffer(buffer);
+	
+	boost::uint32_t length = buffer.size();
+	std::string journal_file = this->path + JOURNAL_EXTENSION;
+	std::ofstream journal(journal_file.c_str(), std::ios::out | std::ios::binary | std::ios::app);
+	
+	journal.write(reinterpret_cast<const char*>(&length), sizeof(length));
+	journal.write(&buffer[0], buffer.size());
+	journal.close();
+	
+	// The number is used up even if the write failed, should part of the record have reached the disk.
+	++this->sequence;
+	
+	if (journal.fail()) {
+		LOG(LOG_PRIORITY::ERR, "Failed appending to journal '" + journal_file + "'.");
+		this->needsFull = true;
+		return false;
+	}
+	
+	++this->journalRecords;
+	this->journalBytes += sizeof(length) + length;
+	
+	LOG(LOG_PRIORITY::FLOW, "Journaled " + boost::lexical_cast<std::string>(changes) + " entity changes.");
+	return true;
+}
+
+/**
+* \return True if the snapshot was loaded and applied.
+*/
+bool WorldSnapshot::Load() {
+	this->FinishPendingSave();
+	
+	if (this->path.empty()) {
+		LOG(LOG_PRIORITY::CONFIG, "ERROR: Unable to load a snapshot without a path.");
+		return false;
+	}
+	
+	std::string snapshot_file = this->path + SNAPSHOT_EXTENSION;
+	std::string journal_file = this->path + JOURNAL_EXTENSION;
+	
+	EntityStateMap state;
+	unsigned int last_sequence = 0;
+	
+	{
+		EnvelopeSPTR base(new Envelope());
+		
+		if (!LoadFromDisk(base, snapshot_file) || base->msgid != SNAPSHOT_RECORD::FULL || !this->ApplyRecord(base, state)) {
+			LOG(LOG_PRIORITY::ERR, "Unable to load snapshot '" + snapshot_file + "'.");
+			return false;
+		}
+		
+		last_sequence = base->GetDataUInt(0);
+	}
+	
+	// Replay the journal.
+	unsigned int records = 0;
+	std::size_t valid_bytes = 0;
+	std::vector<JournalRecord> journal;
+	std::size_t journal_bytes = ReadJournal(journal_file, journal);
+	
+	for (std::vector<JournalRecord>::const_iterator record_it = journal.begin(); record_it != journal.end(); ++record_it) {
+		// Records from before the last compaction are already part of the snapshot.
+		unsigned int record_sequence = record_it->record->GetDataUInt(0);
+		if (record_sequence > last_sequence) {
+			if (!this->ApplyRecord(record_it->record, state)) {
+				break;
+			}
+			
+			last_sequence = record_sequence;
+			++records;
+		}
+		
+		valid_bytes = record_it->end;
+	}
+	
+	if (valid_bytes < journal_bytes) {
+		// Most likely a record cut short by a crash mid-append.  Drop it so new records aren't appended after garbage.
+		LOG(LOG_PRIORITY::WARN, "Discarding " + boost::lexical_cast<std::string>(journal_bytes - valid_bytes) + " unreadable bytes at the end of journal '" + journal_file + "'.");
+		
+		try {
+			boost::filesystem::resize_file(journal_file, valid_bytes);
+		}
+		catch (boost::filesystem::filesystem_error& exception) {
+			LOG(LOG_PRIORITY::ERR, "Unable to truncate journal '" + journal_file + "': " + exception.what());
+		}
+	}
+	
+	// Apply the transforms, creating any entity that doesn't exist yet.
+	const NamedEntityMap& entity_map = this->entities.GetEntities();
+	
+	for (EntityStateMap::const_iterator state_it = state.begin(); state_it != state.end(); ++state_it) {
+		NamedEntityMap::const_iterator entity_it = entity_map.find(&state_it->first);
+		EntitySPTR entity;
+		
+		if (entity_it != entity_map.end()) {
+			entity = entity_it->second;
+		}
+		else {
+			entity = Entity::Factory(state_it->first);
+			
+			if (!this->entities.AddEntity(entity)) {
+				continue;
+			}
+		}
+		
+		entity->location = state_it->second.location;
+		entity->rotation = state_it->second.rotation;
+		entity->scale = state_it->second.scale;
+	}
+	
+	// Parents can only be linked once every entity exists.
+	for (EntityStateMap::const_iterator state_it = state.begin(); state_it != state.end(); ++state_it) {
+		NamedEntityMap::const_iterator entity_it = entity_map.find(&state_it->first);
+		NamedEntityMap::const_iterator parent_it = entity_map.find(&state_it->second.parent);
+		
+		if (entity_it == entity_map.end()) {
+			continue;
+		}
+		
+		if (parent_it != entity_map.end()) {
+			entity_it->second->SetParent(parent_it->second);
+		}
+		else {
+			entity_it->second->SetParent(EntitySPTR());
+		}
+	}
+	
+	this->saved.swap(state);
+	this->sequence = std::max(this->sequence, last_sequence);
+	this->needsFull = false;
+	this->journalRecords = records;
+	this->journalBytes = valid_bytes;
+	
+	// What was just applied is saved already, but any entity that was in the map and not in the snapshot isn't.
+	this->ForgetChanges();
+	for (NamedEntityMap::const_iterator entity_it = entity_map.begin(); entity_it != entity_map.end(); ++entity_it) {
+		if (this->saved.find(entity_it->second->GetName()) == this->saved.end()) {
+			entity_it->second->MarkChanged();
+		}
+	}
+	
+	LOG(LOG_PRIORITY::INFO, "Loaded snapshot of " + boost::lexical_cast<std::string>(this->saved.size()) + " entities, replaying " + boost::lexical_cast<std::string>(records) + " journal records.");
+	return true;
+}
+
+/**
+* \param[in] engine The script engine to register with.
+*/
+void WorldSnapshot::RegisterScriptEngine(ScriptEngine* const engine) {
+	asIScriptEngine* const as_engine = engine->GetasIScriptEngine();
+	assert(as_engine != nullptr);
+	int ret = 0;
+	
+	AsyncDiskOperation::Register(as_engine);
+	
+	ret = as_engine->SetDefaultNamespace("Engine"); assert(ret >= 0);
+	
+	ret = as_engine->RegisterObjectType("WorldSnapshot", 0, asOBJ_REF | asOBJ_NOHANDLE); assert(ret >= 0);
+	ret = as_engine->RegisterGlobalProperty("WorldSnapshot gSnapshot", this); assert(ret >= 0);
+	ret = as_engine->RegisterObjectMethod("WorldSnapshot", "void SetPath(const string &in)", asMETHOD(WorldSnapshot, SetPath), asCALL_THISCALL); assert(ret >= 0);
+	ret = as_engine->RegisterObjectMethod("WorldSnapshot", "void SetCompactionLimits(uint, uint)", asMETHOD(WorldSnapshot, SetCompactionLimits), asCALL_THISCALL); assert(ret >= 0);
+	ret = as_engine->RegisterObjectMethod("WorldSnapshot", "bool SaveFull()", asMETHOD(WorldSnapshot, SaveFull), asCALL_THISCALL); assert(ret >= 0);
+	ret = as_engine->RegisterObjectMethod("WorldSnapshot", "DiskOperation@ SaveFullAsync()", asMETHOD(WorldSnapshot, SaveFullAsync), asCALL_THISCALL); assert(ret >= 0);
+	ret = as_engine->RegisterObjectMethod("WorldSnapshot", "bool SaveDelta()", asMETHOD(WorldSnapshot, SaveDelta), asCALL_THISCALL); assert(ret >= 0);
+	ret = as_engine->RegisterObjectMethod("WorldSnapshot", "bool Load()", asMETHOD(WorldSnapshot, Load), asCALL_THISCALL); assert(ret >= 0);
+	
+	// Clean up after myself
+	ret = as_engine->SetDefaultNamespace(""); assert(ret >= 0);
+}
+
+/**
+* \param[out] state Filled with the state of every entity, keyed by name.
+*/
+void WorldSnapshot::CaptureState(EntityStateMap& state) const {
+	const NamedEntityMap& entity_map = this->entities.GetEntities();
+	
+	for (NamedEntityMap::const_iterator entity_it = entity_map.begin(); entity_it != entity_map.end(); ++entity_it) {
+		// Inserting in order with a hint keeps this linear.
+		EntityState& entity_state = state.insert(state.end(), EntityStateMap::value_type(entity_it->second->GetName(), EntityState()))->second;
+		CaptureState(*entity_it->second, entity_state);
+	}
+}
+
+/**
+* \param[in] entity The entity to read.
+* \param[out] state Set to the state of the entity.
+*/
+void WorldSnapshot::CaptureState(const Entity& entity, EntityState& state) {
+	EntitySPTR parent = entity.GetParent();
+	
+	state.parent = parent ? parent->GetName() : "";
+	state.location = entity.location;
+	state.rotation = entity.rotation;
+	state.scale = entity.scale;
+}
+
+/**
+* \return The sequence number of the snapshot or of the last readable journal record, whichever is higher.
+*/
+unsigned int WorldSnapshot::ReadLastSequence() const {
+	unsigned int last_sequence = 0;
+	
+	std::string snapshot_file = this->path + SNAPSHOT_EXTENSION;
+	boost::system::error_code error;
+	if (boost::filesystem::exists(snapshot_file, error)) {
+		// *NOTE: Only the header and the sequence number are decoded, the entities are left in the file.
+		EnvelopeSPTR base(new Envelope());
+		if (LoadFromDisk(base, snapshot_file) && base->msgid == SNAPSHOT_RECORD::FULL) {
+			last_sequence = base->GetDataUInt(0);
+		}
+	}
+	
+	std::vector<JournalRecord> journal;
+	ReadJournal(this->path + JOURNAL_EXTENSION, journal);
+	
+	for (std::vector<JournalRecord>::const_iterator record_it = journal.begin(); record_it != journal.end(); ++record_it) {
+		last_sequence = std::max(last_sequence, record_it->record->GetDataUInt(0));
+	}
+	
+	return last_sequence;
+}
+
+void WorldSnapshot::ForgetChanges() {
+	this->entities.TakeChangedEntities(this->changedEntities);
+	this->changedEntities.clear();
+	this->removedNames.clear();
+}
+
+/**
+* \param[in] entity The entity added to the EntityMap.
+*/
+void WorldSnapshot::NoteAdded(EntitySPTR entity) {
+	// Saved as changed instead, should it have been removed and added back since the last save.
+	this->removedNames.erase(entity->GetName());
+}
+
+/**
+* \param[in] entity The entity removed from the EntityMap.
+*/
+void WorldSnapshot::NoteRemoved(EntitySPTR entity) {
+	this->removedNames.insert(entity->GetName());
+}
+
+/**
+* \return False if a pending full snapshot failed to be written.
+*/
+bool WorldSnapshot::FinishPendingSave() {
+	if (this->pendingSave == nullptr) {
+		return true;
+	}
+	
+	this->pendingSave->Wait();
+	bool success = this->pendingSave->Succeeded();
+	
+	this->pendingSave->Release();
+	this->pendingSave = nullptr;
+	
+	if (!success) {
+		// The journal may no longer match what's on disk, so start over from a full snapshot.
+		this->saved.clear();
+		this->needsFull = true;
+	}
+	
+	return success;
+}
+
+/**
+* \param[in] name The name of the entity.
+* \param[in] state The state of the entity.
+* \return An ENTITY record holding the state.
+*/
+EnvelopeSPTR WorldSnapshot::PackState(const std::string& name, const EntityState& state) {
+	EnvelopeSPTR entity(new Envelope());
+	entity->msgid = SNAPSHOT_RECORD::ENTITY;
+	entity->AddData(name);
+	entity->AddData(state.parent);
+	entity->AddData(state.location);
+	entity->AddData(state.rotation);
+	entity->AddData(state.scale);
+	
+	return entity;
+}
+
+/**
+* \param[in] record A FULL or DELTA record.
+* \param[in,out] state The state map the record is applied to.
+* \return False if the record was malformed.
+*/
+bool WorldSnapshot::ApplyRecord(const EnvelopeSPTR& record, EntityStateMap& state) const {
+	if (record->msgid == SNAPSHOT_RECORD::FULL) {
+		state.clear();
+	}
+	
+	unsigned int count = record->GetCount();
+	
+	for (unsigned int index = 1; index < count; ++index) {
+		EnvelopeSPTR entity = record->GetDataEnvelopeSPTR(index);
+		
+		if (!entity) {
+			return false;
+		}
+		
+		if (entity->msgid == SNAPSHOT_RECORD::ENTITY) {
+			EntityState& entity_state = state[entity->GetDataString(0)];
+			entity_state.parent = entity->GetDataString(1);
+			entity_state.location = entity->GetDataVector(2);
+			entity_state.rotation = entity->GetDataQuat(3);
+			entity_state.scale = entity->GetDataFloat(4);
+		}
+		else if (entity->msgid == SNAPSHOT_RECORD::REMOVED) {
+			state.erase(entity->GetDataString(0));
+		}
+		else {
+			return false;
+		}
+	}
+	
+	return true;
+}
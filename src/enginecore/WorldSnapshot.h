@@ -0,0 +1,166 @@
+/**
+* \file
+* \author agent
+* \date 2026-10-19
+* \brief WorldSnapshot declaration: incremental saving of the world state.
+*/
+#pragma once
+
+// System Library Includes
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+// Application Library Includes
+#include <glm/glm.hpp>
+#include <glm/gtx/quaternion.hpp>
+
+// Local Includes
+#include "../sharedbase/Entity_fwd.h"
+#include "../sharedbase/Envelope_fwd.h"
+
+// Forward Declarations
+class AsyncDiskOperation;
+class Entity;
+class EntityMap;
+class ScriptEngine;
+
+// Typedefs
+
+namespace SNAPSHOT_RECORD {
+	enum TYPE {
+		FULL = 1, /**< A complete snapshot of every entity. */
+		DELTA, /**< Only the entities that changed since the previous record. */
+		ENTITY, /**< The saved state of a single entity. */
+		REMOVED, /**< The name of an entity that no longer exists. */
+	};
+}
+
+/**
+* \brief Saves the state of every entity in an EntityMap, writing only what changed since the last save.
+* \details A full snapshot is kept in "<path>.snapshot" and the changes made since then are appended to
+* "<path>.journal" as delta records.  Every record carries a sequence number, which only ever goes up, so that a
+* journal left over from before a compaction is never replayed on top of a newer snapshot.  The numbering carries on
+* from the files already on disk, whichever process wrote them.  Once the journal grows past the compaction limits
+* the next delta is folded into a new full snapshot instead.
+* A delta only looks at the entities the EntityMap lists as changed, those held by scripts, and those removed, so its
+* cost follows the number of changes rather than the size of the world.  Each is compared against its saved state, and
+* only written if it differs.
+*/
+class WorldSnapshot {
+public:
+	WorldSnapshot(EntityMap&);
+	~WorldSnapshot();
+	
+	/**
+	* \brief Sets the base path, without extension, of the snapshot and journal files.
+	*/
+	void SetPath(const std::string&);
+	
+	/**
+	* \brief Sets how many delta records or journal bytes are allowed before compacting into a full snapshot.
+	*/
+	void SetCompactionLimits(unsigned int, unsigned int);
+	
+	/**
+	* \brief Writes every entity into a new full snapshot and empties the journal.
+	*/
+	bool SaveFull();
+	
+	/**
+	* \brief Writes a new full snapshot in the background.
+	*/
+	AsyncDiskOperation* SaveFullAsync();
+	
+	/**
+	* \brief Appends the entities that changed since the last save to the journal.
+	*/
+	bool SaveDelta();
+	
+	/**
+	* \brief Loads the full snapshot, replays the journal on top of it, and applies the result to the EntityMap.
+	*/
+	bool Load();
+	
+	/**
+	* \brief Angelscript registration for the snapshot system.
+	*/
+	void RegisterScriptEngine(ScriptEngine* const);
+	
+private:
+	WorldSnapshot(const WorldSnapshot&);
+	WorldSnapshot& operator=(const WorldSnapshot&);
+	
+	struct EntityState {
+		std::string parent;
+		glm::vec3 location;
+		glm::fquat rotation;
+		float scale;
+		
+		bool operator!=(const EntityState& other) const {
+			return this->scale != other.scale || this->location != other.location || this->rotation != other.rotation || this->parent != other.parent;
+		}
+	};
+	typedef std::map<std::string, EntityState> EntityStateMap;
+	
+	/**
+	* \brief Reads the current state of all entities in the EntityMap.
+	*/
+	void CaptureState(EntityStateMap&) const;
+	
+	/**
+	* \brief Reads the current state of an entity.
+	*/
+	static void CaptureState(const Entity&, EntityState&);
+	
+	/**
+	* \brief Finds the highest sequence number in the snapshot and journal files on disk, or 0 if there are none.
+	*/
+	unsigned int ReadLastSequence() const;
+	
+	/**
+	* \brief Drops the changes and removals noted so far, as the saved state already accounts for them.
+	*/
+	void ForgetChanges();
+	
+	/**
+	* @name EntityMap observers
+	* \brief Note the names of entities removed since the last save, and those added back.
+	*/
+	/**@{*/
+	void NoteAdded(EntitySPTR);
+	void NoteRemoved(EntitySPTR);
+	/**@}*/
+	
+	/**
+	* \brief Waits for a background snapshot write to finish.
+	*/
+	bool FinishPendingSave();
+	
+	/**
+	* \brief Builds the ENTITY record for an entity's state.
+	*/
+	static EnvelopeSPTR PackState(const std::string&, const EntityState&);
+	
+	/**
+	* \brief Applies a FULL or DELTA record to the state map.
+	*/
+	bool ApplyRecord(const EnvelopeSPTR&, EntityStateMap&) const;
+	
+	EntityMap& entities;
+	std::string path;
+	
+	EntityStateMap saved; /**< The state of the world as of the last record written or read. */
+	std::set<std::string> removedNames; /**< Entities removed since the last record written or read. */
+	std::vector<EntitySPTR> changedEntities; /**< Scratch space for SaveDelta, kept to save reallocating it every save. */
+	unsigned int sequence; /**< Highest sequence number used so far, in memory or on disk.  Never goes down. */
+	bool needsFull; /**< Whether the saved state can't be built on, so the next save must be a full one. */
+	
+	unsigned int journalRecords; /**< How many delta records the journal currently holds. */
+	unsigned int journalBytes; /**< How large the journal currently is. */
+	unsigned int maxJournalRecords;
+	unsigned int maxJournalBytes;
+	
+	AsyncDiskOperation* pendingSave; /**< The background full snapshot write, if any. */
+};
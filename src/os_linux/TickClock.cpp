@@ -0,0 +1,125 @@
+/**
+* \file
+* \author agent
+* \date 2026-10-19
+* \brief Fixed rate tick pacing for dedicated servers
+* 
+*/
+
+#include "TickClock.h"
+
+// Standard Includes
+#include <cerrno>
+
+// Library Includes
+#include <boost/lexical_cast.hpp>
+
+// Local Includes
+#include "../sharedbase/EventLogger.h"
+
+// Local Constants
+const long long NANOSECONDS_PER_SECOND = 1000000000LL;
+
+// Local Functions
+namespace {
+	long long ToNanoseconds(const struct timespec& time) {
+		return time.tv_sec * NANOSECONDS_PER_SECOND + time.tv_nsec;
+	}
+	
+	struct timespec FromNanoseconds(long long nanoseconds) {
+		struct timespec time;
+		time.tv_sec = nanoseconds / NANOSECONDS_PER_SECOND;
+		time.tv_nsec = nanoseconds % NANOSECONDS_PER_SECOND;
+		return time;
+	}
+	
+	std::string ToMilliseconds(long long nanoseconds) {
+		return boost::lexical_cast<std::string>(nanoseconds / 1000000.0) + "ms";
+	}
+}
+
+// Class methods in the order they are defined within the class header
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+TickClock::TickClock(double rate) :
+	period(static_cast<long long>(NANOSECONDS_PER_SECOND / rate)),
+	ticks(0),
+	overruns(0),
+	skipped(0),
+	busyTotal(0),
+	busyMax(0),
+	overrunMax(0)
+	{
+	clock_gettime(CLOCK_MONOTONIC, &this->tickStart);
+	this->deadline = FromNanoseconds(ToNanoseconds(this->tickStart) + this->period);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool TickClock::WaitForNextTick() {
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	
+	long long now_ns = ToNanoseconds(now);
+	long long deadline_ns = ToNanoseconds(this->deadline);
+	long long busy = now_ns - ToNanoseconds(this->tickStart);
+	bool on_time = true;
+	
+	++this->ticks;
+	this->busyTotal += busy;
+	if (busy > this->busyMax) {
+		this->busyMax = busy;
+	}
+	
+	if (now_ns > deadline_ns) {
+		long long late = now_ns - deadline_ns;
+		
+		on_time = false;
+		++this->overruns;
+		if (late > this->overrunMax) {
+			this->overrunMax = late;
+		}
+		
+		if (late >= this->period) {
+			// Too far behind to catch up: drop the missed ticks and start counting from now.
+			this->skipped += static_cast<unsigned long>(late / this->period);
+			deadline_ns = now_ns;
+		}
+	}
+	else {
+		// Absolute deadlines don't drift, however long the tick took.  Restart if interrupted.
+		while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &this->deadline, nullptr) == EINTR) {
+		}
+	}
+	
+	clock_gettime(CLOCK_MONOTONIC, &this->tickStart);
+	this->deadline = FromNanoseconds(deadline_ns + this->period);
+	
+	return on_time;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void TickClock::LogStatistics() {
+	if (this->ticks == 0) {
+		return;
+	}
+	
+	LOG(LOG_PRIORITY::INFO, "Ticks: " + boost::lexical_cast<std::string>(this->ticks) +
+		", overruns: " + boost::lexical_cast<std::string>(this->overruns) +
+		", skipped: " + boost::lexical_cast<std::string>(this->skipped) +
+		", mean tick: " + ToMilliseconds(this->busyTotal / this->ticks) +
+		", max tick: " + ToMilliseconds(this->busyMax) +
+		", max overrun: " + ToMilliseconds(this->overrunMax) +
+		", budget: " + ToMilliseconds(this->period));
+	
+	this->ticks = 0;
+	this->overruns = 0;
+	this->skipped = 0;
+	this->busyTotal = 0;
+	this->busyMax = 0;
+	this->overrunMax = 0;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+unsigned long TickClock::GetTickCount() const {
+	return this->ticks;
+}
@@ -0,0 +1,55 @@
+/**
+ * \file
+ * \author agent
+ * \date 2026-10-19
+ * \brief Fixed rate tick pacing for dedicated servers
+*/
+#pragma once
+
+// Standard Includes
+#include <ctime>
+
+// Library Includes
+
+// Local Includes
+
+// Forward Declarations
+
+/**
+ * \brief Paces a loop at a fixed number of ticks per second using absolute deadlines.
+ * \details Sleeping until an absolute deadline with clock_nanosleep keeps the rate from drifting no
+ * matter how long each tick takes, and costs no CPU while waiting.  Ticks that finish after their
+ * deadline are counted as overruns; the loop then continues immediately to catch up, or drops the
+ * missed ticks if it has fallen more than a whole tick behind.
+ */
+class TickClock {
+public:
+	TickClock(double);
+	
+	/**
+	 * \brief Sleeps until the next tick is due.  Returns false if the tick that just ran overran its deadline.
+	 */
+	bool WaitForNextTick();
+	
+	/**
+	 * \brief Writes the statistics gathered since the last call to the log, then resets them.
+	 */
+	void LogStatistics();
+	
+	/**
+	 * \brief Returns how many ticks ran since the statistics were last reset.
+	 */
+	unsigned long GetTickCount() const;
+	
+private:
+	long long period; ///< Nanoseconds per tick.
+	struct timespec deadline; ///< When the next tick is due.
+	struct timespec tickStart; ///< When the current tick started running.
+	
+	unsigned long ticks;
+	unsigned long overruns; ///< Ticks that finished after their deadline.
+	unsigned long skipped; ///< Ticks dropped because the loop fell too far behind.
+	long long busyTotal; ///< Nanoseconds spent running ticks.
+	long long busyMax; ///< Longest single tick in nanoseconds.
+	long long overrunMax; ///< Furthest past a deadline a tick finished, in nanoseconds.
+};
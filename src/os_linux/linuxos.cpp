@@ -0,0 +1,278 @@
+/**
+* \file
+* \author agent
+* \date 2026-10-19
+* \brief Implements all Linux specific code
+* 
+*/
+
+#include "linuxos.h"
+
+// Standard Includes
+#include <cerrno>
+#include <csignal>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <pwd.h>
+#include <sys/epoll.h>
+#include <sys/signalfd.h>
+#include <unistd.h>
+
+// Library Includes
+
+// Local Includes
+#include "../sharedbase/EventLogger.h"
+#include "../enginecore/ScriptExecutor.h"
+#include "../enginecore/ScriptEngine.h"
+
+// Local Functions
+namespace {
+	std::string GetEnvironment(const char* name) {
+		const char* value = std::getenv(name);
+		return (value != nullptr) ? value : "";
+	}
+	
+	std::string GetHomeDirectory() {
+		std::string home = GetEnvironment("HOME");
+		
+		if (home.empty()) {
+			struct passwd* entry = getpwuid(getuid());
+			if (entry != nullptr && entry->pw_dir != nullptr) {
+				home = entry->pw_dir;
+			}
+		}
+		
+		return home;
+	}
+	
+	/**
+	 * \brief Looks up one of the XDG user directories, such as "XDG_DOCUMENTS_DIR", in the environment or in user-dirs.dirs.
+	 */
+	std::string GetUserDirectory(const std::string& name, const std::string& fallback) {
+		std::string home = GetHomeDirectory();
+		std::string value = GetEnvironment(name.c_str());
+		
+		if (value.empty()) {
+			std::string config_home = GetEnvironment("XDG_CONFIG_HOME");
+			if (config_home.empty()) {
+				config_home = home + "/.config";
+			}
+			
+			// Lines look like: XDG_DOCUMENTS_DIR="$HOME/Documents"
+			std::ifstream dirs((config_home + "/user-dirs.dirs").c_str());
+			std::string line;
+			while (std::getline(dirs, line)) {
+				if (line.compare(0, name.size() + 1, name + "=") == 0) {
+					value = line.substr(name.size() + 1);
+					
+					if (value.size() >= 2 && value[0] == '"' && value[value.size() - 1] == '"') {
+						value = value.substr(1, value.size() - 2);
+					}
+					break;
+				}
+			}
+		}
+		
+		if (value.compare(0, 5, "$HOME") == 0) {
+			value = home + value.substr(5);
+		}
+		
+		return value.empty() ? home + "/" + fallback : value;
+	}
+}
+
+// Static class member initialization
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void linuxos::Make() {
+	if (!OSInterface::HasOS()) {
+		OSInterface::SetOS(OSInterfaceSPTR(new linuxos()));
+	}
+}
+
+// Class methods in the order they are defined within the class header
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+linuxos::linuxos() :
+	epollFD(-1),
+	signalFD(-1),
+	consoleOpen(false),
+	messageWait(1)
+	{
+	this->running = true;
+	
+	// Route the termination signals through a descriptor instead of handlers.
+	// *NOTE: This must happen before any other thread is started so that they all inherit the mask.
+	sigset_t signals;
+	sigemptyset(&signals);
+	sigaddset(&signals, SIGINT);
+	sigaddset(&signals, SIGTERM);
+	sigaddset(&signals, SIGHUP);
+	pthread_sigmask(SIG_BLOCK, &signals, nullptr);
+	
+	this->signalFD = signalfd(-1, &signals, SFD_NONBLOCK | SFD_CLOEXEC);
+	this->epollFD = epoll_create1(EPOLL_CLOEXEC);
+	
+	if (this->epollFD >= 0) {
+		struct epoll_event event;
+		std::memset(&event, 0, sizeof(event));
+		event.events = EPOLLIN;
+		
+		if (this->signalFD >= 0) {
+			event.data.fd = this->signalFD;
+			epoll_ctl(this->epollFD, EPOLL_CTL_ADD, this->signalFD, &event);
+		}
+		
+		// Fails harmlessly when stdin is a regular file or /dev/null, which epoll can't watch.
+		event.data.fd = STDIN_FILENO;
+		this->consoleOpen = (epoll_ctl(this->epollFD, EPOLL_CTL_ADD, STDIN_FILENO, &event) == 0);
+	}
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+linuxos::~linuxos() {
+	if (this->epollFD >= 0) {
+		close(this->epollFD);
+	}
+	if (this->signalFD >= 0) {
+		close(this->signalFD);
+	}
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+EventLogger* linuxos::GetLogger() {
+	return EventLogger::GetEventLogger();
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void linuxos::SetMessageWait(int milliseconds) {
+	this->messageWait = milliseconds;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void linuxos::ReadConsole() {
+	char buffer[1024];
+	ssize_t count = read(STDIN_FILENO, buffer, sizeof(buffer));
+	
+	if (count <= 0) {
+		if (count == 0 || (errno != EAGAIN && errno != EINTR)) {
+			// End of input: stop watching so epoll doesn't keep reporting it.
+			epoll_ctl(this->epollFD, EPOLL_CTL_DEL, STDIN_FILENO, nullptr);
+			this->consoleOpen = false;
+		}
+		return;
+	}
+	
+	this->consoleBuffer.append(buffer, count);
+	
+	std::string::size_type newline;
+	while ((newline = this->consoleBuffer.find('\n')) != std::string::npos) {
+		std::string line = this->consoleBuffer.substr(0, newline);
+		this->consoleBuffer.erase(0, newline + 1);
+		
+		if (this->inputEngine == nullptr) {
+			continue;
+		}
+		
+		int as_status = 0;
+		ScriptExecutor* exec = this->inputEngine->ScriptExecutorFactory();
+		as_status = exec->PrepareFunction(std::string("void consoleInput(const string &in)"), std::string("enginecore"));
+		if (as_status >= 0) {
+			as_status = exec->SetFunctionParam(0, &line);
+		}
+		if (as_status < 0 || exec->ExecuteFunction() != asEXECUTION_FINISHED) {
+			// If it fails, it might mean there isn't a function to handle console input. This might not be a showstopper though.
+		}
+		delete exec;
+	}
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+boost::any linuxos::CreateGUIWindow(int width, int height, std::string title, WINDOW_FLAGS flags) {
+	LOG(LOG_PRIORITY::CONFIG, "Running headless - not creating the window '" + title + "'.");
+	
+	return boost::any();
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void linuxos::ShowInfo(std::string text, std::string caption) {
+	std::cerr << caption << ": " << text << std::endl;
+	LOG(LOG_PRIORITY::INFO, caption + ": " + text);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void linuxos::ShowWarning(std::string text, std::string caption) {
+	std::cerr << caption << ": " << text << std::endl;
+	LOG(LOG_PRIORITY::WARN, caption + ": " + text);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void linuxos::ShowError(std::string text, std::string caption) {
+	std::cerr << caption << ": " << text << std::endl;
+	LOG(LOG_PRIORITY::ERR, caption + ": " + text);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void linuxos::RouteMessages() {
+	if (this->epollFD < 0) {
+		return;
+	}
+	
+	struct epoll_event events[4];
+	int count = epoll_wait(this->epollFD, events, 4, this->messageWait);
+	
+	for (int index = 0; index < count; ++index) {
+		if (events[index].data.fd == this->signalFD) {
+			struct signalfd_siginfo info;
+			
+			while (read(this->signalFD, &info, sizeof(info)) == sizeof(info)) {
+				LOG(LOG_PRIORITY::FLOW, "Received signal " + std::string(strsignal(info.ssi_signo)) + ", shutting down.");
+				this->running = false;
+			}
+		}
+		else if (events[index].data.fd == STDIN_FILENO) {
+			this->ReadConsole();
+		}
+	}
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+std::string linuxos::GetPath(SYSTEM_DIRS::TYPE dir_id) {
+	switch (dir_id) {
+		case SYSTEM_DIRS::USER: {
+			std::string data_home = GetEnvironment("XDG_DATA_HOME");
+			return data_home.empty() ? GetHomeDirectory() + "/.local/share" : data_home;
+		} break;
+		case SYSTEM_DIRS::DOCUMENTS:
+			return GetUserDirectory("XDG_DOCUMENTS_DIR", "Documents");
+		break;
+		case SYSTEM_DIRS::PICTURES:
+			return GetUserDirectory("XDG_PICTURES_DIR", "Pictures");
+		break;
+		case SYSTEM_DIRS::MUSIC:
+			return GetUserDirectory("XDG_MUSIC_DIR", "Music");
+		break;
+		case SYSTEM_DIRS::VIDEO:
+			return GetUserDirectory("XDG_VIDEOS_DIR", "Videos");
+		break;
+		case SYSTEM_DIRS::DESKTOP:
+			return GetUserDirectory("XDG_DESKTOP_DIR", "Desktop");
+		break;
+		case SYSTEM_DIRS::EXECUTABLE: {
+			char path[4096];
+			ssize_t length = readlink("/proc/self/exe", path, sizeof(path) - 1);
+			
+			if (length <= 0) {
+				return "";
+			}
+			
+			std::string executable(path, length);
+			return executable.substr(0, executable.rfind('/'));
+		} break;
+		default:
+			return "";
+		break;
+	}
+}
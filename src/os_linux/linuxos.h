@@ -0,0 +1,74 @@
+/**
+ * \file
+ * \author agent
+ * \date 2026-10-19
+ * \brief Linux specific code for running the engine headless
+*/
+#pragma once
+
+// Standard Includes
+#include <string>
+
+// Library Includes
+
+// Local Includes
+#include "../sharedbase/OSInterface.h"
+
+// Forward Declarations
+
+/**
+ * \brief Headless OSInterface for Linux servers.
+ * \details There is no window: messages go to stderr and the log, and RouteMessages waits on
+ * termination signals and lines typed on stdin via epoll.  Lines read from stdin are passed to the
+ * script function "void consoleInput(const string &in)" of the input engine, if its game script defines it.
+ *
+ * *NOTE: The class is not named "linux" as GCC predefines that as a macro in the GNU dialects.
+ */
+class linuxos : public OSInterface {
+public:
+	static void Make();
+	
+public:
+	~linuxos();
+	
+	bool IsRunning() {
+		return this->running;
+	}
+	
+	bool IsHeadless() {
+		return true;
+	}
+	
+	EventLogger* GetLogger();
+	
+	/**
+	 * \brief Sets how long, in milliseconds, RouteMessages may wait for a signal or input before returning.  -1 waits until there is one.
+	 * \details The default of 1 suits the variable rate loop: the engine has to be updated again whether or not any
+	 * input comes, so RouteMessages can't block until there is some, and the short wait keeps the loop from spinning a
+	 * core while idle.  With a fixed tick rate the loop sleeps between ticks instead, and the wait is set to 0.
+	 */
+	void SetMessageWait(int);
+	
+private:
+	linuxos();
+	
+	/**
+	 * \brief Reads whatever is waiting on stdin and hands each complete line to the script.
+	 */
+	void ReadConsole();
+	
+private: // Overrides
+	virtual boost::any CreateGUIWindow(int, int, std::string, WINDOW_FLAGS = WINDOW_OUTER_SIZE);
+	virtual void ShowInfo(std::string, std::string = NLS_I18N::TITLE_INFO);
+	virtual void ShowWarning(std::string, std::string = NLS_I18N::TITLE_WARNING);
+	virtual void ShowError(std::string, std::string = NLS_I18N::TITLE_CRITICAL);
+	virtual void RouteMessages();
+	virtual std::string GetPath(SYSTEM_DIRS::TYPE);
+	
+private:
+	int epollFD; ///< Waits on the signal and stdin descriptors.
+	int signalFD; ///< Delivers SIGINT, SIGTERM, and SIGHUP as readable events.
+	bool consoleOpen; ///< Whether stdin is still being watched.
+	int messageWait; ///< Milliseconds RouteMessages may block for, or -1 for until there is a signal or input.
+	std::string consoleBuffer; ///< Partial line read from stdin.
+};
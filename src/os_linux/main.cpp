@@ -0,0 +1,61 @@
+#include <boost/lexical_cast.hpp>
+#include <boost/scoped_ptr.hpp>
+
+#include "linuxos.h"
+#include "TickClock.h"
+#include "../enginecore/EngineCore.h"
+#include "../sharedbase/EventLogger.h"
+
+int main(int argc, char* argv[]) {
+	// Made before anything can log, and owned here so that the log is closed off once the engine is done with it.
+	boost::scoped_ptr<EventLogger> elog(EventLogger::CreateEventLogger());
+	EventLogger::SetEventLogger(elog.get());
+
+	linuxos::Make();
+	OSInterfaceSPTR operating_system(OSInterface::GetOSPointer());
+
+	std::string bin_dir(operating_system->GetPath(SYSTEM_DIRS::EXECUTABLE));
+
+	// Log to the config log location.
+	EventLogger::module = "Main";
+	elog->SetLogFile(bin_dir + "/" + NLS_ENGINE_DEFAULT_LOG_FILE);
+	LOG(LOG_PRIORITY::FLOW, "Log file created!");
+
+	EngineCore engine(operating_system);
+	engine.AttachInput(); // The one engine, run on this thread along with RouteMessages.
+	if (!engine.StartUp()) {
+		LOG(LOG_PRIORITY::FLOW, "Engine startup failed.");
+	}
+
+	double tick_rate = engine.GetTickRate();
+	if (tick_rate > 0.0) {
+		// Dedicated server mode: never block on messages, sleep between ticks instead.
+		std::static_pointer_cast<linuxos>(operating_system)->SetMessageWait(0);
+		TickClock clock(tick_rate);
+		unsigned long report_interval = static_cast<unsigned long>(tick_rate * 60.0) + 1; // About once a minute.
+
+		LOG(LOG_PRIORITY::FLOW, "Running at a fixed " + boost::lexical_cast<std::string>(tick_rate) + " ticks per second.");
+
+		while(engine.IsRunning() && operating_system->IsRunning()) {
+			operating_system->RouteMessages();
+			engine.Update();
+			clock.WaitForNextTick();
+
+			if (clock.GetTickCount() >= report_interval) {
+				clock.LogStatistics();
+			}
+		}
+
+		clock.LogStatistics();
+	}
+	else {
+		// *NOTE: RouteMessages only waits the default 1 ms for input: see linuxos::SetMessageWait for why it can't block.
+		while(engine.IsRunning() && operating_system->IsRunning()) {
+			operating_system->RouteMessages();
+			engine.Update();
+		}
+	}
+
+	engine.Shutdown();
+	return 0;
+}
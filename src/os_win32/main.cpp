@@ -16,6 +16,7 @@ int WINAPI WinMain( __in HINSTANCE hInstance, __in_opt HINSTANCE hPrevInstance,
 	LOG(LOG_PRIORITY::FLOW, "Log file created!");
 
 	EngineCore engine(operating_system);
+	engine.AttachInput(); // The one engine, run on this thread along with RouteMessages.
 	if (!engine.StartUp()) {
 		LOG(LOG_PRIORITY::FLOW, "Engine startup failed.");
 	}
@@ -20,7 +20,6 @@
 #include "../enginecore/ScriptEngine.h"
 
 // Static class member initialization
-ScriptEngine* g_engine; // *HACK, used for testing input in script.
 
 void win32::Make() {
 	if (!OSInterface::HasOS()) {
@@ -92,9 +91,9 @@ void win32::RouteMessages() {
 		if (msg.message == WM_QUIT) {
 			this->running = false;
 			break;
-		} else if (msg.message == WM_KEYUP) {
+		} else if (msg.message == WM_KEYUP && this->inputEngine != nullptr) {
 			int as_status = 0;
-			ScriptExecutor* exec = this->scriptEngine->ScriptExecutorFactory();
+			ScriptExecutor* exec = this->inputEngine->ScriptExecutorFactory();
 			as_status = exec->PrepareFunction(std::string("void keyUp(uint)"), std::string("enginecore"));
 			as_status = exec->SetFunctionParam(0, msg.wParam);
 			if (as_status < 0 || exec->ExecuteFunction() != asEXECUTION_FINISHED) {
@@ -251,29 +250,3 @@ std::string win32::GetPath(SYSTEM_DIRS::TYPE dir_id) {
 		return "";
 	}
 }
-
-void win32::RegisterScriptEngine( ScriptEngine* const engine ) {
-	this->scriptEngine = engine;
-	asIScriptEngine* const asEngine = this->scriptEngine->GetasIScriptEngine();
-	int ret = 0;
-
-	// TODO: Move this block to OSInterface proper
-	ret = asEngine->SetDefaultNamespace("Engine"); assert(ret >= 0);
-	ret = asEngine->RegisterEnum("SYSTEM_DIRS"); assert(ret >= 0);
-	ret = asEngine->RegisterEnumValue("SYSTEM_DIRS", "USER", ::SYSTEM_DIRS::USER); assert(ret >= 0);
-	ret = asEngine->RegisterEnumValue("SYSTEM_DIRS", "DOCUMENTS", ::SYSTEM_DIRS::DOCUMENTS); assert(ret >= 0);
-	ret = asEngine->RegisterEnumValue("SYSTEM_DIRS", "PICTURES", ::SYSTEM_DIRS::PICTURES); assert(ret >= 0);
-	ret = asEngine->RegisterEnumValue("SYSTEM_DIRS", "MUSIC", ::SYSTEM_DIRS::MUSIC); assert(ret >= 0);
-	ret = asEngine->RegisterEnumValue("SYSTEM_DIRS", "VIDEO", ::SYSTEM_DIRS::VIDEO); assert(ret >= 0);
-	ret = asEngine->RegisterEnumValue("SYSTEM_DIRS", "DESKTOP", ::SYSTEM_DIRS::DESKTOP); assert(ret >= 0);
-	ret = asEngine->RegisterEnumValue("SYSTEM_DIRS", "EXECUTABLE", ::SYSTEM_DIRS::EXECUTABLE); assert(ret >= 0);
-	ret = asEngine->SetDefaultNamespace(""); assert(ret >= 0);
-
-
-	ret = asEngine->RegisterObjectType("OSInterface", 0, asOBJ_REF | asOBJ_NOHANDLE ); assert(ret >= 0);
-	ret = asEngine->RegisterGlobalProperty("OSInterface OS", this); assert(ret >= 0);
-	ret = asEngine->RegisterObjectMethod("OSInterface", "string GetPath(SYSTEM_DIRS)", asMETHOD(win32, GetPath), asCALL_THISCALL); assert(ret >= 0);
-	ret = asEngine->RegisterObjectMethod("OSInterface", "void ShowInfo(string, string)", asMETHOD(win32, ShowInfo), asCALL_THISCALL); assert(ret >= 0);
-	ret = asEngine->RegisterObjectMethod("OSInterface", "void ShowWarning(string, string)", asMETHOD(win32, ShowWarning), asCALL_THISCALL); assert(ret >= 0);
-	ret = asEngine->RegisterObjectMethod("OSInterface", "void ShowError(string, string)", asMETHOD(win32, ShowError), asCALL_THISCALL); assert(ret >= 0);
-}
@@ -36,8 +36,6 @@ public:
 
 	EventLogger* GetLogger();
 	
-	void RegisterScriptEngine(ScriptEngine* const engine);
-	
 private:
 	win32() { this->running = true; }
 	
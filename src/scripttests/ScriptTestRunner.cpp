@@ -0,0 +1,250 @@
+/**
+* \file
+* \author agent
+* \date 2026-10-19
+* \brief Runs the script unit tests in parallel, one ScriptEngine per worker thread.
+*/
+
+#include "ScriptTestRunner.h"
+
+// Standard Includes
+#include <iomanip>
+#include <iostream>
+#include <set>
+
+// Library Includes
+#include <angelscript.h>
+#include <boost/bind.hpp>
+#include <boost/chrono.hpp>
+#include <boost/scoped_ptr.hpp>
+#include <boost/thread/thread.hpp>
+
+// Local Includes
+#include "../sharedbase/EventLogger.h"
+#include "../enginecore/ScriptEngine.h"
+#include "../enginecore/ScriptExecutor.h"
+
+// Local Types
+namespace {
+	const std::string SCRIPT_MODULE("enginecore");
+	const std::string TEST_PREFIX("Test");
+	
+	double MillisecondsSince(const boost::chrono::steady_clock::time_point& start) {
+		return boost::chrono::duration_cast<boost::chrono::duration<double, boost::milli> >(boost::chrono::steady_clock::now() - start).count();
+	}
+}
+
+namespace ScriptTest {
+	Runner::Runner(const std::string& script_file) : scriptFile(script_file), discoveryEngine(nullptr), nextTest(0) {
+	}
+	
+	Runner::~Runner() {
+		delete this->discoveryEngine;
+	}
+	
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+	bool Runner::Discover(const std::vector<std::string>& filters) {
+		this->tests.clear();
+		
+		delete this->discoveryEngine;
+		this->discoveryEngine = Runner::CreateEngine();
+		
+		if (this->discoveryEngine->LoadScriptFile(this->scriptFile) != SCRIPT_STATUS::LOAD_OK) {
+			LOG(LOG_PRIORITY::ERR, "Unable to build the script unit tests from " + this->scriptFile);
+			return false;
+		}
+		
+		asIScriptModule* module = this->discoveryEngine->GetasIScriptEngine()->GetModule(SCRIPT_MODULE.c_str());
+		
+		// Find the test sets first, as a test can be declared before the ExecuteTests() of its set.
+		std::set<std::string> test_sets;
+		for (asUINT index = 0; index < module->GetFunctionCount(); ++index) {
+			asIScriptFunction* func = module->GetFunctionByIndex(index);
+			
+			if (std::string(func->GetName()) == "ExecuteTests" && func->GetNamespace() != nullptr && func->GetNamespace()[0] != '\0') {
+				test_sets.insert(func->GetNamespace());
+			}
+		}
+		
+		for (asUINT index = 0; index < module->GetFunctionCount(); ++index) {
+			asIScriptFunction* func = module->GetFunctionByIndex(index);
+			
+			if (func->GetNamespace() == nullptr || test_sets.count(func->GetNamespace()) == 0) {
+				continue;
+			}
+			
+			TestCase test;
+			test.testSet = func->GetNamespace();
+			test.name = func->GetName();
+			
+			if (test.name.compare(0, TEST_PREFIX.size(), TEST_PREFIX) != 0 || func->GetReturnTypeId() != asTYPEID_VOID || func->GetParamCount() != 0) {
+				continue;
+			}
+			
+			bool selected = filters.empty();
+			for (std::vector<std::string>::const_iterator filter_it = filters.begin(); !selected && filter_it != filters.end(); ++filter_it) {
+				selected = (test.GetFullName().compare(0, filter_it->size(), *filter_it) == 0);
+			}
+			
+			if (selected) {
+				this->tests.push_back(test);
+			}
+		}
+		
+		this->results.assign(this->tests.size(), Result());
+		
+		return true;
+	}
+	
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+	unsigned int Runner::Run(unsigned int workers) {
+		if (workers > this->tests.size()) {
+			workers = static_cast<unsigned int>(this->tests.size());
+		}
+		if (workers == 0) {
+			workers = 1;
+		}
+		
+		std::cout << "[==========] Running " << this->tests.size() << " tests on " << workers << " threads." << std::endl;
+		
+		boost::chrono::steady_clock::time_point start = boost::chrono::steady_clock::now();
+		
+		// *NOTE: Engines are created here on the main thread, but each builds the script on its own thread.
+		std::vector<ScriptEngine*> engines;
+		engines.push_back(this->discoveryEngine != nullptr ? this->discoveryEngine : Runner::CreateEngine());
+		bool first_built = (this->discoveryEngine != nullptr);
+		this->discoveryEngine = nullptr;
+		
+		while (engines.size() < workers) {
+			engines.push_back(Runner::CreateEngine());
+		}
+		
+		this->nextTest = 0;
+		
+		boost::thread_group threads;
+		for (unsigned int worker = 0; worker < workers; ++worker) {
+			threads.create_thread(boost::bind(&Runner::Work, this, engines[worker], worker, worker == 0 && first_built));
+		}
+		threads.join_all();
+		
+		for (std::vector<ScriptEngine*>::iterator engine_it = engines.begin(); engine_it != engines.end(); ++engine_it) {
+			delete *engine_it;
+		}
+		
+		double elapsed = MillisecondsSince(start);
+		
+		// Summarize.
+		unsigned int passed = 0;
+		unsigned int assertions = 0;
+		double test_time = 0.0;
+		std::vector<std::string> failures;
+		
+		for (std::size_t index = 0; index < this->tests.size(); ++index) {
+			const Result& result = this->results[index];
+			
+			assertions += result.assertions;
+			test_time += result.milliseconds;
+			
+			if (result.passed) {
+				++passed;
+			}
+			else {
+				failures.push_back(this->tests[index].GetFullName() + (result.ran ? "" : " (not run)"));
+			}
+		}
+		
+		std::cout << std::fixed << std::setprecision(2);
+		std::cout << "[==========] " << this->tests.size() << " tests ran, " << passed << " passed, " << assertions << " assertions, "
+			<< elapsed << " ms elapsed (" << test_time << " ms of tests)." << std::endl;
+		for (std::vector<std::string>::iterator failure_it = failures.begin(); failure_it != failures.end(); ++failure_it) {
+			std::cout << "[  FAILED  ] " << *failure_it << std::endl;
+		}
+		
+		return static_cast<unsigned int>(failures.size());
+	}
+	
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+	ScriptEngine* Runner::CreateEngine() {
+		ScriptEngine* engine = new ScriptEngine();
+		EventLogger::RegisterScriptEngine(engine);
+		return engine;
+	}
+	
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+	void Runner::Work(ScriptEngine* engine, unsigned int worker, bool built) {
+		if (!built && engine->LoadScriptFile(this->scriptFile) != SCRIPT_STATUS::LOAD_OK) {
+			LOG(LOG_PRIORITY::ERR, "Worker was unable to build the script unit tests from " + this->scriptFile);
+			asThreadCleanup();
+			return;
+		}
+		
+		asIScriptModule* module = engine->GetasIScriptEngine()->GetModule(SCRIPT_MODULE.c_str());
+		
+		// The framework's status globals, reset along with every other global before each test.
+		module->SetDefaultNamespace("UnitTest");
+		int status_index = module->GetGlobalVarIndexByName("gTestStatus");
+		int count_index = module->GetGlobalVarIndexByName("gAssertionCount");
+		module->SetDefaultNamespace("");
+		
+		if (status_index < 0 || count_index < 0) {
+			LOG(LOG_PRIORITY::ERR, "The script unit tests are missing UnitTest::gTestStatus or UnitTest::gAssertionCount.");
+			asThreadCleanup();
+			return;
+		}
+		
+		boost::scoped_ptr<ScriptExecutor> exec(engine->ScriptExecutorFactory());
+		
+		unsigned int index;
+		while (this->TakeNextTest(index)) {
+			const TestCase& test = this->tests[index];
+			Result& result = this->results[index];
+			
+			module->SetDefaultNamespace(test.testSet.c_str());
+			asIScriptFunction* func = module->GetFunctionByDecl(("void " + test.name + "()").c_str());
+			module->SetDefaultNamespace("");
+			
+			module->ResetGlobalVars();
+			
+			boost::chrono::steady_clock::time_point start = boost::chrono::steady_clock::now();
+			int ret = exec->PrepareFunction(func);
+			if (ret >= 0) {
+				ret = exec->ExecuteFunction();
+			}
+			result.milliseconds = MillisecondsSince(start);
+			
+			bool status = *static_cast<bool*>(module->GetAddressOfGlobalVar(status_index));
+			
+			result.ran = true;
+			result.worker = worker;
+			result.assertions = *static_cast<asUINT*>(module->GetAddressOfGlobalVar(count_index));
+			result.passed = (ret == asEXECUTION_FINISHED) && status; // An ASSERT_ failure aborts the test.
+			
+			this->Report(index);
+		}
+		
+		exec.reset(); // AngelScript's per thread data is freed last.
+		asThreadCleanup();
+	}
+	
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+	bool Runner::TakeNextTest(unsigned int& index) {
+		boost::mutex::scoped_lock lock(this->queueMutex);
+		
+		if (this->nextTest >= this->tests.size()) {
+			return false;
+		}
+		
+		index = this->nextTest++;
+		return true;
+	}
+	
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+	void Runner::Report(unsigned int index) {
+		const Result& result = this->results[index];
+		
+		boost::mutex::scoped_lock lock(this->reportMutex);
+		
+		std::cout << (result.passed ? "[       OK ] " : "[  FAILED  ] ") << this->tests[index].GetFullName()
+			<< " (" << result.assertions << " assertions, " << std::fixed << std::setprecision(3) << result.milliseconds << " ms, thread " << result.worker << ")" << std::endl;
+	}
+}
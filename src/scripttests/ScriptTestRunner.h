@@ -0,0 +1,99 @@
+/**
+* \file
+* \author agent
+* \date 2026-10-19
+* \brief Runs the script unit tests in parallel, one ScriptEngine per worker thread.
+*
+* A test set is a script namespace that has a "void ExecuteTests()".  Every "void Test*()" in such a namespace is one
+* test.  Tests are handed out to the workers one at a time, and each is timed and has its assertions counted through the
+* UnitTest::gTestStatus and UnitTest::gAssertionCount globals of ScriptUnitTests/TestFramework.as.
+*/
+#pragma once
+
+// Standard Includes
+#include <string>
+#include <vector>
+
+// Library Includes
+#include <boost/thread/mutex.hpp>
+
+// Local Includes
+
+// Forward Declarations
+class ScriptEngine;
+
+// Typedefs
+
+namespace ScriptTest {
+	/**
+	* \brief A discovered test.
+	*/
+	struct TestCase {
+		std::string testSet; ///< Namespace the test is in.
+		std::string name; ///< Name of the test function.
+		
+		std::string GetFullName() const { return this->testSet + "." + this->name; }
+	};
+	
+	/**
+	* \brief The outcome of one test.
+	*/
+	struct Result {
+		Result() : ran(false), passed(false), assertions(0), milliseconds(0.0), worker(0) { }
+		
+		bool ran;
+		bool passed;
+		unsigned int assertions; ///< Assertions checked, passed or not.
+		double milliseconds; ///< Wall time of the test itself, not counting setup.
+		unsigned int worker; ///< Which worker ran it.
+	};
+	
+	class Runner {
+	public:
+		/**
+		* \param[in] script_file The script to build in each worker: it must include every test set, normally ScriptUnitTests/TestFramework.as.
+		*/
+		Runner(const std::string& script_file);
+		~Runner();
+		
+		/**
+		* \brief Builds the script and finds the tests in it.
+		* \param[in] filters Only tests whose "TestSet.Name" starts with one of these are kept.  Empty keeps them all.
+		* \return false if the script failed to build.
+		*/
+		bool Discover(const std::vector<std::string>& filters);
+		
+		/**
+		* \brief Runs the discovered tests over the given number of worker threads, printing each result as it comes in.
+		* \return The number of tests that failed.
+		*/
+		unsigned int Run(unsigned int workers);
+		
+		const std::vector<TestCase>& GetTests() const { return this->tests; }
+		const std::vector<Result>& GetResults() const { return this->results; }
+	
+	private:
+		/// Creates a ScriptEngine ready to load the tests.  Only call this on the main thread: engine creation isn't thread safe.
+		static ScriptEngine* CreateEngine();
+		
+		/// Builds the script, if not yet built, then runs tests until none are left.
+		void Work(ScriptEngine* engine, unsigned int worker, bool built);
+		
+		/// Hands out the index of the next test to run, or returns false once all have been taken.
+		bool TakeNextTest(unsigned int& index);
+		
+		void Report(unsigned int index);
+	
+	private:
+		std::string scriptFile;
+		std::vector<TestCase> tests;
+		std::vector<Result> results;
+		
+		ScriptEngine* discoveryEngine; ///< Engine built during discovery, reused by the first worker.
+		
+		boost::mutex queueMutex;
+		unsigned int nextTest;
+		
+		boost::mutex reportMutex; ///< Keeps the lines of concurrent reports apart.
+	};
+}
@@ -0,0 +1,79 @@
+/**
+* \file
+* \author agent
+* \date 2026-10-19
+* \brief Entry point of the script unit test runner.
+*
+* Usage: nlsscripttest [--jobs <n>] [--script <file.as>] [--log <file>] [TestSet[.Name] ...]
+* Runs every script test, or only those whose names start with one of the given filters, on as many threads as there
+* are cores unless told otherwise.  Exits non-zero if any test failed.
+*/
+
+// Standard Includes
+#include <iostream>
+#include <string>
+#include <vector>
+
+// Library Includes
+#include <boost/lexical_cast.hpp>
+#include <boost/thread/thread.hpp>
+
+// Local Includes
+#include "ScriptTestRunner.h"
+#include "../sharedbase/EventLogger.h"
+
+int main(int argc, char* argv[]) {
+	unsigned int jobs = boost::thread::hardware_concurrency();
+	std::string script_file(std::string(NLS_ENGINE_SCRIPT_TESTS_PATH) + "/TestFramework.as");
+	std::string log_file("nlsscripttest.log");
+	std::vector<std::string> filters;
+	
+	for (int index = 1; index < argc; ++index) {
+		std::string argument(argv[index]);
+		
+		if (argument.compare(0, 2, "--") != 0) {
+			filters.push_back(argument);
+			continue;
+		}
+		
+		if (index + 1 >= argc) {
+			std::cerr << "Missing value for '" << argument << "'." << std::endl;
+			return 1;
+		}
+		
+		std::string value(argv[++index]);
+		
+		if (argument == "--jobs") {
+			try {
+				jobs = boost::lexical_cast<unsigned int>(value);
+			}
+			catch (boost::bad_lexical_cast&) {
+				std::cerr << "Invalid job count '" << value << "'." << std::endl;
+				return 1;
+			}
+		}
+		else if (argument == "--script") {
+			script_file = value;
+		}
+		else if (argument == "--log") {
+			log_file = value;
+		}
+		else {
+			std::cerr << "Unknown option '" << argument << "'." << std::endl;
+			return 1;
+		}
+	}
+	
+	// Assertion failures are written to the log by the script framework.
+	EventLogger::module = "ScriptTest";
+	EventLogger::GetEventLogger()->SetLogFile(log_file);
+	
+	ScriptTest::Runner runner(script_file);
+	
+	if (!runner.Discover(filters)) {
+		std::cerr << "Unable to build " << script_file << ", see " << log_file << " for details." << std::endl;
+		return 1;
+	}
+	
+	return runner.Run(jobs) == 0 ? 0 : 1;
+}
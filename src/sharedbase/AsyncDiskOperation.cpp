@@ -0,0 +1,280 @@
+/**
+* \file
+* \author agent
+* \date 2026-10-19
+* \brief Background saving and loading of Envelopes.
+*/
+
+#include "AsyncDiskOperation.h"
+
+// Standard Includes
+#include <deque>
+#include <map>
+#include <vector>
+
+// Library Includes
+#include <boost/bind.hpp>
+#include <boost/scoped_ptr.hpp>
+
+// Local Includes
+#include "Envelope.h"
+#include "EventLogger.h"
+
+// Local Types
+namespace {
+	/**
+	* \brief The single thread that all disk operations run on, in the order they were queued.
+	*/
+	class DiskWorker {
+	public:
+		static DiskWorker& Get() {
+			static DiskWorker worker;
+			return worker;
+		}
+		
+		void Enqueue(AsyncDiskOperation* operation, const boost::function<EnvelopeSPTR (bool&)>& job) {
+			boost::lock_guard<boost::mutex> lock(this->mutex);
+			
+			Job queued(operation, job);
+			this->queue.push_back(queued);
+			++this->outstanding[queued.owner];
+			
+			if (!this->thread) {
+				this->stopping = false;
+				this->thread.reset(new boost::thread(boost::bind(&DiskWorker::Run, this)));
+			}
+			
+			this->wake.notify_one();
+		}
+		
+		void Dispatch() {
+			std::vector<AsyncDiskOperation*> finished;
+			
+			{
+				boost::lock_guard<boost::mutex> lock(this->mutex);
+				
+				// Only the operations queued from this thread, so each engine instance runs its own callbacks.
+				std::map<boost::thread::id, std::vector<AsyncDiskOperation*> >::iterator owner_it = this->completed.find(boost::this_thread::get_id());
+				if (owner_it != this->completed.end()) {
+					finished.swap(owner_it->second);
+					this->completed.erase(owner_it);
+				}
+			}
+			
+			for (std::vector<AsyncDiskOperation*>::iterator op_it = finished.begin(); op_it != finished.end(); ++op_it) {
+				(*op_it)->RunCallback();
+				(*op_it)->Release(); // The worker's reference.
+			}
+		}
+		
+		void Flush() {
+			{
+				boost::unique_lock<boost::mutex> lock(this->mutex);
+				
+				boost::thread::id owner = boost::this_thread::get_id();
+				while (this->outstanding.count(owner) > 0) {
+					this->idle.wait(lock);
+				}
+			}
+			
+			this->Dispatch();
+		}
+		
+	private:
+		struct Job {
+			Job(AsyncDiskOperation* operation, const boost::function<EnvelopeSPTR (bool&)>& work) : operation(operation), work(work), owner(boost::this_thread::get_id()) {}
+			
+			AsyncDiskOperation* operation;
+			boost::function<EnvelopeSPTR (bool&)> work;
+			boost::thread::id owner; ///< The thread that queued the job, and that will run its callback.
+		};
+		
+		DiskWorker() : stopping(false) {}
+		
+		~DiskWorker() {
+			// Still-running threads must not outlive the mutex and condition they wait on.
+			this->Stop();
+		}
+		
+		void Stop() {
+			boost::scoped_ptr<boost::thread> worker_thread;
+			
+			{
+				boost::lock_guard<boost::mutex> lock(this->mutex);
+				
+				this->stopping = true;
+				this->wake.notify_one();
+				worker_thread.swap(this->thread);
+			}
+			
+			// The worker drains the queue before honoring the stop request.
+			if (worker_thread) {
+				worker_thread->join();
+			}
+		}
+		
+		void Run() {
+			boost::unique_lock<boost::mutex> lock(this->mutex);
+			
+			while (true) {
+				while (this->queue.empty() && !this->stopping) {
+					this->wake.wait(lock);
+				}
+				
+				if (this->queue.empty()) {
+					return;
+				}
+				
+				Job job = this->queue.front();
+				this->queue.pop_front();
+				
+				lock.unlock();
+				
+				bool success = false;
+				EnvelopeSPTR result = job.work(success);
+				job.operation->Complete(success, result);
+				
+				lock.lock();
+				
+				this->completed[job.owner].push_back(job.operation);
+				
+				if (--this->outstanding[job.owner] == 0) {
+					this->outstanding.erase(job.owner);
+					this->idle.notify_all();
+				}
+			}
+		}
+		
+		boost::mutex mutex;
+		boost::condition_variable wake;
+		boost::condition_variable idle; ///< Signaled whenever a thread's last outstanding job finishes.
+		std::deque<Job> queue;
+		std::map<boost::thread::id, unsigned int> outstanding; ///< Queued or running jobs, per queuing thread.
+		std::map<boost::thread::id, std::vector<AsyncDiskOperation*> > completed; ///< Finished operations waiting for their callbacks to be dispatched, per queuing thread.
+		boost::scoped_ptr<boost::thread> thread;
+		bool stopping;
+	};
+	
+	EnvelopeSPTR SaveJob(const EnvelopeSPTR& envelope, const std::string& filename, bool binary, bool& success) {
+		success = binary ? SaveToDiskBinary(envelope, filename) : SaveToDisk(envelope, filename);
+		return EnvelopeSPTR();
+	}
+	
+	EnvelopeSPTR LoadJob(const std::string& filename, bool& success) {
+		EnvelopeSPTR envelope(new Envelope());
+		
+		success = LoadFromDisk(envelope, filename);
+		
+		return success ? envelope : EnvelopeSPTR();
+	}
+	
+	EnvelopeSPTR GenericJob(const boost::function<bool ()>& work, bool& success) {
+		success = work();
+		return EnvelopeSPTR();
+	}
+	
+	AsyncDiskOperation* StartOperation(const std::string& filename, const boost::function<EnvelopeSPTR (bool&)>& job, const AsyncDiskOperation::Callback& callback) {
+		// One reference for the caller, one for the worker.
+		AsyncDiskOperation* operation = new AsyncDiskOperation(filename, callback);
+		operation->Addref();
+		
+		DiskWorker::Get().Enqueue(operation, job);
+		
+		return operation;
+	}
+}
+
+// Class methods in the order they are defined within the class header
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+AsyncDiskOperation::AsyncDiskOperation(const std::string& filename, const Callback& callback) :
+	filename(filename),
+	callback(callback),
+	complete(false),
+	success(false)
+	{
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool AsyncDiskOperation::IsComplete() const {
+	boost::lock_guard<boost::mutex> lock(this->mutex);
+	
+	return this->complete;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool AsyncDiskOperation::Succeeded() const {
+	boost::lock_guard<boost::mutex> lock(this->mutex);
+	
+	return this->complete && this->success;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void AsyncDiskOperation::Wait() const {
+	boost::unique_lock<boost::mutex> lock(this->mutex);
+	
+	while (!this->complete) {
+		this->completed.wait(lock);
+	}
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+const std::string& AsyncDiskOperation::GetFilename() const {
+	return this->filename;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+EnvelopeSPTR AsyncDiskOperation::GetEnvelope() const {
+	boost::lock_guard<boost::mutex> lock(this->mutex);
+	
+	return this->envelope;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void AsyncDiskOperation::Complete(bool success, const EnvelopeSPTR& envelope) {
+	boost::lock_guard<boost::mutex> lock(this->mutex);
+	
+	this->success = success;
+	this->envelope = envelope;
+	this->complete = true;
+	
+	this->completed.notify_all();
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void AsyncDiskOperation::RunCallback() {
+	if (this->callback) {
+		this->callback(this);
+	}
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+AsyncDiskOperation* SaveToDiskAsync(const EnvelopeSPTR& envelope, const std::string& filename, const AsyncDiskOperation::Callback& callback) {
+	// The copy is what gets written, so the caller is free to keep modifying the original.
+	return StartOperation(filename, boost::bind(&SaveJob, envelope->Clone(), filename, false, _1), callback);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+AsyncDiskOperation* SaveToDiskBinaryAsync(const EnvelopeSPTR& envelope, const std::string& filename, const AsyncDiskOperation::Callback& callback) {
+	return StartOperation(filename, boost::bind(&SaveJob, envelope->Clone(), filename, true, _1), callback);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+AsyncDiskOperation* LoadFromDiskAsync(const std::string& filename, const AsyncDiskOperation::Callback& callback) {
+	return StartOperation(filename, boost::bind(&LoadJob, filename, _1), callback);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+AsyncDiskOperation* QueueDiskOperation(const std::string& filename, const boost::function<bool ()>& work, const AsyncDiskOperation::Callback& callback) {
+	return StartOperation(filename, boost::bind(&GenericJob, work, _1), callback);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void DispatchAsyncDiskOperations() {
+	DiskWorker::Get().Dispatch();
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void FlushAsyncDiskOperations() {
+	DiskWorker::Get().Flush();
+}
@@ -0,0 +1,92 @@
+/**
+* \file
+* \author agent
+* \date 2026-10-19
+* \brief Background saving and loading of Envelopes.
+*
+* Serialization and file access run on a single worker thread so that large saves don't stall the main loop.
+* Each request returns an AsyncDiskOperation that can be polled, waited on, or given a callback.  Callbacks are
+* run from DispatchAsyncDiskOperations on the thread that queued the operation, so they are free to touch that
+* engine instance's script state even when several instances share the process.
+*/
+#pragma once
+
+// Standard Includes
+#include <string>
+
+// Library Includes
+#include <boost/function.hpp>
+
+// Local Includes
+#include "threading.h"
+#include "Envelope_fwd.h"
+#include "ScriptObjectInterface.h"
+
+// Forward Declarations
+class asIScriptEngine;
+
+// Typedefs
+
+/**
+* \brief Pollable result of a background save or load.
+* \details Reference counted via ScriptObjectInterface: the functions that start an operation return it
+* with one reference already held for the caller, who must Release it when done.
+*/
+class AsyncDiskOperation : public ScriptObjectInterface {
+public:
+	typedef boost::function<void (AsyncDiskOperation*)> Callback;
+	
+	AsyncDiskOperation(const std::string&, const Callback& = Callback());
+	
+	/// Returns true once the worker has finished with this operation.
+	bool IsComplete() const;
+	
+	/// Returns true if the operation completed without error.
+	bool Succeeded() const;
+	
+	/// Blocks until the operation has completed.
+	void Wait() const;
+	
+	/// Returns the file being saved or loaded.
+	const std::string& GetFilename() const;
+	
+	/// Returns the loaded Envelope once a load has completed successfully, or an empty pointer otherwise.
+	EnvelopeSPTR GetEnvelope() const;
+	
+	/// Called by the worker thread to record the result.
+	void Complete(bool, const EnvelopeSPTR& = EnvelopeSPTR());
+	
+	/// Runs the callback, if any.  Only called on the main thread.
+	void RunCallback();
+	
+	/// Registers the DiskOperation handle type to Angelscript.
+	static void Register(asIScriptEngine* const);
+	
+private:
+	const std::string filename;
+	Callback callback;
+	
+	mutable boost::mutex mutex;
+	mutable boost::condition_variable completed;
+	bool complete;
+	bool success;
+	EnvelopeSPTR envelope;
+};
+
+/// Copies the envelope and saves the copy into the named file, as per SaveToDisk, on the worker thread.
+AsyncDiskOperation* SaveToDiskAsync(const EnvelopeSPTR&, const std::string&, const AsyncDiskOperation::Callback& = AsyncDiskOperation::Callback());
+
+/// Copies the envelope and saves the copy into the named file, as per SaveToDiskBinary, on the worker thread.
+AsyncDiskOperation* SaveToDiskBinaryAsync(const EnvelopeSPTR&, const std::string&, const AsyncDiskOperation::Callback& = AsyncDiskOperation::Callback());
+
+/// Loads the named file into a new Envelope, as per LoadFromDisk, on the worker thread.
+AsyncDiskOperation* LoadFromDiskAsync(const std::string&, const AsyncDiskOperation::Callback& = AsyncDiskOperation::Callback());
+
+/// Queues arbitrary file work on the worker thread.  The job's return value becomes the operation's result.
+AsyncDiskOperation* QueueDiskOperation(const std::string&, const boost::function<bool ()>&, const AsyncDiskOperation::Callback& = AsyncDiskOperation::Callback());
+
+/// Runs the callbacks of every operation queued from the calling thread that completed since the last call.  Call once per frame.
+void DispatchAsyncDiskOperations();
+
+/// Waits for every operation queued from the calling thread to finish, then runs their outstanding callbacks.
+void FlushAsyncDiskOperations();
@@ -14,9 +14,17 @@
 #include "Entity.h"
 
 // Standard Includes
+#include <algorithm>
+#include <functional>
 
 // Library Includes
-#include <boost/foreach.hpp>
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#define NLS_ENGINE_USE_SSE
+#include <xmmintrin.h>
+#endif
+#include <boost/bind.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/unordered_map.hpp>
 
 // Local Includes
 #include "ComponentInterface.h"
@@ -27,6 +35,115 @@
 
 // Typedefs
 
+// Local Functions
+namespace {
+	/// Orders components by module so that each module's are next to each other, then by address so that each batch is walked through memory in order.
+	bool ComponentModuleLess(const ComponentInterface* lhs, const ComponentInterface* rhs) {
+		if (lhs->GetModule() != rhs->GetModule()) {
+			return std::less<const ModuleInterface*>()(lhs->GetModule(), rhs->GetModule());
+		}
+		return std::less<const ComponentInterface*>()(lhs, rhs);
+	}
+	
+	/**
+	* \brief Hands each module all of its components from the list in one batch.
+	* \details Components without a module are left alone.  Each component unregisters itself from its entity as it is deleted.
+	*/
+	void RemoveComponentsByModule(std::vector<ComponentInterface*>& components) {
+		std::sort(components.begin(), components.end(), ComponentModuleLess);
+		
+		std::size_t first = 0;
+		while (first < components.size()) {
+			ModuleInterface* module = components[first]->GetModule();
+			
+			std::size_t last = first + 1;
+			while (last < components.size() && components[last]->GetModule() == module) {
+				++last;
+			}
+			
+			if (module != nullptr) {
+				ModuleInterface::RemoveComponentsFrom(module, &components[first], last - first);
+			}
+			
+			first = last;
+		}
+	}
+	
+	/// Below this many entities per thread, starting the threads costs more than they save.
+	const std::size_t WORLD_TRANSFORMS_PER_THREAD = 8192;
+	
+	struct WorldTransform {
+		WorldTransform() : position(0.0f, 0.0f, 0.0f), rotation(1.0f, 0.0f, 0.0f, 0.0f), scale(1.0f) { }
+		
+		glm::vec3 position;
+		glm::fquat rotation;
+		float scale;
+	};
+	
+	/// An output pointer moved along to a slice, leaving null outputs null.
+	template <typename T> T* OffsetOutput(T* output, std::size_t offset) {
+		return (output != nullptr) ? output + offset : nullptr;
+	}
+	
+	/**
+	* \brief Multiplies each point, as a position rather than a direction, by an affine matrix.
+	* \details Four lanes wide where SSE is available: each column of the matrix is scaled by one coordinate and the
+	* columns summed, so the matrix is loaded once for all of the points.
+	*/
+	void TransformPointsBy(const glm::mat4& matrix, const glm::vec3* points, glm::vec3* results, std::size_t count) {
+#ifdef NLS_ENGINE_USE_SSE
+		const __m128 column0 = _mm_loadu_ps(&matrix[0][0]);
+		const __m128 column1 = _mm_loadu_ps(&matrix[1][0]);
+		const __m128 column2 = _mm_loadu_ps(&matrix[2][0]);
+		const __m128 column3 = _mm_loadu_ps(&matrix[3][0]);
+		
+		for (std::size_t index = 0; index < count; ++index) {
+			__m128 x = _mm_set1_ps(points[index].x);
+			__m128 y = _mm_set1_ps(points[index].y);
+			__m128 z = _mm_set1_ps(points[index].z);
+			
+			__m128 result = _mm_add_ps(_mm_add_ps(_mm_mul_ps(column0, x), _mm_mul_ps(column1, y)), _mm_add_ps(_mm_mul_ps(column2, z), column3));
+			
+			// Stores x and y, then z, leaving the w lane behind.
+			_mm_storel_pi(reinterpret_cast<__m64*>(&results[index].x), result);
+			_mm_store_ss(&results[index].z, _mm_movehl_ps(result, result));
+		}
+#else
+		for (std::size_t index = 0; index < count; ++index) {
+			glm::vec4 result = matrix * glm::vec4(points[index], 1.0f);
+			results[index] = glm::vec3(result.x, result.y, result.z);
+		}
+#endif
+	}
+}
+
+/**
+* \brief The matrices of an entity's transform, along with what they were built from so that they can tell when they are out of date.
+*/
+struct Entity::MatrixCache {
+	MatrixCache() : scale(0.0f), localVersion(0), worldVersion(0), worldLocalVersion(0), worldParentVersion(0),
+		localValid(false), localInverseValid(false), worldValid(false), worldInverseValid(false) { }
+	
+	glm::vec3 location; /**< The location the local matrix was built from. */
+	glm::fquat rotation; /**< The rotation the local matrix was built from. */
+	float scale; /**< The scale the local matrix was built from. */
+	
+	glm::mat4 local;
+	glm::mat4 localInverse;
+	glm::mat4 world;
+	glm::mat4 worldInverse;
+	
+	unsigned int localVersion; /**< Counts rebuilds of the local matrix. */
+	unsigned int worldVersion; /**< Counts rebuilds of the world matrix, so that children can tell theirs is out of date. */
+	unsigned int worldLocalVersion; /**< The localVersion the world matrix was built from. */
+	unsigned int worldParentVersion; /**< The parent's worldVersion the world matrix was built from. */
+	
+	bool localValid;
+	bool localInverseValid;
+	bool worldValid; /**< Cleared when the parent changes. */
+	bool worldInverseValid;
+};
+
 // Methods
 
 /**
@@ -38,19 +155,15 @@ EntitySPTR Entity::Factory(const std::string& name) {
 	return entity;
 }
 
-/**
-* \param[out] address The address where the entity will be created.
-*/
-void Entity::FactoryAtAddress(void* address) {
-	Entity::FactoryAtAddress(address, "");
+Entity* Entity::ScriptFactory() {
+	return Entity::ScriptFactory("");
 }
 
 /**
-* \param[out] address The address where the entity will be created.
 * \param[in] name The name of the entity.
 */
-void Entity::FactoryAtAddress(void* address, const std::string& name) {
-	new (address) EntitySPTR(new Entity(name));
+Entity* Entity::ScriptFactory(const std::string& name) {
+	return Entity::ToScriptHandle(Entity::Factory(name));
 }
 
 /**
@@ -58,9 +171,17 @@ void Entity::FactoryAtAddress(void* address, const std::string& name) {
 */
 Entity::Entity(const std::string& name) :
 	location(glm::vec3(0.0f, 0.0f, 0.0f)),
-	rotation(glm::fquat(0.0f, 0.0f, 0.0f, 1.0f)),
+	rotation(glm::fquat(1.0f, 0.0f, 0.0f, 0.0f)), // GLM takes w first: this is the identity.
 	scale(1.0f),
-	name(name)
+	name(name),
+	destroyed(false),
+	changed(false),
+	changeList(nullptr),
+	firstChild(nullptr),
+	nextSibling(nullptr),
+	previousSibling(nullptr),
+	depth(0),
+	scriptReferences(0)
 	{
 	this->parent.reset();
 	LOG(LOG_PRIORITY::FLOW, "Entity '" + this->GetName() + "' created.");
@@ -71,8 +192,49 @@ Entity::~Entity() {
 	
 	this->ClearComponents();
 	
-	// Break from parent object.
-	this->parent.reset();
+	// Break from parent object.  There are no children to break from, as each would have kept this entity alive.
+	this->Reparent(EntitySPTR());
+}
+
+void Entity::AddScriptReference() {
+	if (this->scriptReferences++ == 0) {
+		this->scriptSelf = this->shared_from_this();
+		
+		// Scripts write the transform fields directly, so the entity is listed as changed for as long as they hold it.
+		this->MarkChanged();
+	}
+}
+
+void Entity::ReleaseScriptReference() {
+	if (--this->scriptReferences == 0) {
+		// *NOTE: This may be the last pointer to the entity, so it is moved out to be let go after this method is done with the members.
+		EntitySPTR self;
+		self.swap(this->scriptSelf);
+	}
+}
+
+/**
+* \param[in] entity The entity to make a handle to.
+* \return The handle, or nullptr if entity is null.
+*/
+Entity* Entity::ToScriptHandle(const EntitySPTR& entity) {
+	if (entity) {
+		entity->AddScriptReference();
+	}
+	return entity.get();
+}
+
+/**
+* \param[in] handle The handle given to the registered function, whose reference is released.
+* \return The entity, or a null pointer if handle is null.
+*/
+EntitySPTR Entity::FromScriptHandle(Entity* handle) {
+	EntitySPTR entity;
+	if (handle != nullptr) {
+		entity = handle->shared_from_this();
+		handle->ReleaseScriptReference();
+	}
+	return entity;
 }
 
 /**
@@ -81,26 +243,41 @@ Entity::~Entity() {
 void Entity::SetParent(EntitySPTR new_parent) {
 	//Threading::WriteLock w_lock(this->parentMutex);
 	
+	// Verify that a recursive relationship has not been established: this entity must not be the new parent or one of its ancestors.
+	if (new_parent.get() != nullptr && this->IsAncestorOrSelf(new_parent.get())) {
+		LOG(LOG_PRIORITY::CONFIG, "ERROR: Recursive parenting NOT allowed.  Attempted to parent '" + this->GetName() + "' to '" + new_parent->GetName() + "'.");
+		return;
+	}
+	
+	this->Reparent(new_parent);
+}
+
+/**
+* \param[in] entities The entities to reparent.
+* \param[in] new_parent New parent entity.
+*/
+void Entity::SetParent(const std::vector<EntitySPTR>& entities, EntitySPTR new_parent) {
+	// The new parent's line of ancestry, indexed by depth: an entity is one of them if it is found at its own depth.
+	std::vector<const Entity*> ancestry;
 	if (new_parent.get() != nullptr) {
-		// Verify that a recursive relationship has not been established
-		bool status = true;
-		Entity* new_parent_p = new_parent.get();
-		Entity* parent = this->parent.get();
-		
-		// Linearized recursive scan up the family tree.
-		while (parent != nullptr && (status = (parent != new_parent_p))) {
-			parent = parent->GetParent().get();
+		ancestry.resize(new_parent->depth + 1);
+		for (const Entity* ancestor = new_parent.get(); ancestor != nullptr; ancestor = ancestor->parent.get()) {
+			ancestry[ancestor->depth] = ancestor;
 		}
-		
-		if (status) {
-			this->parent = new_parent;
+	}
+	
+	for (std::vector<EntitySPTR>::const_iterator entity_it = entities.begin(); entity_it != entities.end(); ++entity_it) {
+		Entity* entity = entity_it->get();
+		if (entity == nullptr) {
+			continue;
 		}
-		else {
-			LOG(LOG_PRIORITY::CONFIG, "ERROR: Recursive parenting NOT allowed.  Attempted to parent '" + this->GetName() + "' to '" + new_parent->GetName() + "'.");
+		
+		if (entity->depth < ancestry.size() && ancestry[entity->depth] == entity) {
+			LOG(LOG_PRIORITY::CONFIG, "ERROR: Recursive parenting NOT allowed.  Attempted to parent '" + entity->GetName() + "' to '" + new_parent->GetName() + "'.");
+			continue;
 		}
-	}
-	else {
-		this->parent.reset();
+		
+		entity->Reparent(new_parent);
 	}
 }
 
@@ -115,12 +292,75 @@ EntitySPTR Entity::GetParent(void) const {
 	return ent;
 }
 
+/**
+* \return The first child, or null.
+*/
+Entity* Entity::GetFirstChild() const {
+	return this->firstChild;
+}
+
+/**
+* \return The next sibling, or null.
+*/
+Entity* Entity::GetNextSibling() const {
+	return this->nextSibling;
+}
+
+/**
+* \return The number of ancestors, 0 for an entity without a parent.
+*/
+unsigned int Entity::GetDepth() const {
+	return this->depth;
+}
+
+/**
+* \param[in] entity The possible descendant.
+* \return True if the entity is this one or a descendant of it.  Only walks up as far as the difference in depth.
+*/
+bool Entity::IsAncestorOrSelf(const Entity* entity) const {
+	if (entity == nullptr || entity->depth < this->depth) {
+		return false;
+	}
+	
+	for (unsigned int steps = entity->depth - this->depth; steps > 0; --steps) {
+		entity = entity->parent.get();
+	}
+	
+	return entity == this;
+}
+
+/**
+* \return The next entity in the walk.
+*/
+Entity::SubtreeIterator& Entity::SubtreeIterator::operator++() {
+	if (this->current->firstChild != nullptr) {
+		this->current = this->current->firstChild;
+		return *this;
+	}
+	
+	return this->SkipChildren();
+}
+
+/**
+* \return The next entity in the walk that isn't a descendant of the current one.
+*/
+Entity::SubtreeIterator& Entity::SubtreeIterator::SkipChildren() {
+	// Climb until there is a sibling to move on to, without leaving the subtree.
+	while (this->current != this->root && this->current->nextSibling == nullptr) {
+		this->current = this->current->parent.get();
+	}
+	
+	this->current = (this->current != this->root) ? this->current->nextSibling : nullptr;
+	
+	return *this;
+}
+
 /**
 * \return The absolute psoition of the entity.
 */
 glm::vec3 Entity::GetWorldPosition(void) const {
 	glm::vec3 result = this->location;
-	Entity* entity = this->GetParent().get();
+	Entity* entity = this->parent.get();
 	glm::vec3 scaled, rotated;
 	
 	
@@ -151,7 +391,7 @@ glm::vec3 Entity::GetWorldPosition(void) const {
 		
 		result = rotated + entity->location;
 		
-		entity = entity->GetParent().get();
+		entity = entity->parent.get();
 	}
 	
 	return result;
@@ -162,13 +402,13 @@ glm::vec3 Entity::GetWorldPosition(void) const {
 */
 glm::fquat Entity::GetWorldRotation(void) const {
 	glm::fquat result = this->rotation;
-	Entity* entity = this->GetParent().get();
+	Entity* entity = this->parent.get();
 	
 	// Linearized recursive accumulation of rotations.
 	while (entity != nullptr) {
 		result = entity->rotation * result; // Remember, quat multiplication is NOT commutative!
 		
-		entity = entity->GetParent().get();
+		entity = entity->parent.get();
 	}
 	
 	return result;
@@ -179,23 +419,255 @@ glm::fquat Entity::GetWorldRotation(void) const {
 */
 float Entity::GetWorldScale(void) const {
 	float result = this->scale;
-	Entity* entity = this->GetParent().get();
+	Entity* entity = this->parent.get();
 	
 	// Linearized recursive accumulation of scales.
 	while (entity != nullptr) {
 		result *= entity->scale;
 		
-		entity = entity->GetParent().get();
+		entity = entity->parent.get();
 	}
 	
 	return result;
 }
 
+/**
+* \param[out] position The absolute position of the entity.
+* \param[out] rotation The absolute rotation of the entity.
+* \param[out] scale The absolute scale of the entity.
+*/
+void Entity::GetWorldTransform(glm::vec3& position, glm::fquat& rotation, float& scale) const {
+	glm::vec3 world_position = this->location;
+	glm::fquat world_rotation = this->rotation;
+	float world_scale = this->scale;
+	
+	// The accumulations of GetWorldPosition, GetWorldRotation, and GetWorldScale, sharing the one walk.
+	for (Entity* entity = this->parent.get(); entity != nullptr; entity = entity->parent.get()) {
+		world_position = glm::rotate(entity->rotation, world_position * entity->scale) + entity->location;
+		world_rotation = entity->rotation * world_rotation;
+		world_scale *= entity->scale;
+	}
+	
+	position = world_position;
+	rotation = world_rotation;
+	scale = world_scale;
+}
+
+/**
+* \param[in] entities The entities.  A null entity is given the identity transform.
+* \param[in] count How many entities there are.
+* \param[out] positions Where to write the world position of each entity, or null.
+* \param[out] rotations Where to write the world rotation of each entity, or null.
+* \param[out] scales Where to write the world scale of each entity, or null.
+*/
+void Entity::GetWorldTransforms(const EntitySPTR* entities, std::size_t count, glm::vec3* positions, glm::fquat* rotations, float* scales) {
+	std::size_t slices = std::min<std::size_t>(boost::thread::hardware_concurrency(), count / WORLD_TRANSFORMS_PER_THREAD);
+	
+	if (slices <= 1) {
+		Entity::GetWorldTransformsSlice(entities, count, positions, rotations, scales);
+		return;
+	}
+	
+	// *NOTE: Each slice remembers its own ancestors, so an ancestor shared across slices is computed once per slice.
+	std::size_t slice_size = (count + slices - 1) / slices;
+	
+	boost::thread_group threads;
+	for (std::size_t first = slice_size; first < count; first += slice_size) {
+		threads.create_thread(boost::bind(&Entity::GetWorldTransformsSlice, entities + first, std::min(slice_size, count - first),
+			OffsetOutput(positions, first), OffsetOutput(rotations, first), OffsetOutput(scales, first)));
+	}
+	
+	Entity::GetWorldTransformsSlice(entities, slice_size, positions, rotations, scales);
+	
+	threads.join_all();
+}
+
+/**
+* \param[in] entities The entities.
+* \param[out] positions Where to write the world position of each entity, or null.
+* \param[out] rotations Where to write the world rotation of each entity, or null.
+* \param[out] scales Where to write the world scale of each entity, or null.
+*/
+void Entity::GetWorldTransforms(const std::vector<EntitySPTR>& entities, glm::vec3* positions, glm::fquat* rotations, float* scales) {
+	if (!entities.empty()) {
+		Entity::GetWorldTransforms(&entities[0], entities.size(), positions, rotations, scales);
+	}
+}
+
+/**
+* \param[in] entities The entities.
+* \param[in] count How many entities there are.
+* \param[out] positions Where to write the world position of each entity, or null.
+* \param[out] rotations Where to write the world rotation of each entity, or null.
+* \param[out] scales Where to write the world scale of each entity, or null.
+*/
+void Entity::GetWorldTransformsSlice(const EntitySPTR* entities, std::size_t count, glm::vec3* positions, glm::fquat* rotations, float* scales) {
+	// Only entities with children are remembered, as only they can be reached again from another entity.
+	boost::unordered_map<const Entity*, WorldTransform> ancestors;
+	std::vector<const Entity*> chain;
+	
+	for (std::size_t index = 0; index < count; ++index) {
+		WorldTransform world;
+		
+		// Climb to the nearest remembered ancestor, or past the root.
+		chain.clear();
+		for (const Entity* entity = entities[index].get(); entity != nullptr; entity = entity->parent.get()) {
+			if (entity->firstChild != nullptr && !ancestors.empty()) {
+				boost::unordered_map<const Entity*, WorldTransform>::const_iterator ancestor = ancestors.find(entity);
+				if (ancestor != ancestors.end()) {
+					world = ancestor->second;
+					break;
+				}
+			}
+			chain.push_back(entity);
+		}
+		
+		// Then accumulate back down, the same composition as GetWorldPosition, GetWorldRotation, and GetWorldScale.
+		for (std::vector<const Entity*>::const_reverse_iterator entity_it = chain.rbegin(); entity_it != chain.rend(); ++entity_it) {
+			const Entity* entity = *entity_it;
+			
+			world.position = glm::rotate(world.rotation, entity->location * world.scale) + world.position;
+			world.rotation = world.rotation * entity->rotation;
+			world.scale *= entity->scale;
+			
+			if (entity->firstChild != nullptr) {
+				ancestors[entity] = world;
+			}
+		}
+		
+		if (positions != nullptr) {
+			positions[index] = world.position;
+		}
+		if (rotations != nullptr) {
+			rotations[index] = world.rotation;
+		}
+		if (scales != nullptr) {
+			scales[index] = world.scale;
+		}
+	}
+}
+
+/**
+* \return The local matrix, valid until the entity is next changed.
+*/
+const glm::mat4& Entity::GetLocalMatrix() const {
+	return this->RefreshLocalMatrix().local;
+}
+
+/**
+* \return The inverse of the local matrix, valid until the entity is next changed.
+*/
+const glm::mat4& Entity::GetLocalInverseMatrix() const {
+	MatrixCache& cache = this->RefreshLocalMatrix();
+	
+	if (!cache.localInverseValid) {
+		cache.localInverse = glm::inverse(cache.local);
+		cache.localInverseValid = true;
+	}
+	
+	return cache.localInverse;
+}
+
+/**
+* \return The world matrix, valid until the entity or one of its ancestors is next changed.
+*/
+const glm::mat4& Entity::GetWorldMatrix() const {
+	return this->RefreshWorldMatrix().world;
+}
+
+/**
+* \return The inverse of the world matrix, valid until the entity or one of its ancestors is next changed.
+*/
+const glm::mat4& Entity::GetWorldInverseMatrix() const {
+	MatrixCache& cache = this->RefreshWorldMatrix();
+	
+	if (!cache.worldInverseValid) {
+		cache.worldInverse = glm::inverse(cache.world);
+		cache.worldInverseValid = true;
+	}
+	
+	return cache.worldInverse;
+}
+
+/**
+* \param[in] points The points, in this entity's space.
+* \param[out] results Where to write the points in world space.
+* \param[in] count How many points there are.
+*/
+void Entity::TransformPoints(const glm::vec3* points, glm::vec3* results, std::size_t count) const {
+	TransformPointsBy(this->GetWorldMatrix(), points, results, count);
+}
+
+/**
+* \param[in] points The points, in world space.
+* \param[out] results Where to write the points in this entity's space.
+* \param[in] count How many points there are.
+*/
+void Entity::InverseTransformPoints(const glm::vec3* points, glm::vec3* results, std::size_t count) const {
+	TransformPointsBy(this->GetWorldInverseMatrix(), points, results, count);
+}
+
+/**
+* \return The cache, with the local matrix up to date.
+*/
+Entity::MatrixCache& Entity::RefreshLocalMatrix() const {
+	if (!this->matrices) {
+		this->matrices.reset(new MatrixCache());
+	}
+	MatrixCache& cache = *this->matrices;
+	
+	if (cache.localValid && cache.location == this->location && cache.rotation == this->rotation && cache.scale == this->scale) {
+		return cache;
+	}
+	
+	cache.location = this->location;
+	cache.rotation = this->rotation;
+	cache.scale = this->scale;
+	
+	// The same composition as GetWorldPosition: scaled, then rotated, then moved.
+	cache.local = glm::mat4_cast(this->rotation);
+	cache.local[0] = cache.local[0] * this->scale;
+	cache.local[1] = cache.local[1] * this->scale;
+	cache.local[2] = cache.local[2] * this->scale;
+	cache.local[3] = glm::vec4(this->location, 1.0f);
+	
+	cache.localValid = true;
+	cache.localInverseValid = false;
+	++cache.localVersion;
+	
+	return cache;
+}
+
+/**
+* \return The cache, with the local and world matrices up to date.
+*/
+Entity::MatrixCache& Entity::RefreshWorldMatrix() const {
+	MatrixCache& cache = this->RefreshLocalMatrix();
+	
+	const MatrixCache* parent_cache = (this->parent.get() != nullptr) ? &this->parent->RefreshWorldMatrix() : nullptr;
+	unsigned int parent_version = (parent_cache != nullptr) ? parent_cache->worldVersion : 0;
+	
+	if (cache.worldValid && cache.worldLocalVersion == cache.localVersion && cache.worldParentVersion == parent_version) {
+		return cache;
+	}
+	
+	cache.world = (parent_cache != nullptr) ? parent_cache->world * cache.local : cache.local;
+	
+	cache.worldLocalVersion = cache.localVersion;
+	cache.worldParentVersion = parent_version;
+	cache.worldValid = true;
+	cache.worldInverseValid = false;
+	++cache.worldVersion;
+	
+	return cache;
+}
+
 /**
 * \param[in] x, y, z The absolute position of the entity (separate components).
 */
 void Entity::SetPosition(float x, float y, float z) {
 	this->location = glm::vec3(x, y, z);
+	this->MarkChanged();
 }
 
 
@@ -205,6 +677,7 @@ void Entity::SetPosition(float x, float y, float z) {
 void Entity::SetRotation(glm::fquat rot) {
 	this->rotation = glm::normalize(rot);
 	// *NOTE: If the normalize's sqrt call needs to be optimized away, there is a way (supposedly) to normalize quats without sqrt.
+	this->MarkChanged();
 }
 
 /**
@@ -220,6 +693,19 @@ void Entity::SetRotation(float yaw, float pitch, float roll) {
 */
 void Entity::SetScale(float scale) {
 	this->scale = scale;
+	this->MarkChanged();
+}
+
+/**
+* \param[in] position The position of the entity.
+* \param[in] rotation The rotation of the entity.
+* \param[in] scale The scale of the entity.
+*/
+void Entity::SetTransform(const glm::vec3& position, const glm::fquat& rotation, float scale) {
+	this->location = position;
+	this->rotation = glm::normalize(rotation);
+	this->scale = scale;
+	this->MarkChanged();
 }
 
 /**
@@ -227,6 +713,7 @@ void Entity::SetScale(float scale) {
 */
 void Entity::ChangePosition(glm::vec3 delta) {
 	this->location += delta;
+	this->MarkChanged();
 }
 
 /**
@@ -235,6 +722,7 @@ void Entity::ChangePosition(glm::vec3 delta) {
 void Entity::ChangeRotation(glm::fquat delta) {
 	this->rotation = this->rotation * glm::normalize(delta);
 	// *NOTE: If the normalize's sqrt call needs to be optimized away, there is a way (supposedly) to normalize quats without sqrt.
+	this->MarkChanged();
 }
 
 /**
@@ -250,6 +738,19 @@ void Entity::ChangeRotation(float deltaYaw, float deltaPitch, float deltaRoll) {
 */
 void Entity::ChangeScale(float delta) {
 	this->scale *= delta;
+	this->MarkChanged();
+}
+
+/**
+* \param[in] deltaPosition The relative amount to change to position.
+* \param[in] deltaRotation The relative amount to change to rotation.
+* \param[in] deltaScale The relative amount to change to scale.
+*/
+void Entity::ChangeTransform(const glm::vec3& deltaPosition, const glm::fquat& deltaRotation, float deltaScale) {
+	this->location += deltaPosition;
+	this->rotation = this->rotation * glm::normalize(deltaRotation);
+	this->scale *= deltaScale;
+	this->MarkChanged();
 }
 
 ///*
@@ -266,26 +767,56 @@ const std::string& Entity::GetName() const {
 	return this->name;
 }
 
-void Entity::ClearComponents() {
-	static std::set<ComponentInterface*> components;
-	static ModuleInterface* module;
+/**
+* \return True once the entity has been removed from the world.
+*/
+bool Entity::IsDestroyed() const {
+	return this->destroyed;
+}
 
-	{
-		//Threading::ReadLock r_lock(this->componentsMutex);
-		components = this->components;
+void Entity::MarkChanged() {
+	// Listed once however often it changes, until the list is next taken.
+	if (this->changeList != nullptr && !this->changed) {
+		this->changed = true;
+		this->changeList->push_back(this->shared_from_this());
 	}
+}
 
-	// Remove the child components - each will unregister itself upon dtor.
-	BOOST_FOREACH(ComponentInterface* component, components) {
-		module = component->GetModule();
-		if (module != nullptr) {
-			if (module->RemoveComponent(component) == WHO_DELETES::CALLER) {
-				delete component;
-			}
+void Entity::ClearComponents() {
+	// Locals rather than function statics: entities belonging to different engine instances may be cleared concurrently.
+	std::vector<ComponentInterface*> components(this->components.begin(), this->components.end());
+	
+	RemoveComponentsByModule(components);
+	
+	this->components.clear();
+}
+
+/**
+* \param[in] entities The entities to strip of their components, such as those of a level being unloaded.
+*/
+void Entity::ClearComponents(const std::vector<EntitySPTR>& entities) {
+	std::size_t total = 0;
+	for (std::vector<EntitySPTR>::const_iterator entity_it = entities.begin(); entity_it != entities.end(); ++entity_it) {
+		if (entity_it->get() != nullptr) {
+			total += (*entity_it)->components.size();
+		}
+	}
+	
+	std::vector<ComponentInterface*> components;
+	components.reserve(total);
+	for (std::vector<EntitySPTR>::const_iterator entity_it = entities.begin(); entity_it != entities.end(); ++entity_it) {
+		if (entity_it->get() != nullptr) {
+			components.insert(components.end(), (*entity_it)->components.begin(), (*entity_it)->components.end());
+		}
+	}
+	
+	RemoveComponentsByModule(components);
+	
+	for (std::vector<EntitySPTR>::const_iterator entity_it = entities.begin(); entity_it != entities.end(); ++entity_it) {
+		if (entity_it->get() != nullptr) {
+			(*entity_it)->components.clear();
 		}
 	}
-
-	this->components.clear();
 }
 
 /**
@@ -326,11 +857,81 @@ bool Entity::NotifyEntityRemoval(EntitySPTR entity) {
 	if (entity.get() == nullptr) {
 		return false;
 	}
-	if (entity == this->GetParent()) {
-		this->parent.reset();
+	if (entity == this->parent) {
+		this->Reparent(EntitySPTR());
 		
 		return true;
 	}
 	
 	return false;
 }
+
+/**
+* \param[in] entities The removed entities.
+*/
+void Entity::NotifyEntityRemoval(const std::vector<EntitySPTR>& entities) {
+	for (std::vector<EntitySPTR>::const_iterator entity_it = entities.begin(); entity_it != entities.end(); ++entity_it) {
+		Entity* entity = entity_it->get();
+		if (entity == nullptr) {
+			continue;
+		}
+		
+		while (entity->firstChild != nullptr) {
+			entity->firstChild->Reparent(EntitySPTR());
+		}
+		entity->Reparent(EntitySPTR());
+	}
+}
+
+/**
+* \param[in] new_parent New parent entity, or null.
+*/
+void Entity::Reparent(EntitySPTR new_parent) {
+	if (new_parent == this->parent) {
+		return;
+	}
+	
+	// Leave the old parent's child list.
+	if (this->parent.get() != nullptr) {
+		if (this->previousSibling != nullptr) {
+			this->previousSibling->nextSibling = this->nextSibling;
+		}
+		else {
+			this->parent->firstChild = this->nextSibling;
+		}
+		if (this->nextSibling != nullptr) {
+			this->nextSibling->previousSibling = this->previousSibling;
+		}
+		this->previousSibling = nullptr;
+		this->nextSibling = nullptr;
+	}
+	
+	// *NOTE: Swapped rather than assigned: should this have been the last reference to the old parent, it is only destroyed once the links are consistent again.
+	EntitySPTR old_parent(new_parent);
+	this->parent.swap(old_parent);
+	
+	if (this->matrices) {
+		this->matrices->worldValid = false;
+	}
+	
+	this->MarkChanged();
+	
+	// Join the front of the new parent's.
+	if (this->parent.get() != nullptr) {
+		this->nextSibling = this->parent->firstChild;
+		if (this->nextSibling != nullptr) {
+			this->nextSibling->previousSibling = this;
+		}
+		this->parent->firstChild = this;
+	}
+	
+	unsigned int new_depth = (this->parent.get() != nullptr) ? this->parent->depth + 1 : 0;
+	if (new_depth != this->depth) {
+		this->depth = new_depth;
+		
+		// Parents come before their children in the walk, so each child's parent depth is already updated.
+		for (SubtreeIterator entity_it(++this->SubtreeBegin()); entity_it != this->SubtreeEnd(); ++entity_it) {
+			entity_it->depth = entity_it->parent->depth + 1;
+		}
+	}
+}
@@ -12,10 +12,14 @@
 #pragma once
 
 // System Library Includes
+#include <cstddef>
+#include <iterator>
 #include <set>
 #include <string>
+#include <vector>
 
 // Application Library Includes
+#include <boost/scoped_ptr.hpp>
 #include <glm/glm.hpp>
 #include <glm/gtx/quaternion.hpp>
 
@@ -30,9 +34,12 @@ class asIScriptEngine;
 
 /**
 * \brief An in-game object representing the base point in space it exists at.
+* \details Native code holds entities by EntitySPTR.  Scripts hold them by handle, counted by the entity itself, and
+* the entity only keeps a shared_ptr to itself while that count is above zero.
 */
-class Entity {
+class Entity : public std::enable_shared_from_this<Entity> {
 	friend class ComponentInterface;
+	friend class EntityMap;
 	
 public:
 	/**
@@ -47,14 +54,14 @@ public:
 	static EntitySPTR Factory(const std::string& = "");
 
 	/**
-	* \brief The placement factory.
+	* \brief The script factory, returning a script handle that already holds its reference.
 	*/
-	static void FactoryAtAddress(void*);
-
+	static Entity* ScriptFactory();
+	
 	/**
-	* \brief A variant placement factory.
+	* \brief A variant script factory.
 	*/
-	static void FactoryAtAddress(void*, const std::string&);
+	static Entity* ScriptFactory(const std::string&);
 	/**@}*/
 
 private:
@@ -72,17 +79,104 @@ public:
 	* \brief Registers entity to Angelscript.
 	*/
 	static void Register(asIScriptEngine* const);
-
+	
+	/**
+	* @name Script reference methods
+	* \brief The count of script handles to the entity, registered as the script type's reference behaviours.
+	* \details Copying a handle only changes a plain counter: the entity's own shared_ptr is only taken when the first
+	* handle is made and let go when the last is released, which may destroy the entity.  Handles must only be made and
+	* released on the thread running the scripts.
+	*/
+	/**@{*/
+	void AddScriptReference();
+	void ReleaseScriptReference();
+	
+	/**
+	* \brief Makes a script handle to the entity, adding its reference.  Null stays null.
+	*/
+	static Entity* ToScriptHandle(const EntitySPTR&);
+	
+	/**
+	* \brief Takes over a script handle passed into a registered function, releasing its reference once the entity is held by the returned pointer.  Null stays null.
+	*/
+	static EntitySPTR FromScriptHandle(Entity*);
+	/**@}*/
+	
 	/**
 	* \brief Sets the entity's parent.
+	* \details Refused, leaving the parent as it was, if the entity is the new parent or one of its ancestors.
 	*/
 	void SetParent(EntitySPTR newParent);
+	
+	/**
+	* \brief Sets the parent of each of the entities, checking the new parent's ancestry for cycles only once.
+	*/
+	static void SetParent(const std::vector<EntitySPTR>&, EntitySPTR newParent);
 
 	/**
 	* \brief Gets the entity's parent
 	*/
 	EntitySPTR GetParent(void) const;
 	
+	/**
+	* @name Hierarchy methods
+	* \brief The children of an entity are kept in a list threaded through the children themselves, maintained by SetParent.
+	* A parent doesn't own its children, so the links are plain pointers, only valid until the hierarchy next changes.
+	*/
+	/**@{*/
+	/**
+	* \brief Walks the subtree under an entity depth first, parents before their children, starting with the entity itself.
+	* \details No memory is allocated: the walk follows the child, sibling and parent links.  The subtree must not be
+	* reparented during the walk, though the entities in it may be changed otherwise.
+	*/
+	class SubtreeIterator : public std::iterator<std::forward_iterator_tag, Entity> {
+	public:
+		SubtreeIterator() : root(nullptr), current(nullptr) { }
+		explicit SubtreeIterator(Entity* root) : root(root), current(root) { }
+		
+		Entity& operator*() const { return *this->current; }
+		Entity* operator->() const { return this->current; }
+		
+		SubtreeIterator& operator++();
+		SubtreeIterator operator++(int) { SubtreeIterator old(*this); ++(*this); return old; }
+		
+		/**
+		* \brief Moves on to the next entity that isn't a descendant of the current one, such as when culling a whole branch.
+		*/
+		SubtreeIterator& SkipChildren();
+		
+		bool operator==(const SubtreeIterator& other) const { return this->current == other.current; }
+		bool operator!=(const SubtreeIterator& other) const { return this->current != other.current; }
+	
+	private:
+		Entity* root;
+		Entity* current;
+	};
+	
+	SubtreeIterator SubtreeBegin() { return SubtreeIterator(this); }
+	SubtreeIterator SubtreeEnd() { return SubtreeIterator(); }
+	
+	/**
+	* \brief The first of this entity's children, or null if it has none.
+	*/
+	Entity* GetFirstChild() const;
+	
+	/**
+	* \brief The next child of this entity's parent, or null if this is the last.
+	*/
+	Entity* GetNextSibling() const;
+	
+	/**
+	* \brief How many ancestors the entity has.
+	*/
+	unsigned int GetDepth() const;
+	
+	/**
+	* \brief Whether this entity is the given one or one of its ancestors.
+	*/
+	bool IsAncestorOrSelf(const Entity*) const;
+	/**@}*/
+	
 	/**
 	* @name World Positional methods
 	* \brief Returns the world position, rotation, or scale relative to the parent.
@@ -102,6 +196,60 @@ public:
 	* Get the absolute scale of a given object, recursively accounting for all parent scales.
 	*/
 	float GetWorldScale(void) const;
+	
+	/**
+	* \brief Get the absolute position, rotation, and scale together, in a single walk up the parents.
+	*/
+	void GetWorldTransform(glm::vec3& position, glm::fquat& rotation, float& scale) const;
+	
+	/**
+	* \brief Gets the absolute position, rotation, and scale of each of the entities in one pass, written to the matching index of each output.
+	* \details Any of the outputs may be null if not wanted.  The transforms of ancestors are remembered for the length of
+	* the call, so entities that share a parent only walk up to it once between them.  Large inputs are split over
+	* several threads, so the entities and their ancestors must not be changed until the call returns.
+	*/
+	static void GetWorldTransforms(const EntitySPTR*, std::size_t, glm::vec3* positions, glm::fquat* rotations, float* scales);
+	static void GetWorldTransforms(const std::vector<EntitySPTR>&, glm::vec3* positions, glm::fquat* rotations, float* scales);
+	/**@}*/
+	
+	/**
+	* @name Matrix methods
+	* \brief Affine matrices of the entity's transform, computed when first asked for and kept until the transform changes.
+	* \details The kept matrices are checked against the location, rotation, scale, and parent on every call, so changes
+	* made directly to the public fields are noticed as well.  An entity never asked for a matrix only pays for a null
+	* pointer.  The matrices are refreshed inside these const methods, so entities that share ancestors must not be asked
+	* from several threads at once.
+	*/
+	/**@{*/
+	/**
+	* \brief The matrix from this entity's space to its parent's: scale, then rotation, then translation.
+	*/
+	const glm::mat4& GetLocalMatrix() const;
+	
+	/**
+	* \brief The matrix from the parent's space to this entity's.
+	*/
+	const glm::mat4& GetLocalInverseMatrix() const;
+	
+	/**
+	* \brief The matrix from this entity's space to the world's, that is the parent's world matrix times the local matrix.
+	*/
+	const glm::mat4& GetWorldMatrix() const;
+	
+	/**
+	* \brief The matrix from the world's space to this entity's.
+	*/
+	const glm::mat4& GetWorldInverseMatrix() const;
+	
+	/**
+	* \brief Transforms points from this entity's space to the world's.  The input and output may be the same.
+	*/
+	void TransformPoints(const glm::vec3*, glm::vec3*, std::size_t) const;
+	
+	/**
+	* \brief Transforms points from the world's space to this entity's.  The input and output may be the same.
+	*/
+	void InverseTransformPoints(const glm::vec3*, glm::vec3*, std::size_t) const;
 	/**@}*/
 	
 	/**
@@ -123,7 +271,12 @@ public:
 	* \brief Sets the entity's scale.
 	*/
 	void SetScale(float);
-
+	
+	/**
+	* \brief Sets the position, rotation, and scale of the entity (relative to the parent) in one call.
+	*/
+	void SetTransform(const glm::vec3&, const glm::fquat&, float);
+	
 	/**
 	* @name Relative Positional methods
 	* \brief Changes the psoition, rotation, or scale relative to the current entity element respectively, by delta.
@@ -148,6 +301,11 @@ public:
 	* \brief Scale this entity, relative to its current scale, by delta.
 	*/
 	void ChangeScale(float);
+	
+	/**
+	* \brief Offset, rotate, and scale this entity in one call, the same as ChangePosition, ChangeRotation, and ChangeScale.
+	*/
+	void ChangeTransform(const glm::vec3&, const glm::fquat&, float);
 	/**@}*/
 			
 	///**
@@ -159,12 +317,29 @@ public:
 	* \brief Get the entity's name.
 	*/
 	const std::string& GetName() const;
+	
+	/**
+	* \brief Whether the entity has been removed from the world, and is waiting for its components to be destroyed at the end of the frame.
+	*/
+	bool IsDestroyed() const;
+	
+	/**
+	* \brief Lists the entity with the changed entities of the EntityMap holding it, such as for the WorldSnapshot to save.
+	* \details The setters and SetParent call this themselves: it need only be called after writing the public fields directly
+	* from native code.  An entity held by scripts is listed for as long as they hold it, as they write the fields directly.
+	*/
+	void MarkChanged();
 			
 	/**
 	* \brief Removes all components from the entity's set.
 	*/
 	void ClearComponents();
 	
+	/**
+	* \brief Removes all components from every one of the entities, handing each module all of its components in one batch.
+	*/
+	static void ClearComponents(const std::vector<EntitySPTR>&);
+	
 protected: // Friend access
 	/**
 	* \brief Add a component to the entity's set.
@@ -180,15 +355,55 @@ protected: // Friend access
 	* \brief Notification that the passed in entity is being removed.
 	*/
 	bool NotifyEntityRemoval(EntitySPTR);
+	
+	/**
+	* \brief Notification that the passed in entities are being removed: they are unparented, as are all of their children.
+	*/
+	static void NotifyEntityRemoval(const std::vector<EntitySPTR>&);
+private:
+	/**
+	* \brief Replaces the parent, moving this entity between the parents' child lists and updating the depth of its subtree.
+	*/
+	void Reparent(EntitySPTR newParent);
+	
+	/**
+	* \brief The single threaded part of GetWorldTransforms, run on one slice of its input.
+	*/
+	static void GetWorldTransformsSlice(const EntitySPTR*, std::size_t, glm::vec3*, glm::fquat*, float*);
+	
+	struct MatrixCache;
+	
+	/**
+	* \brief Rebuilds the local matrix if the local transform has changed since it was built, creating the cache if need be.
+	*/
+	MatrixCache& RefreshLocalMatrix() const;
+	
+	/**
+	* \brief Rebuilds the world matrix if the local matrix or any ancestor's world matrix has been rebuilt since it was built.
+	*/
+	MatrixCache& RefreshWorldMatrix() const;
 public:
+	// *NOTE: Call MarkChanged after writing these directly, or the change may be left out of the next save.
 	glm::vec3 location; /**< Offset relative to parent entity space. */
-	glm::fquat rotation; /**< Rotation relative to parent. */
+	glm::fquat rotation; /**< Rotation relative to parent, the identity until set. */
 	float scale; /**< Scale relative to parent. */
 private:
 	std::string name; /**< The name of this entity. */
+	bool destroyed; /**< Set once removed from the world, until the end of the frame when its components are destroyed. */
+	bool changed; /**< Whether the entity is already in changeList. */
+	std::vector<EntitySPTR>* changeList; /**< The changed entities of the EntityMap holding this entity, or null if none holds it. */
 	
 	//mutable Threading::ReadWriteMutex parentMutex; /**< Parent mutex lock for changing parent. */
 	EntitySPTR parent; /**< Parent entity */
+	Entity* firstChild; /**< First of the entities parented to this one. */
+	Entity* nextSibling; /**< Next entity with the same parent. */
+	Entity* previousSibling; /**< Previous entity with the same parent, so that an entity can leave the list without a search. */
+	unsigned int depth; /**< Number of ancestors, kept up to date by Reparent. */
+	
+	mutable boost::scoped_ptr<MatrixCache> matrices; /**< The matrices of the transform, created by the first call for one. */
+	
+	unsigned int scriptReferences; /**< How many script handles there are to this entity. */
+	EntitySPTR scriptSelf; /**< Keeps the entity alive while there are script handles to it. */
 	
 	//mutable Threading::ReadWriteMutex componentsMutex; /**< Component mutex lock for changing components. */
 	std::set<ComponentInterface*> components; /**< Components that are parented to this entity.  Not designed to be the primary storage of the relationship - that is maintained by the components themselves. */
@@ -8,12 +8,21 @@
 #include "Envelope.h"
 
 // Standard Includes
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <typeinfo>
 
 // Library Includes
+#include <boost/cstdint.hpp>
+#include <boost/filesystem.hpp>
 #include <boost/foreach.hpp>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
 #include <boost/lexical_cast.hpp>
 #include <boost/property_tree/ptree.hpp>
 #include <boost/property_tree/json_parser.hpp>
+#include <boost/scoped_ptr.hpp>
 #include <EngineConfig.h>
 
 // Local Includes
@@ -23,22 +32,203 @@
 // Local Consts
 const std::string SERIALIZATION_ROOT("NLS_SD_1_0_0");
 
+const char BINARY_MAGIC[4] = {'N', 'L', 'S', 'B'};
+const boost::uint32_t BINARY_VERSION = 1;
+const std::size_t BINARY_HEADER_SIZE = sizeof(BINARY_MAGIC) + sizeof(BINARY_VERSION);
+
+namespace BINARY_TAG {
+	enum TYPE {
+		UNSUPPORTED = 0,
+		BOOL,
+		INT,
+		LONG,
+		UINT,
+		FLOAT,
+		STRING,
+		VECTOR3,
+		QUAT,
+		COLOR,
+		ENVELOPE,
+	};
+}
+
+// Local Types
+
+/**
+ * Binary envelope data that lazily loaded items are decoded from.
+ * Offsets stored in the data are relative to base, which is where the root block starts.
+ */
+struct Envelope::BinarySource {
+	BinarySource() : base(nullptr), size(0) {}
+	virtual ~BinarySource() {}
+	
+	const char* base;
+	std::size_t size;
+	mutable Threading::ReadWriteMutex mutex; ///< Held shared while decoding from base, so that the data can be moved out from under a file mapping.
+};
+
+namespace {
+	/// Keeps a serialized buffer alive while envelopes still reference it.
+	struct BufferSource : public Envelope::BinarySource {
+		BufferSource(const std::shared_ptr<const std::vector<char> >& buffer) : buffer(buffer) {
+			this->base = buffer->empty() ? nullptr : &(*buffer)[0];
+			this->size = buffer->size();
+		}
+		
+		std::shared_ptr<const std::vector<char> > buffer;
+	};
+	
+	struct MappedFileSource;
+	
+	boost::mutex mappedFilesMutex;
+	std::vector<MappedFileSource*> mappedFiles; ///< The file sources envelopes are decoding from, so that they can be let go of before the file is replaced.
+	
+	/// Keeps a memory-mapped file open while envelopes still reference it, or until the file is to be replaced.
+	struct MappedFileSource : public Envelope::BinarySource {
+		MappedFileSource(const std::string& filename) :
+			filename(filename),
+			mapping(new boost::interprocess::file_mapping(filename.c_str(), boost::interprocess::read_only)),
+			region(new boost::interprocess::mapped_region(*this->mapping, boost::interprocess::read_only))
+		{
+			this->base = static_cast<const char*>(this->region->get_address()) + BINARY_HEADER_SIZE;
+			this->size = this->region->get_size() - BINARY_HEADER_SIZE;
+		}
+		
+		~MappedFileSource() {
+			boost::lock_guard<boost::mutex> lock(mappedFilesMutex);
+			
+			std::vector<MappedFileSource*>::iterator source_it = std::find(mappedFiles.begin(), mappedFiles.end(), this);
+			if (source_it != mappedFiles.end()) {
+				mappedFiles.erase(source_it);
+			}
+		}
+		
+		/// Copies the data out and closes the mapping, as Windows won't replace a file that is mapped.
+		void Unmap() {
+			Threading::WriteLock w_lock(this->mutex);
+			
+			if (!this->region) {
+				return;
+			}
+			
+			this->copy.assign(this->base, this->base + this->size);
+			this->base = this->copy.empty() ? nullptr : &this->copy[0];
+			
+			this->region.reset();
+			this->mapping.reset();
+		}
+		
+		std::string filename;
+		boost::scoped_ptr<boost::interprocess::file_mapping> mapping;
+		boost::scoped_ptr<boost::interprocess::mapped_region> region;
+		std::vector<char> copy; ///< The data once unmapped.
+	};
+	
+	/// Has the source let go of its file should the file be replaced.
+	void TrackMappedFile(MappedFileSource* source) {
+		boost::lock_guard<boost::mutex> lock(mappedFilesMutex);
+		
+		mappedFiles.push_back(source);
+	}
+	
+	/// Closes every mapping of the file, leaving the envelopes still decoding from one a copy in memory.
+	void UnmapFile(const std::string& filename) {
+		boost::lock_guard<boost::mutex> lock(mappedFilesMutex);
+		
+		for (std::vector<MappedFileSource*>::iterator source_it = mappedFiles.begin(); source_it != mappedFiles.end(); ++source_it) {
+			boost::system::error_code error;
+			
+			if (boost::filesystem::equivalent((*source_it)->filename, filename, error)) {
+				(*source_it)->Unmap();
+			}
+		}
+	}
+	
+	/// Removes the temporary file left by a failed save.
+	void RemoveTempFile(const std::string& temp_filename) {
+		boost::system::error_code error;
+		boost::filesystem::remove(temp_filename, error);
+	}
+	
+	template<typename T>
+	void WriteBinary(std::vector<char>& buffer, const T& value) {
+		const char* bytes = reinterpret_cast<const char*>(&value);
+		buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+	}
+	
+	template<typename T>
+	void WriteBinaryAt(std::vector<char>& buffer, const std::size_t& offset, const T& value) {
+		std::memcpy(&buffer[offset], &value, sizeof(T));
+	}
+	
+	/// Moves the freshly written temporary file over the target, so readers only ever see a complete file.
+	bool MoveIntoPlace(const std::string& temp_filename, const std::string& filename) {
+		// Such as when saving back to the file an envelope was loaded from, with items not yet decoded.
+		UnmapFile(filename);
+		
+		try {
+			boost::filesystem::rename(temp_filename, filename);
+		}
+		catch (boost::filesystem::filesystem_error& exception) {
+			LOG(LOG_PRIORITY::ERR, "Unable to replace '" + filename + "': " + exception.what());
+			RemoveTempFile(temp_filename);
+			return false;
+		}
+		
+		return true;
+	}
+	
+	/// Reads a value at the offset and advances the offset past it.  Returns false, leaving the value untouched, if the read would go out of bounds.
+	template<typename T>
+	bool ReadBinary(const Envelope::BinarySource& source, std::size_t& offset, T& value) {
+		if (offset > source.size || source.size - offset < sizeof(T)) {
+			return false;
+		}
+		
+		std::memcpy(&value, source.base + offset, sizeof(T));
+		offset += sizeof(T);
+		return true;
+	}
+	
+	/// Finds the item's value under its key, or else under the typeid name of its type, as text files were keyed before.
+	boost::property_tree::ptree::iterator FindTextValue(boost::property_tree::ptree& datum, const std::string& key, const std::type_info& type) {
+		boost::property_tree::ptree::assoc_iterator found = datum.find(key);
+		if (found == datum.not_found()) {
+			found = datum.find(type.name());
+		}
+		return datum.to_iterator(found);
+	}
+}
+
 // Static class member initialization
 
 // Class methods in the order they are defined within the class header
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-void SaveToDisk(const EnvelopeSPTR& envelope, const std::string& file) {
+bool SaveToDisk(const EnvelopeSPTR& envelope, const std::string& file) {
 	boost::property_tree::ptree property_tree;
 	std::string filename = file;
+	std::string temp_filename = file + ".tmp";
 	
 	LOG(LOG_PRIORITY::INFO, "Saving to disk in '" + filename + "'...");
 	
 	envelope->SaveToPropertyTree(property_tree, SERIALIZATION_ROOT + "");
 	
-	write_json(filename, property_tree);
+	try {
+		write_json(temp_filename, property_tree);
+	}
+	catch (boost::property_tree::file_parser_error& exception) {
+		LOG(LOG_PRIORITY::ERR, "Error '" + exception.message() + "' trying to write file: " + exception.filename());
+		RemoveTempFile(temp_filename);
+		return false;
+	}
+	
+	if (!MoveIntoPlace(temp_filename, filename)) {
+		return false;
+	}
 	
 	LOG(LOG_PRIORITY::INFO, "Completed saving to '" + filename + "'.");
+	return true;
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
@@ -51,6 +241,17 @@ bool LoadFromDisk(const EnvelopeSPTR& envelope, const std::string& file) {
 		return false;
 	}
 	
+	// Binary files are mapped instead of parsed.
+	{
+		std::ifstream stream(filename.c_str(), std::ios::in | std::ios::binary);
+		char magic[sizeof(BINARY_MAGIC)];
+		
+		if (stream.read(magic, sizeof(magic)) && std::memcmp(magic, BINARY_MAGIC, sizeof(magic)) == 0) {
+			stream.close();
+			return envelope->LoadFromBinaryFile(filename);
+		}
+	}
+	
 	boost::property_tree::ptree property_tree;
 	
 	LOG(LOG_PRIORITY::INFO, "Loading from'" + filename + "'...");
@@ -70,10 +271,44 @@ bool LoadFromDisk(const EnvelopeSPTR& envelope, const std::string& file) {
 	return true;
 }
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool SaveToDiskBinary(const EnvelopeSPTR& envelope, const std::string& file) {
+	std::string filename = file;
+	std::string temp_filename = file + ".tmp";
+	std::vector<char> buffer;
+	
+	LOG(LOG_PRIORITY::INFO, "Saving to disk in '" + filename + "'...");
+	
+	envelope->SaveToBinaryBuffer(buffer);
+	
+	std::ofstream stream(temp_filename.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+	
+	stream.write(BINARY_MAGIC, sizeof(BINARY_MAGIC));
+	stream.write(reinterpret_cast<const char*>(&BINARY_VERSION), sizeof(BINARY_VERSION));
+	if (!buffer.empty()) {
+		stream.write(&buffer[0], buffer.size());
+	}
+	stream.close();
+	
+	if (stream.fail()) {
+		LOG(LOG_PRIORITY::ERR, "Failed writing to '" + temp_filename + "'.");
+		RemoveTempFile(temp_filename);
+		return false;
+	}
+	
+	if (!MoveIntoPlace(temp_filename, filename)) {
+		return false;
+	}
+	
+	LOG(LOG_PRIORITY::INFO, "Completed saving to '" + filename + "'.");
+	return true;
+}
+
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 Envelope::Envelope() :
-	msgid(0)
+	msgid(0),
+	pendingItems(0)
 	{
 }
 
@@ -81,6 +316,8 @@ Envelope::Envelope() :
 boost::any Envelope::GetData(const unsigned int& index) {
 	Threading::ReadLock r_lock(this->mutex);
 	
+	this->MaterializeItem(index);
+	
 	return this->data.at(index).data;
 }
 
@@ -88,6 +325,8 @@ boost::any Envelope::GetData(const unsigned int& index) {
 boost::any Envelope::GetData(const unsigned int& index) const {
 	Threading::ReadLock r_lock(this->mutex);
 	
+	this->MaterializeItem(index);
+	
 	return this->data.at(index).data;
 }
 
@@ -114,6 +353,37 @@ unsigned int Envelope::GetCount() {
 	return this->data.size();
 }
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+EnvelopeSPTR Envelope::Clone() const {
+	Threading::ReadLock r_lock(this->mutex);
+	
+	EnvelopeSPTR copy(new Envelope());
+	copy->msgid = this->msgid;
+	
+	{
+		// Items that haven't been decoded yet just share the binary source.
+		boost::lock_guard<boost::mutex> lock(this->sourceMutex);
+		
+		copy->data = this->data;
+		copy->source = this->source;
+		copy->pendingItems = this->pendingItems;
+	}
+	
+	for (unsigned int index = 0; index < copy->data.size(); ++index) {
+		EnvelopeItem& item = copy->data[index];
+		
+		if (item.offset == 0 && item.data.type() == typeid(EnvelopeSPTR)) {
+			EnvelopeSPTR nested = boost::any_cast<EnvelopeSPTR>(item.data);
+			
+			if (nested) {
+				item.data = nested->Clone();
+			}
+		}
+	}
+	
+	return copy;
+}
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 void Envelope::SaveToPropertyTree(boost::property_tree::ptree& property_tree, const std::string& parent_key) {
 	Threading::ReadLock r_lock(this->mutex);
@@ -125,22 +395,27 @@ void Envelope::SaveToPropertyTree(boost::property_tree::ptree& property_tree, co
 	
 	unsigned int counter = 0;
 	
-	// Store the data
+	// Decode anything still sitting in a binary source.
+	for (unsigned int index = 0; index < this->data.size(); ++index) {
+		this->MaterializeItem(index);
+	}
+	
+	// Store the data.  Keys are spelled out rather than taken from typeid names, as those differ between compilers.  Files keyed the old way still load.
 	BOOST_FOREACH(EnvelopeItem datum, this->data) {
 		if (datum.data.type() == typeid(bool)) {
-			property_tree.put(parent_key + ".data.item" + boost::lexical_cast<std::string>(counter) + "." + datum.type, boost::any_cast<bool>(datum.data));
+			property_tree.put(parent_key + ".data.item" + boost::lexical_cast<std::string>(counter) + ".bool", boost::any_cast<bool>(datum.data));
 		}
 		else if (datum.data.type() == typeid(int)) {
-			property_tree.put(parent_key + ".data.item" + boost::lexical_cast<std::string>(counter) + "." + datum.type, boost::any_cast<int>(datum.data));
+			property_tree.put(parent_key + ".data.item" + boost::lexical_cast<std::string>(counter) + ".int", boost::any_cast<int>(datum.data));
 		}
 		else if (datum.data.type() == typeid(long)) {
-			property_tree.put(parent_key + ".data.item" + boost::lexical_cast<std::string>(counter) + "." + datum.type, boost::any_cast<long>(datum.data));
+			property_tree.put(parent_key + ".data.item" + boost::lexical_cast<std::string>(counter) + ".long", boost::any_cast<long>(datum.data));
 		}
 		else if (datum.data.type() == typeid(unsigned int)) {
-			property_tree.put(parent_key + ".data.item" + boost::lexical_cast<std::string>(counter) + "." + datum.type, boost::any_cast<unsigned int>(datum.data));
+			property_tree.put(parent_key + ".data.item" + boost::lexical_cast<std::string>(counter) + ".unsigned int", boost::any_cast<unsigned int>(datum.data));
 		}
 		else if (datum.data.type() == typeid(float)) {
-			property_tree.put(parent_key + ".data.item" + boost::lexical_cast<std::string>(counter) + "." + datum.type, boost::any_cast<float>(datum.data));
+			property_tree.put(parent_key + ".data.item" + boost::lexical_cast<std::string>(counter) + ".float", boost::any_cast<float>(datum.data));
 		}
 		else if (datum.data.type() == typeid(std::string)) {
 			property_tree.put(parent_key + ".data.item" + boost::lexical_cast<std::string>(counter) + ".string", boost::any_cast<std::string>(datum.data));
@@ -163,10 +438,10 @@ void Envelope::SaveToPropertyTree(boost::property_tree::ptree& property_tree, co
 		else if (datum.data.type() == typeid(glm::vec4)) {
 			glm::vec4 color = boost::any_cast<glm::vec4>(datum.data);
 			
-			property_tree.put(parent_key + ".data.item" + boost::lexical_cast<std::string>(counter) + ".r", color.r);
-			property_tree.put(parent_key + ".data.item" + boost::lexical_cast<std::string>(counter) + ".g", color.g);
-			property_tree.put(parent_key + ".data.item" + boost::lexical_cast<std::string>(counter) + ".b", color.b);
-			property_tree.put(parent_key + ".data.item" + boost::lexical_cast<std::string>(counter) + ".a", color.a);
+			property_tree.put(parent_key + ".data.item" + boost::lexical_cast<std::string>(counter) + ".color.r", color.r);
+			property_tree.put(parent_key + ".data.item" + boost::lexical_cast<std::string>(counter) + ".color.g", color.g);
+			property_tree.put(parent_key + ".data.item" + boost::lexical_cast<std::string>(counter) + ".color.b", color.b);
+			property_tree.put(parent_key + ".data.item" + boost::lexical_cast<std::string>(counter) + ".color.a", color.a);
 		}
 		else if (datum.data.type() == typeid(Envelope*)) {
 			LOG(LOG_PRIORITY::INFO, "Serializing an Envelope pointer unsupported at this time - please use an EnvelopeSPTR.");
@@ -196,20 +471,30 @@ void Envelope::LoadFromPropertyTree(boost::property_tree::ptree& property_tree,
 				boost::property_tree::ptree datum = value.second;
 				
 				boost::property_tree::ptree::iterator it;
-				if ((it = datum.to_iterator(datum.find("bool"))) != datum.end()) {
-					this->AddData(boost::lexical_cast<bool>(it->second.data()));
+				// *NOTE: Colors used to be written without the "color" level, which has to be checked for before looking for a bool under "b", its typeid name with GCC.
+				if (datum.count("r") > 0 && datum.count("g") > 0 && datum.count("b") > 0 && datum.count("a") > 0) {
+					glm::vec4 color;
+					color.r = datum.get<float>("r");
+					color.g = datum.get<float>("g");
+					color.b = datum.get<float>("b");
+					color.a = datum.get<float>("a");
+					
+					this->AddData(color);
+				}
+				else if ((it = FindTextValue(datum, "bool", typeid(bool))) != datum.end()) {
+					this->AddData(it->second.get_value<bool>());
 				}
-				else if ((it = datum.to_iterator(datum.find("int"))) != datum.end()) {
-					this->AddData(boost::lexical_cast<int>(it->second.data()));
+				else if ((it = FindTextValue(datum, "int", typeid(int))) != datum.end()) {
+					this->AddData(it->second.get_value<int>());
 				}
-				else if ((it = datum.to_iterator(datum.find("long"))) != datum.end()) {
-					this->AddData(boost::lexical_cast<long>(it->second.data()));
+				else if ((it = FindTextValue(datum, "long", typeid(long))) != datum.end()) {
+					this->AddData(it->second.get_value<long>());
 				}
-				else if ((it = datum.to_iterator(datum.find("unsigned int"))) != datum.end()) {
-					this->AddData(boost::lexical_cast<unsigned int>(it->second.data()));
+				else if ((it = FindTextValue(datum, "unsigned int", typeid(unsigned int))) != datum.end()) {
+					this->AddData(it->second.get_value<unsigned int>());
 				}
-				else if ((it = datum.to_iterator(datum.find("float"))) != datum.end()) {
-					this->AddData(boost::lexical_cast<float>(it->second.data()));
+				else if ((it = FindTextValue(datum, "float", typeid(float))) != datum.end()) {
+					this->AddData(it->second.get_value<float>());
 				}
 				else if ((it = datum.to_iterator(datum.find("string"))) != datum.end()) {
 					this->AddData(it->second.data());
@@ -258,3 +543,310 @@ void Envelope::LoadFromPropertyTree(boost::property_tree::ptree& property_tree,
 	}
 	
 }
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void Envelope::SaveToBinaryBuffer(std::vector<char>& buffer) {
+	buffer.clear();
+	
+	this->WriteBinaryBlock(buffer);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool Envelope::LoadFromBinaryBuffer(const std::shared_ptr<const std::vector<char> >& buffer) {
+	if (!buffer) {
+		return false;
+	}
+	
+	std::shared_ptr<const BinarySource> source(new BufferSource(buffer));
+	
+	return this->AttachBinarySource(source, 0);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool Envelope::LoadFromBinaryFile(const std::string& filename) {
+	std::shared_ptr<MappedFileSource> mapped;
+	
+	LOG(LOG_PRIORITY::INFO, "Mapping '" + filename + "'...");
+	
+	try {
+		mapped.reset(new MappedFileSource(filename));
+		
+		const char* header = static_cast<const char*>(mapped->region->get_address());
+		boost::uint32_t version = 0;
+		
+		if (mapped->region->get_size() < BINARY_HEADER_SIZE || std::memcmp(header, BINARY_MAGIC, sizeof(BINARY_MAGIC)) != 0) {
+			LOG(LOG_PRIORITY::INFO, "'" + filename + "' is not a binary envelope file.");
+			return false;
+		}
+		
+		std::memcpy(&version, header + sizeof(BINARY_MAGIC), sizeof(version));
+		if (version != BINARY_VERSION) {
+			LOG(LOG_PRIORITY::INFO, "'" + filename + "' has unsupported binary envelope version " + boost::lexical_cast<std::string>(version) + ".");
+			return false;
+		}
+	}
+	catch (boost::interprocess::interprocess_exception& exception) {
+		LOG(LOG_PRIORITY::INFO, "Error '" + std::string(exception.what()) + "' trying to map file: " + filename);
+		return false;
+	}
+	
+	if (!this->AttachBinarySource(mapped, 0)) {
+		LOG(LOG_PRIORITY::INFO, "'" + filename + "' contains a malformed envelope block.");
+		return false;
+	}
+	
+	// Only now can anything else reach the source, so only from now on may the mapping be closed under it.
+	TrackMappedFile(mapped.get());
+	
+	LOG(LOG_PRIORITY::INFO, "Completed mapping '" + filename + "', " + boost::lexical_cast<std::string>(this->GetCount()) + " items are deferred.");
+	return true;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool Envelope::AttachBinarySource(const std::shared_ptr<const BinarySource>& source, const std::size_t& block_offset) {
+	Threading::WriteLock w_lock(this->mutex);
+	
+	if (!this->data.empty()) {
+		return false;
+	}
+	
+	std::size_t offset = block_offset;
+	boost::int32_t message_id = 0;
+	boost::uint32_t count = 0;
+	
+	if (!ReadBinary(*source, offset, message_id) || !ReadBinary(*source, offset, count)) {
+		return false;
+	}
+	
+	// Make sure the offset table fits before trusting the count.
+	if ((source->size - offset) / sizeof(boost::uint64_t) < count) {
+		return false;
+	}
+	
+	this->msgid = message_id;
+	this->data.reserve(count);
+	
+	for (boost::uint32_t index = 0; index < count; ++index) {
+		boost::uint64_t item_offset = 0;
+		ReadBinary(*source, offset, item_offset);
+		
+		if (item_offset == 0 || item_offset >= source->size) {
+			this->data.clear();
+			return false;
+		}
+		
+		this->data.push_back(EnvelopeItem(static_cast<std::size_t>(item_offset)));
+	}
+	
+	if (count > 0) {
+		boost::lock_guard<boost::mutex> lock(this->sourceMutex);
+		
+		this->source = source;
+		this->pendingItems = count;
+	}
+	
+	return true;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void Envelope::MaterializeItem(const unsigned int& index) const {
+	boost::lock_guard<boost::mutex> lock(this->sourceMutex);
+	
+	if (!this->source || index >= this->data.size()) {
+		return;
+	}
+	
+	const EnvelopeItem& item = this->data[index];
+	
+	if (item.offset == 0) {
+		return;
+	}
+	
+	// *NOTE: Held apart from this->source, so that the lock is let go of before the source is, should that be the last reference.
+	std::shared_ptr<const BinarySource> source_ptr(this->source);
+	const BinarySource& source = *source_ptr;
+	Threading::ReadLock source_lock(source.mutex);
+	std::size_t offset = item.offset;
+	boost::uint8_t tag = BINARY_TAG::UNSUPPORTED;
+	bool ok = ReadBinary(source, offset, tag);
+	
+	if (ok) {
+		switch (tag) {
+			case BINARY_TAG::BOOL: {
+				boost::uint8_t value = 0;
+				if ((ok = ReadBinary(source, offset, value))) {
+					item.data = (value != 0);
+				}
+			}
+			break;
+			case BINARY_TAG::INT: {
+				boost::int32_t value = 0;
+				if ((ok = ReadBinary(source, offset, value))) {
+					item.data = static_cast<int>(value);
+				}
+			}
+			break;
+			case BINARY_TAG::LONG: {
+				boost::int64_t value = 0;
+				if ((ok = ReadBinary(source, offset, value))) {
+					item.data = static_cast<long>(value);
+				}
+			}
+			break;
+			case BINARY_TAG::UINT: {
+				boost::uint32_t value = 0;
+				if ((ok = ReadBinary(source, offset, value))) {
+					item.data = static_cast<unsigned int>(value);
+				}
+			}
+			break;
+			case BINARY_TAG::FLOAT: {
+				float value = 0.0f;
+				if ((ok = ReadBinary(source, offset, value))) {
+					item.data = value;
+				}
+			}
+			break;
+			case BINARY_TAG::STRING: {
+				boost::uint32_t length = 0;
+				if ((ok = ReadBinary(source, offset, length) && source.size - offset >= length)) {
+					item.data = std::string(source.base + offset, length);
+				}
+			}
+			break;
+			case BINARY_TAG::VECTOR3: {
+				glm::vec3 vector;
+				if ((ok = ReadBinary(source, offset, vector.x) && ReadBinary(source, offset, vector.y) && ReadBinary(source, offset, vector.z))) {
+					item.data = vector;
+				}
+			}
+			break;
+			case BINARY_TAG::QUAT: {
+				glm::fquat quat;
+				if ((ok = ReadBinary(source, offset, quat.x) && ReadBinary(source, offset, quat.y) && ReadBinary(source, offset, quat.z) && ReadBinary(source, offset, quat.w))) {
+					item.data = quat;
+				}
+			}
+			break;
+			case BINARY_TAG::COLOR: {
+				glm::vec4 color;
+				if ((ok = ReadBinary(source, offset, color.r) && ReadBinary(source, offset, color.g) && ReadBinary(source, offset, color.b) && ReadBinary(source, offset, color.a))) {
+					item.data = color;
+				}
+			}
+			break;
+			case BINARY_TAG::ENVELOPE: {
+				// Nested envelopes stay lazy as well, sharing this source.
+				EnvelopeSPTR envelope(new Envelope());
+				if ((ok = envelope->AttachBinarySource(this->source, offset))) {
+					item.data = envelope;
+				}
+			}
+			break;
+			case BINARY_TAG::UNSUPPORTED:
+			break;
+			default: {
+				ok = false;
+			}
+			break;
+		}
+	}
+	
+	if (!ok) {
+		LOG(LOG_PRIORITY::INFO, "Malformed binary envelope item " + boost::lexical_cast<std::string>(index) + " in Envelope(" + boost::lexical_cast<std::string>(this->msgid) + ") - leaving it empty.");
+	}
+	
+	item.type = item.data.type().name();
+	item.offset = 0;
+	
+	// Once everything has been decoded there's no reason to keep the mapping open.
+	if (--this->pendingItems == 0) {
+		this->source.reset();
+	}
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void Envelope::WriteBinaryBlock(std::vector<char>& buffer) {
+	Threading::ReadLock r_lock(this->mutex);
+	
+	// Decode anything still sitting in a binary source.
+	for (unsigned int index = 0; index < this->data.size(); ++index) {
+		this->MaterializeItem(index);
+	}
+	
+	WriteBinary(buffer, static_cast<boost::int32_t>(this->msgid));
+	WriteBinary(buffer, static_cast<boost::uint32_t>(this->data.size()));
+	
+	// Reserve the offset table, it gets filled in as the items are written.
+	std::size_t table_offset = buffer.size();
+	buffer.resize(buffer.size() + this->data.size() * sizeof(boost::uint64_t));
+	
+	for (unsigned int index = 0; index < this->data.size(); ++index) {
+		const boost::any& datum = this->data[index].data;
+		
+		WriteBinaryAt(buffer, table_offset + index * sizeof(boost::uint64_t), static_cast<boost::uint64_t>(buffer.size()));
+		
+		if (datum.type() == typeid(bool)) {
+			WriteBinary(buffer, static_cast<boost::uint8_t>(BINARY_TAG::BOOL));
+			WriteBinary(buffer, static_cast<boost::uint8_t>(boost::any_cast<bool>(datum) ? 1 : 0));
+		}
+		else if (datum.type() == typeid(int)) {
+			WriteBinary(buffer, static_cast<boost::uint8_t>(BINARY_TAG::INT));
+			WriteBinary(buffer, static_cast<boost::int32_t>(boost::any_cast<int>(datum)));
+		}
+		else if (datum.type() == typeid(long)) {
+			WriteBinary(buffer, static_cast<boost::uint8_t>(BINARY_TAG::LONG));
+			WriteBinary(buffer, static_cast<boost::int64_t>(boost::any_cast<long>(datum)));
+		}
+		else if (datum.type() == typeid(unsigned int)) {
+			WriteBinary(buffer, static_cast<boost::uint8_t>(BINARY_TAG::UINT));
+			WriteBinary(buffer, static_cast<boost::uint32_t>(boost::any_cast<unsigned int>(datum)));
+		}
+		else if (datum.type() == typeid(float)) {
+			WriteBinary(buffer, static_cast<boost::uint8_t>(BINARY_TAG::FLOAT));
+			WriteBinary(buffer, boost::any_cast<float>(datum));
+		}
+		else if (datum.type() == typeid(std::string)) {
+			const std::string& value = boost::any_cast<const std::string&>(datum);
+			
+			WriteBinary(buffer, static_cast<boost::uint8_t>(BINARY_TAG::STRING));
+			WriteBinary(buffer, static_cast<boost::uint32_t>(value.size()));
+			buffer.insert(buffer.end(), value.begin(), value.end());
+		}
+		else if (datum.type() == typeid(glm::vec3)) {
+			glm::vec3 vector = boost::any_cast<glm::vec3>(datum);
+			
+			WriteBinary(buffer, static_cast<boost::uint8_t>(BINARY_TAG::VECTOR3));
+			WriteBinary(buffer, vector.x);
+			WriteBinary(buffer, vector.y);
+			WriteBinary(buffer, vector.z);
+		}
+		else if (datum.type() == typeid(glm::fquat)) {
+			glm::fquat quat = boost::any_cast<glm::fquat>(datum);
+			
+			WriteBinary(buffer, static_cast<boost::uint8_t>(BINARY_TAG::QUAT));
+			WriteBinary(buffer, quat.x);
+			WriteBinary(buffer, quat.y);
+			WriteBinary(buffer, quat.z);
+			WriteBinary(buffer, quat.w);
+		}
+		else if (datum.type() == typeid(glm::vec4)) {
+			glm::vec4 color = boost::any_cast<glm::vec4>(datum);
+			
+			WriteBinary(buffer, static_cast<boost::uint8_t>(BINARY_TAG::COLOR));
+			WriteBinary(buffer, color.r);
+			WriteBinary(buffer, color.g);
+			WriteBinary(buffer, color.b);
+			WriteBinary(buffer, color.a);
+		}
+		else if (datum.type() == typeid(EnvelopeSPTR) && boost::any_cast<EnvelopeSPTR>(datum)) {
+			WriteBinary(buffer, static_cast<boost::uint8_t>(BINARY_TAG::ENVELOPE));
+			boost::any_cast<EnvelopeSPTR>(datum)->WriteBinaryBlock(buffer);
+		}
+		else {
+			// Keep the slot so that indices line up after loading.
+			LOG(LOG_PRIORITY::INFO, "Serializing an " + std::string(datum.type().name()) + " unsupported at this time.");
+			WriteBinary(buffer, static_cast<boost::uint8_t>(BINARY_TAG::UNSUPPORTED));
+		}
+	}
+}
@@ -8,6 +8,7 @@
 #pragma once
 
 // Standard Includes
+#include <cstddef>
 #include <vector>
 
 // Library Includes
@@ -24,12 +25,15 @@
 
 // Forward Declarations
 
-/// Saves the EnvelopeSPTR, including all its data, into the named file.
-void SaveToDisk(const EnvelopeSPTR&, const std::string&);
+/// Saves the EnvelopeSPTR, including all its data, into the named file.  The file is written under a temporary name and then moved into place.  Returns false if the file could not be written.
+bool SaveToDisk(const EnvelopeSPTR&, const std::string&);
 
 /// Loads the EnvelopeSPTR, including all its data, from the named file.  Note that this will only work if GetCount returns 0 - ie: there's nothing stored in the envelope.
 bool LoadFromDisk(const EnvelopeSPTR&, const std::string&);
 
+/// Saves the EnvelopeSPTR, including all its data, into the named file using the memory-mappable binary format.  LoadFromDisk recognizes these files automatically.  Written the same way as SaveToDisk.
+bool SaveToDiskBinary(const EnvelopeSPTR&, const std::string&);
+
 
 // Typedefs
 
@@ -99,12 +103,27 @@ public:
 	/// Returns how many data elements exist in this envelope
 	unsigned int GetCount();
 	
+	/// Returns a deep copy of this envelope, including nested envelopes, that can be handed to another thread.
+	EnvelopeSPTR Clone() const;
+	
 	/// Called to serialize this object into a predefined location in a given property tree.
 	void SaveToPropertyTree(boost::property_tree::ptree&, const std::string&);
 	
 	/// Called to unserialize this object from a predefined location in a given property tree.
 	void LoadFromPropertyTree(boost::property_tree::ptree&, const std::string&);
 	
+	/// Called to serialize this object into the binary envelope format.  The buffer is replaced by the serialized block.
+	void SaveToBinaryBuffer(std::vector<char>&);
+	
+	/// Called to attach this object to data in the binary envelope format.  Items are only decoded on first access.
+	bool LoadFromBinaryBuffer(const std::shared_ptr<const std::vector<char> >&);
+	
+	/// Called to attach this object to the named file in the binary envelope format.  The file is memory-mapped and items are only decoded on first access.
+	bool LoadFromBinaryFile(const std::string&);
+	
+public: // Public types
+	struct BinarySource; ///< Binary envelope data that lazily loaded items are decoded from.
+	
 public: // Public properties
 	int msgid; // Used to identify the message type
 	
@@ -112,18 +131,37 @@ private: // Utility methods
 	template <typename T>
 	T TGetData(unsigned int index);
 	
+	/// Reads the block header at the given offset and sets up the lazily decoded items.  The caller holds the source's lock, once others can reach the source.
+	bool AttachBinarySource(const std::shared_ptr<const BinarySource>&, const std::size_t&);
+	
+	/// Decodes the item at the given index from the binary source, if it has not been already.
+	void MaterializeItem(const unsigned int&) const;
+	
+	/// Appends this object as a binary block to the buffer.
+	void WriteBinaryBlock(std::vector<char>&);
+	
 private: // Private types
 	struct EnvelopeItem {
 		EnvelopeItem(const std::string& type, const boost::any& data) :
 			type(type),
-			data(data)
+			data(data),
+			offset(0)
 		{}
 		
-		std::string type;
-		boost::any data;
+		EnvelopeItem(const std::size_t& offset) :
+			offset(offset)
+		{}
+		
+		mutable std::string type;
+		mutable boost::any data;
+		mutable std::size_t offset; ///< Location of the still-encoded item in the binary source, or 0 once the item has been decoded.
 	};
 	
 private: // Member Data
 	mutable Threading::ReadWriteMutex mutex;
 	std::vector<EnvelopeItem> data;
+	
+	mutable boost::mutex sourceMutex; ///< Serializes the decoding of lazily loaded items.
+	mutable std::shared_ptr<const BinarySource> source; ///< Binary data the not yet decoded items are read from.  Released once every item has been decoded.
+	mutable unsigned int pendingItems; ///< How many items still have to be decoded from the source.
 };
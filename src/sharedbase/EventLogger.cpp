@@ -17,6 +17,7 @@
 #include <boost/filesystem.hpp>
 #include <boost/date_time.hpp>
 #include <boost/lexical_cast.hpp>
+#include <boost/thread/tss.hpp>
 #include <EngineConfig.h>
 
 // Local Includes
@@ -28,6 +29,16 @@ std::string EventLogger::module;
 // Forward declares
 void ArchiveOldLog(const std::string&, const std::string& = "", const unsigned int& = 1);
 
+// Local Types
+namespace {
+	/// Bound loggers are owned elsewhere; a thread exiting must not delete them.
+	void LeaveLoggerAlone(EventLogger*) {
+	}
+	
+	/// The logger bound to each thread by an EventLogger::ThreadBinding, if any.
+	boost::thread_specific_ptr<EventLogger> threadLogger(&LeaveLoggerAlone);
+}
+
 // Class methods in the order they are defined within the class header
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
@@ -47,6 +58,15 @@ EventLogger::~EventLogger() {
 	}
 }
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+EventLogger::ThreadBinding::ThreadBinding(EventLogger* elog) : previous(threadLogger.get()) {
+	threadLogger.reset(elog);
+}
+
+EventLogger::ThreadBinding::~ThreadBinding() {
+	threadLogger.reset(this->previous);
+}
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /// Static member function.  Allows each compilation unit to set their unique glogger, but keeps the singleton pattern enforced within each unit.
 /// Combined with the compilation units (the dynamic libraries) being passed an instance of the EventLogger, as created in main(), this creates a cross-compilation singleton.
@@ -57,7 +77,13 @@ void EventLogger::SetEventLogger(EventLogger* elog) {
 }
 
 /// Static member function.  Acts as combination factory and getter of the singleton.
+/// A logger bound to the calling thread takes precedence over the singleton.
 EventLogger* EventLogger::GetEventLogger() {
+	EventLogger* bound = threadLogger.get();
+	if (bound != nullptr) {
+		return bound;
+	}
+	
 	if (EventLogger::glogger == nullptr) {
 		EventLogger::SetEventLogger(new EventLogger());
 	}
@@ -65,6 +91,11 @@ EventLogger* EventLogger::GetEventLogger() {
 	return EventLogger::glogger;
 }
 
+/// Static member function.  Creates a logger separate from the singleton, such as for a second EngineCore instance.
+EventLogger* EventLogger::CreateEventLogger() {
+	return new EventLogger();
+}
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 bool EventLogger::LogToDisk(const LOG_PRIORITY::TYPE& priority_level, const std::string& text, const std::string& file, const unsigned int& line, const std::string& func) {
 	std::string fname(file);
@@ -81,17 +112,27 @@ bool EventLogger::LogToDisk(const LOG_PRIORITY::TYPE& priority_level, const std:
 	// Clean the message
 	{
 		for (std::string::const_iterator itr = text.begin(); itr != text.end(); ++itr) {
-			if ((*itr == '"')  ||
-				(*itr == '\\') ||
-				(*itr == '/')  ||
-				(*itr == '\b') ||
-				(*itr == '\f') ||
-				(*itr == '\n') ||
-				(*itr == '\r') ||
-				(*itr == '\t')) {
-				cleanedText += "\\";
+			// Control characters have to be written as escape sequences, not just preceded by a backslash, for the log to stay valid JSON.
+			switch (*itr) {
+				case '"':  cleanedText += "\\\""; break;
+				case '\\': cleanedText += "\\\\"; break;
+				case '/':  cleanedText += "\\/"; break;
+				case '\b': cleanedText += "\\b"; break;
+				case '\f': cleanedText += "\\f"; break;
+				case '\n': cleanedText += "\\n"; break;
+				case '\r': cleanedText += "\\r"; break;
+				case '\t': cleanedText += "\\t"; break;
+				default:
+					if (static_cast<unsigned char>(*itr) >= 0x20) {
+						cleanedText += *itr;
+					}
+					else {
+						static const char HEX_DIGITS[] = "0123456789abcdef";
+						cleanedText += "\\u00";
+						cleanedText += HEX_DIGITS[(*itr >> 4) & 0xf];
+						cleanedText += HEX_DIGITS[*itr & 0xf];
+					}
 			}
-			cleanedText += *itr;
 		}
 		// Not sure what I was trying to accomplish with the following line, but it seems obsolete now with the above loop.
 		//cleanedText = cleanedText.erase(text.find_last_not_of(std::string("\n\r")) + 1, std::string::npos);
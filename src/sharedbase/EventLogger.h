@@ -62,9 +62,26 @@ namespace LOG_PRIORITY {
 }
 
 class EventLogger {
+public: // Public types
+	/**
+	* \brief Routes LOG calls made on the constructing thread to the given logger for the binding's lifetime.
+	* \details Used by each EngineCore so that several engines, each on its own thread, write to their own log files.
+	* Bindings nest: the previous binding of the thread is restored when this one is destroyed.
+	*/
+	class ThreadBinding {
+	public:
+		explicit ThreadBinding(EventLogger*);
+		~ThreadBinding();
+	private:
+		EventLogger* previous;
+	};
+	
 public: // Public static members
 	static void SetEventLogger(EventLogger*);
 	static EventLogger* GetEventLogger();
+	
+	/// Creates a logger independent of the singleton, owned by the caller.
+	static EventLogger* CreateEventLogger();
 
 	static void RegisterScriptEngine(ScriptEngine* const);
 	
@@ -0,0 +1,457 @@
+/**
+* \file
+* \author agent
+* \date 2026-10-19
+* \brief Script containers of vectors and rotations, kept in contiguous aligned storage for bulk math.
+*
+*/
+
+#include "MathArrays.h"
+
+// Standard Includes
+#include <cmath>
+
+// Library Includes
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#define NLS_ENGINE_USE_SSE
+#include <xmmintrin.h>
+#endif
+
+// Local Includes
+
+// Forward Declarations
+
+// Typedefs
+
+// Local Functions
+namespace {
+	// The operations on single floats, and on four at once where SSE is available.
+	struct AddOp {
+		float operator()(float lhs, float rhs) const { return lhs + rhs; }
+#ifdef NLS_ENGINE_USE_SSE
+		__m128 operator()(__m128 lhs, __m128 rhs) const { return _mm_add_ps(lhs, rhs); }
+#endif
+	};
+	
+	struct SubtractOp {
+		float operator()(float lhs, float rhs) const { return lhs - rhs; }
+#ifdef NLS_ENGINE_USE_SSE
+		__m128 operator()(__m128 lhs, __m128 rhs) const { return _mm_sub_ps(lhs, rhs); }
+#endif
+	};
+	
+	struct MinOp {
+		float operator()(float lhs, float rhs) const { return rhs < lhs ? rhs : lhs; }
+#ifdef NLS_ENGINE_USE_SSE
+		__m128 operator()(__m128 lhs, __m128 rhs) const { return _mm_min_ps(lhs, rhs); }
+#endif
+	};
+	
+	struct MaxOp {
+		float operator()(float lhs, float rhs) const { return rhs > lhs ? rhs : lhs; }
+#ifdef NLS_ENGINE_USE_SSE
+		__m128 operator()(__m128 lhs, __m128 rhs) const { return _mm_max_ps(lhs, rhs); }
+#endif
+	};
+	
+	struct AddScaledOp {
+		explicit AddScaledOp(float factor) : factor(factor) { }
+		
+		float operator()(float lhs, float rhs) const { return lhs + rhs * this->factor; }
+#ifdef NLS_ENGINE_USE_SSE
+		__m128 operator()(__m128 lhs, __m128 rhs) const { return _mm_add_ps(lhs, _mm_mul_ps(rhs, _mm_set1_ps(this->factor))); }
+#endif
+
+		float factor;
+	};
+	
+	struct LerpOp {
+		explicit LerpOp(float fraction) : fraction(fraction) { }
+		
+		float operator()(float lhs, float rhs) const { return lhs + (rhs - lhs) * this->fraction; }
+#ifdef NLS_ENGINE_USE_SSE
+		__m128 operator()(__m128 lhs, __m128 rhs) const { return _mm_add_ps(lhs, _mm_mul_ps(_mm_sub_ps(rhs, lhs), _mm_set1_ps(this->fraction))); }
+#endif
+
+		float fraction;
+	};
+	
+	/**
+	* \brief Replaces each of the values with op(value, other).
+	* \details Both lists must start on an aligned address, so that every group of four from the start is aligned as well.
+	*/
+	template <typename Op> void CombineFloats(float* values, const float* others, std::size_t count, const Op& op) {
+		std::size_t index = 0;
+#ifdef NLS_ENGINE_USE_SSE
+		for (; index + 4 <= count; index += 4) {
+			_mm_store_ps(values + index, op(_mm_load_ps(values + index), _mm_load_ps(others + index)));
+		}
+#endif
+		for (; index < count; ++index) {
+			values[index] = op(values[index], others[index]);
+		}
+	}
+	
+	/// The floats of a vector array, for the operations that treat every component alike.
+	float* Floats(VectorArray& vectors) {
+		return reinterpret_cast<float*>(vectors.GetData());
+	}
+	
+	const float* Floats(const VectorArray& vectors) {
+		return reinterpret_cast<const float*>(vectors.GetData());
+	}
+
+#ifdef NLS_ENGINE_USE_SSE
+	/// Loads a vector into the low three lanes, without reading past its end.
+	__m128 LoadVector(const glm::vec3& vector) {
+		return _mm_movelh_ps(_mm_loadl_pi(_mm_setzero_ps(), reinterpret_cast<const __m64*>(&vector.x)), _mm_load_ss(&vector.z));
+	}
+	
+	/// Stores the low three lanes, leaving the w lane behind.
+	void StoreVector(glm::vec3& vector, __m128 value) {
+		_mm_storel_pi(reinterpret_cast<__m64*>(&vector.x), value);
+		_mm_store_ss(&vector.z, _mm_movehl_ps(value, value));
+	}
+	
+	/// The cross product of the low three lanes.  The w lane comes out as zero.
+	__m128 Cross(__m128 lhs, __m128 rhs) {
+		__m128 lhs_yzx = _mm_shuffle_ps(lhs, lhs, _MM_SHUFFLE(3, 0, 2, 1));
+		__m128 rhs_yzx = _mm_shuffle_ps(rhs, rhs, _MM_SHUFFLE(3, 0, 2, 1));
+		__m128 lhs_zxy = _mm_shuffle_ps(lhs, lhs, _MM_SHUFFLE(3, 1, 0, 2));
+		__m128 rhs_zxy = _mm_shuffle_ps(rhs, rhs, _MM_SHUFFLE(3, 1, 0, 2));
+		return _mm_sub_ps(_mm_mul_ps(lhs_yzx, rhs_zxy), _mm_mul_ps(lhs_zxy, rhs_yzx));
+	}
+	
+	/// The sum of all four lanes, in every lane.
+	__m128 SumLanes(__m128 value) {
+		__m128 pairs = _mm_add_ps(value, _mm_shuffle_ps(value, value, _MM_SHUFFLE(2, 3, 0, 1)));
+		return _mm_add_ps(pairs, _mm_shuffle_ps(pairs, pairs, _MM_SHUFFLE(1, 0, 3, 2)));
+	}
+	
+	/// Normalizes a rotation held as x, y, z, w, making a zero length one the identity as glm::normalize does.
+	__m128 NormalizeRotation(__m128 rotation) {
+		__m128 length_squared = SumLanes(_mm_mul_ps(rotation, rotation));
+		__m128 nonzero = _mm_cmpgt_ps(length_squared, _mm_setzero_ps());
+		__m128 normalized = _mm_div_ps(rotation, _mm_sqrt_ps(length_squared));
+		return _mm_or_ps(_mm_and_ps(nonzero, normalized), _mm_andnot_ps(nonzero, _mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f)));
+	}
+#endif
+
+	/// Scalar form of NormalizeRotation.
+	glm::fquat NormalizeRotation(const glm::fquat& rotation) {
+		float length_squared = rotation.x * rotation.x + rotation.y * rotation.y + rotation.z * rotation.z + rotation.w * rotation.w;
+		if (length_squared <= 0.0f) {
+			return glm::fquat(1.0f, 0.0f, 0.0f, 0.0f);
+		}
+		float inverse_length = 1.0f / std::sqrt(length_squared);
+		return glm::fquat(rotation.w * inverse_length, rotation.x * inverse_length, rotation.y * inverse_length, rotation.z * inverse_length);
+	}
+}
+
+// Class methods in the order they are defined within the class header
+
+/**
+* \param[in] offset The offset to add.
+*/
+void VectorArray::Add(const glm::vec3& offset) {
+	glm::vec3* vectors = this->GetData();
+	std::size_t count = this->GetSize();
+	std::size_t index = 0;
+#ifdef NLS_ENGINE_USE_SSE
+	// Four vectors are twelve floats, three registers, over which the offset's components repeat.
+	const __m128 offset0 = _mm_setr_ps(offset.x, offset.y, offset.z, offset.x);
+	const __m128 offset1 = _mm_setr_ps(offset.y, offset.z, offset.x, offset.y);
+	const __m128 offset2 = _mm_setr_ps(offset.z, offset.x, offset.y, offset.z);
+	
+	for (; index + 4 <= count; index += 4) {
+		float* group = &vectors[index].x;
+		_mm_store_ps(group,     _mm_add_ps(_mm_load_ps(group),     offset0));
+		_mm_store_ps(group + 4, _mm_add_ps(_mm_load_ps(group + 4), offset1));
+		_mm_store_ps(group + 8, _mm_add_ps(_mm_load_ps(group + 8), offset2));
+	}
+#endif
+	for (; index < count; ++index) {
+		vectors[index] = vectors[index] + offset;
+	}
+}
+
+/**
+* \param[in] other The vectors to add.
+* \return False if the lengths differ.
+*/
+bool VectorArray::Add(const VectorArray& other) {
+	if (other.GetSize() != this->GetSize()) {
+		return false;
+	}
+	CombineFloats(Floats(*this), Floats(other), this->GetSize() * 3, AddOp());
+	return true;
+}
+
+/**
+* \param[in] other The vectors to subtract.
+* \return False if the lengths differ.
+*/
+bool VectorArray::Subtract(const VectorArray& other) {
+	if (other.GetSize() != this->GetSize()) {
+		return false;
+	}
+	CombineFloats(Floats(*this), Floats(other), this->GetSize() * 3, SubtractOp());
+	return true;
+}
+
+/**
+* \param[in] other The vectors to add.
+* \param[in] factor What to scale them by first.
+* \return False if the lengths differ.
+*/
+bool VectorArray::AddScaled(const VectorArray& other, float factor) {
+	if (other.GetSize() != this->GetSize()) {
+		return false;
+	}
+	CombineFloats(Floats(*this), Floats(other), this->GetSize() * 3, AddScaledOp(factor));
+	return true;
+}
+
+/**
+* \param[in] factor What to scale every vector by.
+*/
+void VectorArray::Scale(float factor) {
+	float* values = Floats(*this);
+	std::size_t count = this->GetSize() * 3;
+	std::size_t index = 0;
+#ifdef NLS_ENGINE_USE_SSE
+	const __m128 factors = _mm_set1_ps(factor);
+	for (; index + 4 <= count; index += 4) {
+		_mm_store_ps(values + index, _mm_mul_ps(_mm_load_ps(values + index), factors));
+	}
+#endif
+	for (; index < count; ++index) {
+		values[index] *= factor;
+	}
+}
+
+/**
+* \param[in] rotation The rotation to apply to every vector.
+*/
+void VectorArray::Rotate(const glm::fquat& rotation) {
+	glm::vec3* vectors = this->GetData();
+	std::size_t count = this->GetSize();
+	
+	// Rotating by a matrix is cheaper than by the quaternion once there is more than one vector.
+	glm::mat3 matrix(glm::mat3_cast(rotation));
+#ifdef NLS_ENGINE_USE_SSE
+	const __m128 column0 = _mm_setr_ps(matrix[0][0], matrix[0][1], matrix[0][2], 0.0f);
+	const __m128 column1 = _mm_setr_ps(matrix[1][0], matrix[1][1], matrix[1][2], 0.0f);
+	const __m128 column2 = _mm_setr_ps(matrix[2][0], matrix[2][1], matrix[2][2], 0.0f);
+	
+	for (std::size_t index = 0; index < count; ++index) {
+		__m128 x = _mm_set1_ps(vectors[index].x);
+		__m128 y = _mm_set1_ps(vectors[index].y);
+		__m128 z = _mm_set1_ps(vectors[index].z);
+		
+		StoreVector(vectors[index], _mm_add_ps(_mm_add_ps(_mm_mul_ps(column0, x), _mm_mul_ps(column1, y)), _mm_mul_ps(column2, z)));
+	}
+#else
+	for (std::size_t index = 0; index < count; ++index) {
+		vectors[index] = matrix * vectors[index];
+	}
+#endif
+}
+
+/**
+* \param[in] rotations The rotation for each vector.
+* \return False if the lengths differ.
+*/
+bool VectorArray::Rotate(const RotationArray& rotations) {
+	if (rotations.GetSize() != this->GetSize()) {
+		return false;
+	}
+	
+	glm::vec3* vectors = this->GetData();
+	const glm::fquat* quaternions = rotations.GetData();
+	std::size_t count = this->GetSize();
+	
+	for (std::size_t index = 0; index < count; ++index) {
+#ifdef NLS_ENGINE_USE_SSE
+		// v + w * t + q x t, where t = 2 * (q x v), with the quaternion's x, y, z as q.  Its w lane drops out of both crosses.
+		__m128 quaternion = _mm_load_ps(&quaternions[index].x);
+		__m128 vector = LoadVector(vectors[index]);
+		__m128 twice_cross = Cross(quaternion, vector);
+		twice_cross = _mm_add_ps(twice_cross, twice_cross);
+		__m128 w = _mm_shuffle_ps(quaternion, quaternion, _MM_SHUFFLE(3, 3, 3, 3));
+		
+		StoreVector(vectors[index], _mm_add_ps(_mm_add_ps(vector, _mm_mul_ps(w, twice_cross)), Cross(quaternion, twice_cross)));
+#else
+		vectors[index] = glm::rotate(quaternions[index], vectors[index]);
+#endif
+	}
+	
+	return true;
+}
+
+/**
+* \param[in] other The vectors to move towards.
+* \param[in] fraction How far to move: 0 stays put, 1 reaches the other vector.
+* \return False if the lengths differ.
+*/
+bool VectorArray::Lerp(const VectorArray& other, float fraction) {
+	if (other.GetSize() != this->GetSize()) {
+		return false;
+	}
+	CombineFloats(Floats(*this), Floats(other), this->GetSize() * 3, LerpOp(fraction));
+	return true;
+}
+
+/**
+* \param[in] other The vectors to compare with.
+* \return False if the lengths differ.
+*/
+bool VectorArray::Min(const VectorArray& other) {
+	if (other.GetSize() != this->GetSize()) {
+		return false;
+	}
+	CombineFloats(Floats(*this), Floats(other), this->GetSize() * 3, MinOp());
+	return true;
+}
+
+/**
+* \param[in] other The vectors to compare with.
+* \return False if the lengths differ.
+*/
+bool VectorArray::Max(const VectorArray& other) {
+	if (other.GetSize() != this->GetSize()) {
+		return false;
+	}
+	CombineFloats(Floats(*this), Floats(other), this->GetSize() * 3, MaxOp());
+	return true;
+}
+
+/**
+* \param[out] low The least of each component.
+* \param[out] high The greatest of each component.
+* \return False if the array is empty.
+*/
+bool VectorArray::GetBounds(glm::vec3& low, glm::vec3& high) const {
+	const glm::vec3* vectors = this->GetData();
+	std::size_t count = this->GetSize();
+	
+	if (count == 0) {
+		return false;
+	}
+
+#ifdef NLS_ENGINE_USE_SSE
+	__m128 lowest = LoadVector(vectors[0]);
+	__m128 highest = lowest;
+	for (std::size_t index = 1; index < count; ++index) {
+		__m128 vector = LoadVector(vectors[index]);
+		lowest = _mm_min_ps(lowest, vector);
+		highest = _mm_max_ps(highest, vector);
+	}
+	StoreVector(low, lowest);
+	StoreVector(high, highest);
+#else
+	glm::vec3 lowest = vectors[0], highest = vectors[0];
+	for (std::size_t index = 1; index < count; ++index) {
+		lowest = glm::min(lowest, vectors[index]);
+		highest = glm::max(highest, vectors[index]);
+	}
+	low = lowest;
+	high = highest;
+#endif
+
+	return true;
+}
+
+/**
+* \param[in] delta The rotation to follow each one by.
+*/
+void RotationArray::Multiply(const glm::fquat& delta) {
+	glm::fquat* rotations = this->GetData();
+	std::size_t count = this->GetSize();
+	
+	for (std::size_t index = 0; index < count; ++index) {
+		rotations[index] = rotations[index] * delta;
+	}
+}
+
+/**
+* \param[in] deltas The rotation to follow each one by.
+* \return False if the lengths differ.
+*/
+bool RotationArray::Multiply(const RotationArray& deltas) {
+	if (deltas.GetSize() != this->GetSize()) {
+		return false;
+	}
+	
+	glm::fquat* rotations = this->GetData();
+	const glm::fquat* others = deltas.GetData();
+	std::size_t count = this->GetSize();
+	
+	for (std::size_t index = 0; index < count; ++index) {
+		rotations[index] = rotations[index] * others[index];
+	}
+	
+	return true;
+}
+
+void RotationArray::Normalize() {
+	glm::fquat* rotations = this->GetData();
+	std::size_t count = this->GetSize();
+	
+	for (std::size_t index = 0; index < count; ++index) {
+#ifdef NLS_ENGINE_USE_SSE
+		_mm_store_ps(&rotations[index].x, NormalizeRotation(_mm_load_ps(&rotations[index].x)));
+#else
+		rotations[index] = NormalizeRotation(rotations[index]);
+#endif
+	}
+}
+
+/**
+* \param[in] other The rotations to move towards.
+* \param[in] fraction How far to move: 0 stays put, 1 reaches the other rotation.
+* \return False if the lengths differ.
+*/
+bool RotationArray::Nlerp(const RotationArray& other, float fraction) {
+	if (other.GetSize() != this->GetSize()) {
+		return false;
+	}
+	
+	glm::fquat* rotations = this->GetData();
+	const glm::fquat* targets = other.GetData();
+	std::size_t count = this->GetSize();
+
+#ifdef NLS_ENGINE_USE_SSE
+	const __m128 fractions = _mm_set1_ps(fraction);
+	const __m128 sign_bits = _mm_set1_ps(-0.0f);
+	
+	for (std::size_t index = 0; index < count; ++index) {
+		__m128 rotation = _mm_load_ps(&rotations[index].x);
+		__m128 target = _mm_load_ps(&targets[index].x);
+		
+		// q and -q are the same rotation: flipping the target to the same side as the rotation takes the shorter arc.
+		target = _mm_xor_ps(target, _mm_and_ps(SumLanes(_mm_mul_ps(rotation, target)), sign_bits));
+		
+		_mm_store_ps(&rotations[index].x, NormalizeRotation(_mm_add_ps(rotation, _mm_mul_ps(_mm_sub_ps(target, rotation), fractions))));
+	}
+#else
+	for (std::size_t index = 0; index < count; ++index) {
+		const glm::fquat& rotation = rotations[index];
+		glm::fquat target = targets[index];
+		
+		// q and -q are the same rotation: flipping the target to the same side as the rotation takes the shorter arc.
+		if (rotation.x * target.x + rotation.y * target.y + rotation.z * target.z + rotation.w * target.w < 0.0f) {
+			target = glm::fquat(-target.w, -target.x, -target.y, -target.z);
+		}
+		
+		rotations[index] = NormalizeRotation(glm::fquat(
+			rotation.w + (target.w - rotation.w) * fraction,
+			rotation.x + (target.x - rotation.x) * fraction,
+			rotation.y + (target.y - rotation.y) * fraction,
+			rotation.z + (target.z - rotation.z) * fraction
+		));
+	}
+#endif
+
+	return true;
+}
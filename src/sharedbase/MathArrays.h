@@ -0,0 +1,187 @@
+/**
+* \file
+* \author agent
+* \date 2026-10-19
+* \brief Script containers of vectors and rotations, kept in contiguous aligned storage for bulk math.
+*
+* A script's array<Vector> keeps each element in its own allocation and goes through the type info of the
+* element on every access.  VectorArray and RotationArray instead keep their elements packed one after another,
+* starting on a 16 byte boundary, and do their arithmetic over the whole array in native code, four floats at a time
+* where SSE is available.  Native modules can take them from scripts by handle or reference and work on GetData()
+* directly, without copying: a module that keeps one past the call holds a reference via Addref.
+*/
+#pragma once
+
+// Standard Includes
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+
+// Library Includes
+#include <glm/glm.hpp>
+#include <glm/gtx/quaternion.hpp>
+
+// Local Includes
+#include "ScriptObjectInterface.h"
+
+// Forward Declarations
+class asIScriptEngine;
+
+// Typedefs
+
+/**
+* \brief The storage shared by the math arrays: a buffer aligned for SIMD loads, grown by doubling.
+* \details The element type must be safe to copy as raw memory, as the glm types are.
+*/
+template <typename T> class AlignedMathArray : public ScriptObjectInterface {
+public:
+	static const std::size_t ALIGNMENT = 16; /**< Alignment of the first element, in bytes. */
+	
+	explicit AlignedMathArray(std::size_t size = 0, const T& value = T()) : block(nullptr), data(nullptr), size(0), capacity(0) {
+		this->Resize(size, value);
+	}
+	
+	AlignedMathArray(const AlignedMathArray& other) : ScriptObjectInterface(other), block(nullptr), data(nullptr), size(0), capacity(0) {
+		this->Assign(other);
+	}
+	
+	virtual ~AlignedMathArray() {
+		delete[] this->block;
+	}
+	
+	/// The elements, one after another.  Only valid until the array is next resized.
+	T* GetData() { return this->data; }
+	const T* GetData() const { return this->data; }
+	
+	std::size_t GetSize() const { return this->size; }
+	
+	T& operator[](std::size_t index) { return this->data[index]; }
+	const T& operator[](std::size_t index) const { return this->data[index]; }
+	
+	/// Makes room for at least count elements without changing the size.
+	void Reserve(std::size_t count) {
+		if (count <= this->capacity) {
+			return;
+		}
+		
+		char* new_block = new char[count * sizeof(T) + ALIGNMENT - 1];
+		T* new_data = reinterpret_cast<T*>((reinterpret_cast<std::size_t>(new_block) + ALIGNMENT - 1) & ~(ALIGNMENT - 1));
+		std::uninitialized_copy(this->data, this->data + this->size, new_data);
+		
+		delete[] this->block;
+		this->block = new_block;
+		this->data = new_data;
+		this->capacity = count;
+	}
+	
+	/// Changes the size, filling any new elements with value.
+	void Resize(std::size_t count, const T& value = T()) {
+		if (count > this->capacity) {
+			this->Reserve(std::max(count, this->capacity * 2));
+		}
+		if (count > this->size) {
+			std::uninitialized_fill(this->data + this->size, this->data + count, value);
+		}
+		this->size = count;
+	}
+	
+	void PushBack(const T& value) {
+		this->Resize(this->size + 1, value);
+	}
+	
+	void PopBack() {
+		if (this->size > 0) {
+			--this->size;
+		}
+	}
+	
+	void Clear() {
+		this->size = 0;
+	}
+	
+	/// Replaces the elements with a copy of another array's.
+	void Assign(const AlignedMathArray& other) {
+		if (&other == this) {
+			return;
+		}
+		this->Reserve(other.size);
+		std::copy(other.data, other.data + other.size, this->data);
+		this->size = other.size;
+	}
+
+private:
+	AlignedMathArray& operator=(const AlignedMathArray&); ///< Use Assign, which leaves the reference count alone.
+	
+	char* block; /**< The allocation, of which data is the first aligned address. */
+	T* data;
+	std::size_t size;
+	std::size_t capacity;
+};
+
+class RotationArray;
+
+/**
+* \brief A contiguous array of vectors, with arithmetic over every element at once.
+* \details The methods taking another array work element by element, and return false without changing anything
+* if the lengths differ.
+*/
+class VectorArray : public AlignedMathArray<glm::vec3> {
+public:
+	explicit VectorArray(std::size_t size = 0, const glm::vec3& value = glm::vec3(0.0f, 0.0f, 0.0f)) : AlignedMathArray<glm::vec3>(size, value) { }
+	
+	/// Adds the offset to every vector.
+	void Add(const glm::vec3&);
+	
+	bool Add(const VectorArray&);
+	bool Subtract(const VectorArray&);
+	
+	/// Adds each vector of the other array times the factor, as for moving positions by velocities over a time step.
+	bool AddScaled(const VectorArray&, float);
+	
+	void Scale(float);
+	
+	/// Rotates every vector by the one rotation.
+	void Rotate(const glm::fquat&);
+	
+	/// Rotates each vector by the matching rotation.
+	bool Rotate(const RotationArray&);
+	
+	/// Moves each vector the fraction of the way to the matching one in the other array.
+	bool Lerp(const VectorArray&, float);
+	
+	/// Keeps the lesser of each component between the arrays.
+	bool Min(const VectorArray&);
+	
+	/// Keeps the greater of each component between the arrays.
+	bool Max(const VectorArray&);
+	
+	/// Gets the corners of the box holding every vector.  Returns false, leaving them alone, if the array is empty.
+	bool GetBounds(glm::vec3&, glm::vec3&) const;
+	
+	/// Registers VectorArray to Angelscript, after RotationArray.
+	static void Register(asIScriptEngine* const);
+};
+
+/**
+* \brief A contiguous array of rotations, with arithmetic over every element at once.
+* \details The methods taking another array work element by element, and return false without changing anything
+* if the lengths differ.
+*/
+class RotationArray : public AlignedMathArray<glm::fquat> {
+public:
+	explicit RotationArray(std::size_t size = 0, const glm::fquat& value = glm::fquat(1.0f, 0.0f, 0.0f, 0.0f)) : AlignedMathArray<glm::fquat>(size, value) { }
+	
+	/// Follows every rotation by the one delta, as Entity::ChangeRotation does.
+	void Multiply(const glm::fquat&);
+	
+	bool Multiply(const RotationArray&);
+	
+	/// Brings every rotation back to unit length.  A rotation of zero length becomes the identity.
+	void Normalize();
+	
+	/// Moves each rotation the fraction of the way to the matching one in the other array, along the shorter arc, and normalizes the result.
+	bool Nlerp(const RotationArray&, float);
+	
+	/// Registers RotationArray to Angelscript.
+	static void Register(asIScriptEngine* const);
+};
@@ -0,0 +1,102 @@
+/**
+ * \file
+ * \author agent
+ * \date 2026-10-19
+ * \brief ModuleInterface defaults and the record of which interface version each module was built against.
+ */
+
+#include "ModuleInterface.h"
+
+// Standard Includes
+#include <map>
+
+// Library Includes
+#include <boost/thread/mutex.hpp>
+
+// Local Includes
+#include "ComponentInterface.h"
+
+// Local Types
+namespace {
+	// *NOTE: Only modules older than the current version are recorded, so this stays small and is seldom locked for long.
+	boost::mutex versionsMutex;
+	std::map<const ModuleInterface*, unsigned int> versions;
+	
+	void RemoveComponentsOneByOne(ModuleInterface* module, ComponentInterface* const* components, std::size_t count) {
+		for (std::size_t index = 0; index < count; ++index) {
+			if (module->RemoveComponent(components[index]) == WHO_DELETES::CALLER) {
+				delete components[index];
+			}
+		}
+	}
+}
+
+/**
+* \param[in] components The components, all belonging to this module.
+* \param[in] count How many components there are.
+*/
+WHO_DELETES::TYPE ModuleInterface::RemoveComponents(ComponentInterface* const* components, std::size_t count) {
+	RemoveComponentsOneByOne(this, components, count);
+	return WHO_DELETES::CALLEE;
+}
+
+/**
+* \param[in] module The module.
+* \param[in] version The MODULE_INTERFACE_VERSION its library was built against.
+*/
+void ModuleInterface::SetInterfaceVersion(const ModuleInterface* module, unsigned int version) {
+	boost::mutex::scoped_lock lock(versionsMutex);
+	
+	if (version == MODULE_INTERFACE_VERSION) {
+		versions.erase(module);
+	}
+	else {
+		versions[module] = version;
+	}
+}
+
+/**
+* \param[in] module The module.
+* \return The version recorded for the module, otherwise MODULE_INTERFACE_VERSION.
+*/
+unsigned int ModuleInterface::GetInterfaceVersion(const ModuleInterface* module) {
+	boost::mutex::scoped_lock lock(versionsMutex);
+	
+	if (versions.empty()) {
+		return MODULE_INTERFACE_VERSION;
+	}
+	
+	std::map<const ModuleInterface*, unsigned int>::const_iterator version = versions.find(module);
+	return (version != versions.end()) ? version->second : MODULE_INTERFACE_VERSION;
+}
+
+/**
+* \brief Call when the module is deleted, so that a later module at the same address isn't mistaken for it.
+* \param[in] module The module.
+*/
+void ModuleInterface::ForgetInterfaceVersion(const ModuleInterface* module) {
+	boost::mutex::scoped_lock lock(versionsMutex);
+	versions.erase(module);
+}
+
+/**
+* \param[in] module The module the components belong to.
+* \param[in] components The components.
+* \param[in] count How many components there are.
+*/
+void ModuleInterface::RemoveComponentsFrom(ModuleInterface* module, ComponentInterface* const* components, std::size_t count) {
+	if (count == 0) {
+		return;
+	}
+	
+	if (ModuleInterface::GetInterfaceVersion(module) < 2) {
+		RemoveComponentsOneByOne(module, components, count);
+		return;
+	}
+	
+	if (module->RemoveComponents(components, count) == WHO_DELETES::CALLER) {
+		for (std::size_t index = 0; index < count; ++index) {
+			delete components[index];
+		}
+	}
+}
@@ -6,6 +6,7 @@
 #pragma once
 
 // Standard Includes
+#include <cstddef>
 #include <string>
 #include <map>
 
@@ -15,6 +16,7 @@
 
 // Local Includes
 #include "Entity_fwd.h"
+#include "Envelope_fwd.h"
 
 // Forward Declarations
 class ComponentInterface;
@@ -22,6 +24,42 @@ class asIScriptEngine;
 
 // Typedefs
 
+/**
+ * \brief Version of the ModuleInterface below, handed to the engine by each module library through ModuleInterfaceVersion().
+ * \details Bump this whenever a virtual method is added, and only ever add them at the end of the class so that the
+ * vtable of a module built against an older version stays a prefix of the current one.  The engine then only calls
+ * the methods the module's version has.
+ * 1 - Update, RemoveComponent, Register.  Libraries without ModuleInterfaceVersion() are taken to be this version.
+ * 2 - GetUpdatePriority, GetUpdateBudget, SaveState, RestoreState, RemoveComponents.
+ */
+const unsigned int MODULE_INTERFACE_VERSION = 2;
+
+#ifdef _WIN32
+#define NLS_MODULE_EXPORT extern "C" __declspec(dllexport)
+#else
+#define NLS_MODULE_EXPORT extern "C"
+#endif
+
+/**
+ * \brief Place once in each module library, beside its ModuleFactory, to export the version it was built against.
+ */
+#define NLS_MODULE_INTERFACE_VERSION() NLS_MODULE_EXPORT unsigned int ModuleInterfaceVersion() { return MODULE_INTERFACE_VERSION; }
+
+typedef unsigned int (*ModuleInterfaceVersionQuery)(); /**< Type of the ModuleInterfaceVersion() exported by module libraries. */
+
+/**
+ * \brief How important it is that a module is updated every frame, used when the frame runs over budget.
+ */
+namespace UPDATE_PRIORITY {
+	enum TYPE {
+		CRITICAL, ///< Updated every frame, whatever it costs.
+		HIGH,
+		NORMAL,
+		LOW, ///< First to be updated less often, and may be put off to the next frame once the frame is over budget.
+		COUNT
+	};
+}
+
 // Classes
 /**
  * \brief ModuleInterface class used as a common base for all modules.
@@ -30,12 +68,56 @@ class ModuleInterface { // All systems derive from this
 public:
 	virtual ~ModuleInterface(void) {};
 
-	virtual void Update(double dt) = 0; // Called each game update with change in time (dt) in milliseconds since last update
+	virtual void Update(double dt) = 0; // Called each game update with change in time (dt) in seconds since last update.  When updates are skipped dt covers all of the skipped time.
 
 	virtual WHO_DELETES::TYPE RemoveComponent(ComponentInterface*) = 0;
 
 	virtual void Register(asIScriptEngine* const) { } // Called to register the given module with Angelscript.
 
+	// *NOTE: Everything from here on was added in version 2, and is only called on modules of that version or later.
+
+	virtual UPDATE_PRIORITY::TYPE GetUpdatePriority() const { return UPDATE_PRIORITY::NORMAL; } // How readily the module's updates may be skipped when the frame is over budget.
+
+	virtual double GetUpdateBudget() const { return 0.0; } // Milliseconds an update is expected to take at most, or 0 for no limit.  Updates over budget are logged.
+
+	/**
+	 * \brief Hot reload support: called on the old module when a new build of its library is swapped in.
+	 * \details Store whatever the new module needs to rebuild this one's components in the envelope.  The old module
+	 * is deleted straight afterwards, and must delete its components then, as their code is about to be unloaded.
+	 * Only modules without a script interface can be reloaded, as their script bindings would point into the old library.
+	 * \return False, the default, if the module can't be reloaded.
+	 */
+	virtual bool SaveState(EnvelopeSPTR) { return false; }
+
+	/**
+	 * \brief Hot reload support: called on the new module with the envelope filled by the old module's SaveState.
+	 */
+	virtual void RestoreState(EnvelopeSPTR) { }
+
+	/**
+	 * \brief Removes a batch of this module's components, such as all of those on a set of entities being destroyed.
+	 * \details The default removes them one at a time through RemoveComponent.  Override to tear down a batch in one pass.
+	 * \return Who deletes every component in the batch.  The default deletes those RemoveComponent leaves to the caller, so returns CALLEE.
+	 */
+	virtual WHO_DELETES::TYPE RemoveComponents(ComponentInterface* const* components, std::size_t count);
+
+	/**
+	 * @name Interface versions
+	 * \brief The ModuleInterface version each module was built against, for calling only the methods it has.
+	 * Modules not recorded are taken to be built against the current version, as modules built into the engine are.
+	 */
+	/**@{*/
+	static void SetInterfaceVersion(const ModuleInterface*, unsigned int);
+	static unsigned int GetInterfaceVersion(const ModuleInterface*);
+	static void ForgetInterfaceVersion(const ModuleInterface*);
+	/**@}*/
+
+	/**
+	 * \brief Removes a batch of components through the given module's RemoveComponents, or one at a time for a module too old to have it.
+	 * \details Components left to the caller are deleted, so after this returns none of the batch remain.
+	 */
+	static void RemoveComponentsFrom(ModuleInterface*, ComponentInterface* const* components, std::size_t count);
+
 protected:
 	ModuleInterface() {};
 };
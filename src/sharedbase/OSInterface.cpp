@@ -38,3 +38,15 @@ OSInterfaceSPTR OSInterface::GetOSPointer() {
 bool OSInterface::HasOS() {
 	return OSInterface::operatingSystem.get() != nullptr;
 }
+
+// Class methods in the order they are defined within the class header
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void OSInterface::SetInputEngine(ScriptEngine* const engine) {
+	this->inputEngine = engine;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+ScriptEngine* OSInterface::GetInputEngine() const {
+	return this->inputEngine;
+}
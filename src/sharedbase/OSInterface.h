@@ -61,6 +61,11 @@ public:
 	*/
 	virtual bool IsRunning() = 0;
 
+	/**
+	* \brief Whether this OS runs without any window or user interface, as for dedicated servers.  Modules should not call CreateGUIWindow when true.
+	*/
+	virtual bool IsHeadless() { return false; }
+
 	/**
 	* \brief Returns a GUI window handle.
 	* \return The GUI handle as a boost::any. No error checking is performed to ensure a window has been created.
@@ -68,16 +73,29 @@ public:
 	boost::any GetGUIHandle() { return this->GUIHandle; }
 	
 	/**
-	* \brief Sets the ScriptEngine instance and is meant to be where the OS is registered with the ScriptEngine.
+	* \brief Registers the OS, and the SYSTEM_DIRS enum, with the ScriptEngine.
+	* \details Every engine in the process registers the one OS, so the engine isn't kept: see SetInputEngine for that.
 	* \param engine A instance of the ScriptEngine.
 	*/
-	virtual void RegisterScriptEngine(ScriptEngine* const engine) { this->scriptEngine = engine; }
+	virtual void RegisterScriptEngine(ScriptEngine* const engine);
+	
+	/**
+	* \brief Chooses the one ScriptEngine that console and keyboard input is handed to, or nullptr for none.
+	* \details Input is run on the thread calling RouteMessages, so the engine must be updated on that thread too,
+	* and only that thread is to call this.
+	*/
+	void SetInputEngine(ScriptEngine* const engine);
+	
+	/**
+	* \brief Gets the ScriptEngine that console and keyboard input is handed to, if any.
+	*/
+	ScriptEngine* GetInputEngine() const;
 	
 protected:
-	OSInterface() {}
+	OSInterface() : inputEngine(nullptr) {}
 	bool running; /**< If the OS is still running */
 	boost::any GUIHandle; /**< Handle to a created GUI window. */
-	ScriptEngine* scriptEngine; /**< A pointer to a ScriptEngine instance. Used to register with the scripting engine, and to get ScriptExecutor instance to call script functions. */
+	ScriptEngine* inputEngine; /**< The ScriptEngine whose scripts are handed console and keyboard input, if any. */
 	
 private:
 	static OSInterfaceSPTR operatingSystem;
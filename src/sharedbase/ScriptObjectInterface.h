@@ -45,14 +45,16 @@ public:
 	
 	/// Angelscript reference count decrement
 	void Release(void) {
+		unsigned int remaining;
+		
 		// Decrease ref count 
 		{
 			Threading::WriteLock w_lock(this->mutex);
-			--this->refCount;
+			remaining = --this->refCount;
 		}
 		
-		// Delete if it reaches 0
-		if (this->refCount <= 0) {
+		// Delete if it reaches 0.  Uses the count read under the lock, as another thread may release at the same time.
+		if (remaining <= 0) {
 			delete this;
 		}
 	}
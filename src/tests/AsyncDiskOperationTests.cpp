@@ -0,0 +1,147 @@
+/**
+* \file
+* \author agent
+* \date 2026-10-19
+* \brief Tests of background saves and loads, and of when and where their callbacks run.
+*/
+
+#include "UnitTest.h"
+
+// Standard Includes
+#include <string>
+#include <vector>
+
+// Library Includes
+#include <boost/bind.hpp>
+#include <boost/filesystem.hpp>
+#include <boost/thread/thread.hpp>
+
+// Local Includes
+#include "../sharedbase/AsyncDiskOperation.h"
+#include "../sharedbase/Envelope.h"
+
+// Local Types
+namespace {
+	/// A file in the temp folder that is removed when the test ends.
+	struct TempFile {
+		TempFile() : path((boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("nlstest-%%%%%%%%")).string()) {}
+		
+		~TempFile() {
+			boost::system::error_code error;
+			boost::filesystem::remove_all(this->path, error);
+		}
+		
+		std::string path;
+	};
+	
+	/// Notes each callback run: whether its operation succeeded, what it loaded, and the thread it was run on.
+	struct CallbackLog {
+		void Record(AsyncDiskOperation* operation) {
+			this->successes.push_back(operation->Succeeded());
+			this->envelopes.push_back(operation->GetEnvelope());
+			this->threads.push_back(boost::this_thread::get_id());
+		}
+		
+		AsyncDiskOperation::Callback Callback() {
+			return boost::bind(&CallbackLog::Record, this, _1);
+		}
+		
+		std::vector<bool> successes;
+		std::vector<EnvelopeSPTR> envelopes;
+		std::vector<boost::thread::id> threads;
+	};
+	
+	EnvelopeSPTR MakeEnvelope() {
+		EnvelopeSPTR envelope(new Envelope());
+		envelope->msgid = 42;
+		envelope->AddData(-7);
+		envelope->AddData(std::string("crate"));
+		return envelope;
+	}
+	
+	void QueueAndFlush(const std::string& filename, CallbackLog& log) {
+		LoadFromDiskAsync(filename, log.Callback())->Release();
+		FlushAsyncDiskOperations();
+	}
+}
+
+TEST(AsyncDiskOperation, SaveThenLoadReportThroughCallbacks) {
+	TempFile file;
+	CallbackLog log;
+	
+	AsyncDiskOperation* save = SaveToDiskAsync(MakeEnvelope(), file.path, log.Callback());
+	AsyncDiskOperation* load = LoadFromDiskAsync(file.path, log.Callback());
+	
+	// Operations run in the order queued, but their callbacks wait for the queuing thread to dispatch them.
+	load->Wait();
+	EXPECT_TRUE(save->IsComplete());
+	EXPECT_TRUE(save->Succeeded());
+	EXPECT_TRUE(load->Succeeded());
+	EXPECT_EQ(log.successes.size(), 0u);
+	
+	FlushAsyncDiskOperations();
+	ASSERT_EQ(log.successes.size(), 2u);
+	EXPECT_TRUE(log.successes[0]);
+	EXPECT_TRUE(log.successes[1]);
+	EXPECT_TRUE(log.threads[0] == boost::this_thread::get_id());
+	EXPECT_TRUE(log.threads[1] == boost::this_thread::get_id());
+	
+	EXPECT_FALSE(log.envelopes[0]);
+	ASSERT_TRUE(log.envelopes[1]);
+	EXPECT_EQ(log.envelopes[1]->msgid, 42);
+	ASSERT_EQ(log.envelopes[1]->GetCount(), 2u);
+	EXPECT_EQ(log.envelopes[1]->GetDataInt(0), -7);
+	EXPECT_EQ(log.envelopes[1]->GetDataString(1), std::string("crate"));
+	
+	// Each callback runs once.
+	DispatchAsyncDiskOperations();
+	EXPECT_EQ(log.successes.size(), 2u);
+	
+	save->Release();
+	load->Release();
+}
+
+TEST(AsyncDiskOperation, FailedSaveAndLoadReportErrors) {
+	TempFile folder;
+	CallbackLog log;
+	
+	// A folder can't be replaced by a file, nor read as one.
+	ASSERT_TRUE(boost::filesystem::create_directory(folder.path));
+	AsyncDiskOperation* save = SaveToDiskBinaryAsync(MakeEnvelope(), folder.path, log.Callback());
+	AsyncDiskOperation* load = LoadFromDiskAsync(folder.path + "/missing", log.Callback());
+	
+	FlushAsyncDiskOperations();
+	EXPECT_TRUE(save->IsComplete());
+	EXPECT_FALSE(save->Succeeded());
+	EXPECT_TRUE(load->IsComplete());
+	EXPECT_FALSE(load->Succeeded());
+	EXPECT_FALSE(load->GetEnvelope());
+	
+	ASSERT_EQ(log.successes.size(), 2u);
+	EXPECT_FALSE(log.successes[0]);
+	EXPECT_FALSE(log.successes[1]);
+	EXPECT_FALSE(log.envelopes[1]);
+	
+	save->Release();
+	load->Release();
+}
+
+TEST(AsyncDiskOperation, CallbacksStayWithTheQueuingThread) {
+	TempFile file;
+	CallbackLog log, other_log;
+	
+	AsyncDiskOperation* save = SaveToDiskAsync(MakeEnvelope(), file.path, log.Callback());
+	
+	// Another engine instance flushing on its own thread waits for its own operation, queued after this one, and runs only its callback.
+	boost::thread other(boost::bind(&QueueAndFlush, file.path, boost::ref(other_log)));
+	other.join();
+	EXPECT_EQ(other_log.successes.size(), 1u);
+	EXPECT_EQ(log.successes.size(), 0u);
+	EXPECT_TRUE(save->IsComplete());
+	
+	DispatchAsyncDiskOperations();
+	ASSERT_EQ(log.successes.size(), 1u);
+	EXPECT_TRUE(log.threads[0] == boost::this_thread::get_id());
+	
+	save->Release();
+}
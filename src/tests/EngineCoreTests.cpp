@@ -0,0 +1,133 @@
+/**
+* \file
+* \author agent
+* \date 2026-10-19
+* \brief Tests of several EngineCore instances running side by side, each on its own thread.
+*/
+
+#include "UnitTest.h"
+
+// Standard Includes
+#include <fstream>
+#include <sstream>
+#include <string>
+
+// Library Includes
+#include <boost/bind.hpp>
+#include <boost/filesystem.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/thread/barrier.hpp>
+#include <boost/thread/thread.hpp>
+
+// Local Includes
+#include "../sharedbase/EventLogger.h"
+#include "../sharedbase/OSInterface.h"
+#include "../enginecore/EngineCore.h"
+
+// Local Types
+namespace {
+	/// Logs to a file of the engine's own, and counts its updates in a script global.
+	const char* CONFIG_SCRIPT =
+		"void main() {\n"
+		"	Engine.SetUserDataFolder(OS.GetPath(SYSTEM_DIRS::EXECUTABLE));\n"
+		"	Engine.SetGameScript(\"main.as\");\n"
+		"	Engine.SetLogFile(\"engine.log\");\n"
+		"}\n"
+	;
+	
+	const char* GAME_SCRIPT =
+		"int ticks = 0;\n"
+		"void main() {\n"
+		"	Engine.StartCoroutine(@Tick);\n"
+		"}\n"
+		"void Tick() {\n"
+		"	while (true) {\n"
+		"		ticks++;\n"
+		"		Engine::LOG(Engine::LOG_PRIORITY::INFO, \"tick \" + ticks);\n"
+		"		Engine.Yield();\n"
+		"	}\n"
+		"}\n"
+	;
+	
+	/// An OS with no window, whose executable folder is a temp folder holding the scripts.
+	class TestOS : public OSInterface {
+	public:
+		TestOS() : folder(boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("nlstest-%%%%%%%%")) {
+			boost::filesystem::create_directory(this->folder);
+			this->WriteFile("config.as", CONFIG_SCRIPT);
+			this->WriteFile("main.as", GAME_SCRIPT);
+		}
+		
+		~TestOS() {
+			boost::system::error_code error;
+			boost::filesystem::remove_all(this->folder, error);
+		}
+		
+		boost::any CreateGUIWindow(int, int, std::string, WINDOW_FLAGS) { return boost::any(); }
+		void ShowInfo(std::string, std::string) { }
+		void ShowWarning(std::string, std::string) { }
+		void ShowError(std::string, std::string) { }
+		void RouteMessages() { }
+		std::string GetPath(SYSTEM_DIRS::TYPE) { return this->folder.string(); }
+		EventLogger* GetLogger() { return EventLogger::GetEventLogger(); }
+		bool IsRunning() { return true; }
+		bool IsHeadless() { return true; }
+		
+		/// The contents of the engine's log file.
+		std::string ReadLog() const {
+			std::stringstream log;
+			std::ifstream in((this->folder / "engine.log").string().c_str());
+			log << in.rdbuf();
+			return log.str();
+		}
+	
+	private:
+		void WriteFile(const std::string& name, const char* text) {
+			std::ofstream out((this->folder / name).string().c_str());
+			out << text;
+		}
+		
+		boost::filesystem::path folder;
+	};
+	
+	/// Starts an engine with a log of its own, updates it once both engines have started, and shuts it down.
+	void RunEngine(OSInterfaceSPTR os, unsigned int updates, boost::barrier& started, bool& result) {
+		EngineCore engine(os, true);
+		result = engine.StartUp();
+		started.wait();
+		
+		for (unsigned int update = 0; update < updates && result; ++update) {
+			engine.Update();
+		}
+		
+		engine.Shutdown();
+	}
+	
+	bool Logged(const std::string& log, unsigned int tick) {
+		return log.find("\"message\":\"tick " + boost::lexical_cast<std::string>(tick) + "\"") != std::string::npos;
+	}
+}
+
+TEST(EngineCore, EnginesSideBySideKeepTheirOwnGlobalsAndLogs) {
+	std::shared_ptr<TestOS> first_os(new TestOS());
+	std::shared_ptr<TestOS> second_os(new TestOS());
+	bool first_result = false, second_result = false;
+	
+	// The same scripts, updated a different number of times, at the same time.
+	boost::barrier started(2);
+	boost::thread first(boost::bind(&RunEngine, first_os, 3, boost::ref(started), boost::ref(first_result)));
+	boost::thread second(boost::bind(&RunEngine, second_os, 5, boost::ref(started), boost::ref(second_result)));
+	first.join();
+	second.join();
+	ASSERT_TRUE(first_result);
+	ASSERT_TRUE(second_result);
+	
+	// Had the script globals or the logs been shared, the counts would run together or land in the one file.
+	std::string first_log(first_os->ReadLog());
+	EXPECT_TRUE(Logged(first_log, 3));
+	EXPECT_FALSE(Logged(first_log, 4));
+	
+	std::string second_log(second_os->ReadLog());
+	EXPECT_TRUE(Logged(second_log, 5));
+	EXPECT_FALSE(Logged(second_log, 6));
+}
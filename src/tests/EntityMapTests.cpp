@@ -0,0 +1,292 @@
+/**
+* \file
+* \author agent
+* \date 2026-10-19
+* \brief Tests of EntityMap semantics.
+*/
+
+#include "UnitTest.h"
+
+// Standard Includes
+#include <string>
+#include <vector>
+
+// Library Includes
+
+// Local Includes
+#include "../sharedbase/ComponentInterface.h"
+#include "../sharedbase/Entity.h"
+#include "../sharedbase/ModuleInterface.h"
+#include "../enginecore/EntityMap.h"
+
+// Local Types
+namespace {
+	/// Counts the components it is asked to remove, leaving their deletion to the caller.
+	class CountingModule : public ModuleInterface {
+	public:
+		CountingModule() : removed(0) { }
+		
+		void Update(double) { }
+		
+		WHO_DELETES::TYPE RemoveComponent(ComponentInterface*) {
+			++this->removed;
+			return WHO_DELETES::CALLER;
+		}
+		
+		unsigned int removed;
+	};
+}
+
+TEST(EntityMap, AddAndFind) {
+	EntityMap map;
+	EntitySPTR entity(Entity::Factory("player"));
+	
+	ASSERT_TRUE(map.AddEntity(entity));
+	EXPECT_TRUE(map.FindEntity("player") == entity);
+	EXPECT_TRUE(map.FindEntity("nobody").get() == nullptr);
+	EXPECT_EQ(map.GetEntities().size(), 1u);
+}
+
+TEST(EntityMap, RejectsDuplicateUnnamedAndNull) {
+	EntityMap map;
+	EntitySPTR first(Entity::Factory("crate"));
+	
+	EXPECT_TRUE(map.AddEntity(first));
+	EXPECT_FALSE(map.AddEntity(Entity::Factory("crate")));
+	EXPECT_FALSE(map.AddEntity(Entity::Factory()));
+	EXPECT_FALSE(map.AddEntity(EntitySPTR()));
+	
+	// The first entity added under a name keeps it.
+	EXPECT_TRUE(map.FindEntity("crate") == first);
+	EXPECT_EQ(map.GetEntities().size(), 1u);
+}
+
+TEST(EntityMap, Remove) {
+	EntityMap map;
+	EntitySPTR entity(Entity::Factory("door"));
+	
+	map.AddEntity(entity);
+	
+	EXPECT_TRUE(map.RemoveEntity("door"));
+	EXPECT_FALSE(map.RemoveEntity("door"));
+	EXPECT_TRUE(map.FindEntity("door").get() == nullptr);
+	EXPECT_TRUE(map.GetEntities().empty());
+	
+	// The name is free for reuse.
+	EXPECT_TRUE(map.AddEntity(Entity::Factory("door")));
+}
+
+TEST(EntityMap, RemoveMany) {
+	EntityMap map;
+	const char* names[] = {"tree", "rock", "bush", "cloud"};
+	
+	for (unsigned int index = 0; index < 4; ++index) {
+		map.AddEntity(Entity::Factory(names[index]));
+	}
+	
+	std::vector<std::string> removing;
+	removing.push_back("rock");
+	removing.push_back("cloud");
+	removing.push_back("nobody");
+	
+	EXPECT_EQ(map.RemoveEntities(removing), 2u);
+	EXPECT_EQ(map.GetEntities().size(), 2u);
+	EXPECT_TRUE(map.FindEntity("rock").get() == nullptr);
+	EXPECT_TRUE(map.FindEntity("tree").get() != nullptr);
+}
+
+TEST(EntityMap, DestroysRemovedEntitiesLater) {
+	EntityMap map;
+	CountingModule module;
+	EntitySPTR parent(Entity::Factory("cart"));
+	EntitySPTR child(Entity::Factory("wheel"));
+	
+	new ComponentInterface(parent, &module);
+	child->SetParent(parent);
+	map.AddEntity(parent);
+	map.AddEntity(child);
+	
+	// Removal only takes it out of the map.
+	EXPECT_TRUE(map.RemoveEntity("cart"));
+	EXPECT_TRUE(parent->IsDestroyed());
+	EXPECT_FALSE(child->IsDestroyed());
+	EXPECT_TRUE(child->GetParent() == parent);
+	EXPECT_EQ(module.removed, 0u);
+	
+	map.DestroyRemovedEntities();
+	EXPECT_EQ(module.removed, 1u);
+	EXPECT_TRUE(child->GetParent().get() == nullptr);
+	
+	// Nothing left to do.
+	map.DestroyRemovedEntities();
+	EXPECT_EQ(module.removed, 1u);
+}
+
+TEST(EntityMap, RemoveSubtree) {
+	EntityMap map;
+	EntitySPTR house(Entity::Factory("house"));
+	EntitySPTR room(Entity::Factory("room"));
+	EntitySPTR chair(Entity::Factory("chair"));
+	EntitySPTR unnamed(Entity::Factory());
+	EntitySPTR garden(Entity::Factory("garden"));
+	
+	room->SetParent(house);
+	chair->SetParent(room);
+	unnamed->SetParent(room);
+	map.AddEntity(house);
+	map.AddEntity(room);
+	map.AddEntity(chair);
+	map.AddEntity(garden);
+	
+	EXPECT_EQ(map.RemoveSubtree("room"), 2u);
+	EXPECT_EQ(map.GetEntities().size(), 2u);
+	EXPECT_TRUE(chair->IsDestroyed());
+	EXPECT_FALSE(unnamed->IsDestroyed());
+	
+	map.DestroyRemovedEntities();
+	EXPECT_TRUE(house->GetFirstChild() == nullptr);
+	EXPECT_TRUE(unnamed->GetParent().get() == nullptr);
+	EXPECT_TRUE(chair->GetParent().get() == nullptr);
+	EXPECT_EQ(map.RemoveSubtree("room"), 0u);
+}
+
+TEST(EntityMap, ReaddedEntityIsNotDestroyed) {
+	EntityMap map;
+	CountingModule module;
+	EntitySPTR entity(Entity::Factory("lamp"));
+	
+	new ComponentInterface(entity, &module);
+	map.AddEntity(entity);
+	
+	map.RemoveEntity("lamp");
+	EXPECT_TRUE(map.AddEntity(entity));
+	EXPECT_FALSE(entity->IsDestroyed());
+	
+	map.DestroyRemovedEntities();
+	EXPECT_EQ(module.removed, 0u);
+	
+	entity->ClearComponents(); // The map outlives the module.
+}
+
+TEST(EntityMap, ReaddedAfterTheFrameItWasRemovedIn) {
+	EntityMap map;
+	CountingModule module;
+	EntitySPTR entity(Entity::Factory("crate"));
+	
+	new ComponentInterface(entity, &module);
+	map.AddEntity(entity);
+	
+	map.RemoveEntity("crate");
+	map.DestroyRemovedEntities();
+	EXPECT_EQ(module.removed, 1u);
+	EXPECT_FALSE(entity->IsDestroyed());
+	
+	// Back in the world, with nothing left over from the last time it was removed.
+	new ComponentInterface(entity, &module);
+	EXPECT_TRUE(map.AddEntity(entity));
+	EXPECT_FALSE(entity->IsDestroyed());
+	map.DestroyRemovedEntities();
+	EXPECT_EQ(module.removed, 1u);
+	
+	// And removed again.
+	EXPECT_TRUE(map.RemoveEntity("crate"));
+	EXPECT_TRUE(entity->IsDestroyed());
+	map.DestroyRemovedEntities();
+	EXPECT_EQ(module.removed, 2u);
+}
+
+TEST(EntityMap, IteratesInNameOrder) {
+	EntityMap map;
+	const char* names[] = {"delta", "alpha", "charlie", "bravo"};
+	
+	for (unsigned int index = 0; index < 4; ++index) {
+		map.AddEntity(Entity::Factory(names[index]));
+	}
+	
+	const char* sorted[] = {"alpha", "bravo", "charlie", "delta"};
+	unsigned int index = 0;
+	for (NamedEntityMap::const_iterator entity_it = map.GetEntities().begin(); entity_it != map.GetEntities().end(); ++entity_it, ++index) {
+		ASSERT_TRUE(index < 4);
+		EXPECT_EQ(entity_it->second->GetName(), std::string(sorted[index]));
+	}
+	EXPECT_EQ(index, 4u);
+}
+
+TEST(EntityMap, ListsEachChangedEntityOnce) {
+	EntityMap map;
+	EntitySPTR moved(Entity::Factory("moved"));
+	EntitySPTR still(Entity::Factory("still"));
+	EntitySPTR gone(Entity::Factory("gone"));
+	map.AddEntity(moved);
+	map.AddEntity(still);
+	map.AddEntity(gone);
+	
+	// Newly added entities count as changed.
+	std::vector<EntitySPTR> changed;
+	map.TakeChangedEntities(changed);
+	EXPECT_EQ(changed.size(), 3u);
+	
+	map.TakeChangedEntities(changed);
+	EXPECT_TRUE(changed.empty());
+	
+	moved->SetPosition(1.0f, 2.0f, 3.0f);
+	moved->ChangeScale(2.0f);
+	gone->SetScale(3.0f);
+	EXPECT_TRUE(map.RemoveEntity("gone"));
+	
+	map.TakeChangedEntities(changed);
+	ASSERT_EQ(changed.size(), 1u);
+	EXPECT_TRUE(changed[0] == moved);
+	
+	// Written directly, the change is only listed once marked.
+	still->location = glm::vec3(4.0f, 5.0f, 6.0f);
+	map.TakeChangedEntities(changed);
+	EXPECT_TRUE(changed.empty());
+	still->MarkChanged();
+	map.TakeChangedEntities(changed);
+	ASSERT_EQ(changed.size(), 1u);
+	EXPECT_TRUE(changed[0] == still);
+}
+
+TEST(EntityMap, ListsReaddedEntityOnce) {
+	EntityMap map;
+	EntitySPTR entity(Entity::Factory("crate"));
+	map.AddEntity(entity);
+	
+	std::vector<EntitySPTR> changed;
+	map.TakeChangedEntities(changed);
+	
+	entity->SetScale(2.0f);
+	EXPECT_TRUE(map.RemoveEntity("crate"));
+	EXPECT_TRUE(map.AddEntity(entity));
+	map.DestroyRemovedEntities();
+	
+	map.TakeChangedEntities(changed);
+	ASSERT_EQ(changed.size(), 1u);
+	EXPECT_TRUE(changed[0] == entity);
+}
+
+TEST(EntityMap, ListsEntitiesHeldByScriptsEveryTime) {
+	EntityMap map;
+	EntitySPTR entity(Entity::Factory("crate"));
+	map.AddEntity(entity);
+	
+	std::vector<EntitySPTR> changed;
+	map.TakeChangedEntities(changed);
+	
+	// A script taking a handle may write the fields from then on.
+	Entity* handle = Entity::ToScriptHandle(entity);
+	for (int take = 0; take < 3; ++take) {
+		map.TakeChangedEntities(changed);
+		ASSERT_EQ(changed.size(), 1u);
+		EXPECT_TRUE(changed[0] == entity);
+	}
+	
+	// Still listed once more after the handle goes, for whatever was written last.
+	handle->location.x = 1.0f;
+	handle->ReleaseScriptReference();
+	map.TakeChangedEntities(changed);
+	EXPECT_EQ(changed.size(), 1u);
+	map.TakeChangedEntities(changed);
+	EXPECT_TRUE(changed.empty());
+}
@@ -0,0 +1,420 @@
+/**
+* \file
+* \author agent
+* \date 2026-10-19
+* \brief Tests of Entity hierarchy and transform math.
+*/
+
+#include "UnitTest.h"
+
+// Standard Includes
+#include <memory>
+#include <string>
+#include <vector>
+
+// Library Includes
+
+// Local Includes
+#include "../sharedbase/ComponentInterface.h"
+#include "../sharedbase/Entity.h"
+#include "../sharedbase/ModuleInterface.h"
+
+// Local Types
+namespace {
+	struct Chain {
+		std::vector<EntitySPTR> entities;
+		std::vector<glm::vec3> positions;
+		std::vector<glm::fquat> rotations;
+		std::vector<float> scales;
+		
+		/// Builds a parent-to-child chain with assorted, non-trivial transforms.
+		Chain(unsigned int depth) {
+			for (unsigned int level = 0; level < depth; ++level) {
+				EntitySPTR entity(Entity::Factory());
+				
+				glm::vec3 position(1.0f + level, 0.5f * level - 2.0f, 0.25f);
+				glm::fquat rotation(glm::normalize(glm::fquat(glm::vec3(0.1f * (level + 1), -0.2f, 0.3f * level))));
+				float scale = 0.5f + 0.25f * level;
+				
+				entity->SetPosition(position.x, position.y, position.z);
+				entity->SetRotation(rotation);
+				entity->SetScale(scale);
+				
+				if (!this->entities.empty()) {
+					entity->SetParent(this->entities.back());
+				}
+				
+				this->entities.push_back(entity);
+				this->positions.push_back(position);
+				this->rotations.push_back(rotation);
+				this->scales.push_back(scale);
+			}
+		}
+		
+		// Reference world transform: compose the parent's world transform with the local one, recursively.
+		glm::fquat WorldRotation(size_t index) const {
+			return index == 0 ? this->rotations[0] : this->WorldRotation(index - 1) * this->rotations[index];
+		}
+		
+		float WorldScale(size_t index) const {
+			return index == 0 ? this->scales[0] : this->WorldScale(index - 1) * this->scales[index];
+		}
+		
+		/// A child's position is in its parent's space: rotated and scaled by the parent's world transform.
+		glm::vec3 WorldPosition(size_t index) const {
+			if (index == 0) {
+				return this->positions[0];
+			}
+			return this->WorldPosition(index - 1) + this->WorldRotation(index - 1) * (this->WorldScale(index - 1) * this->positions[index]);
+		}
+	};
+	
+	/// Counts the components it is asked to remove, leaving their deletion to the caller.
+	class CountingModule : public ModuleInterface {
+	public:
+		CountingModule() : batches(0), removed(0) { }
+		
+		void Update(double) { }
+		
+		WHO_DELETES::TYPE RemoveComponent(ComponentInterface*) {
+			++this->removed;
+			return WHO_DELETES::CALLER;
+		}
+		
+		WHO_DELETES::TYPE RemoveComponents(ComponentInterface* const*, std::size_t count) {
+			++this->batches;
+			this->removed += static_cast<unsigned int>(count);
+			return WHO_DELETES::CALLER;
+		}
+		
+		unsigned int batches;
+		unsigned int removed;
+	};
+}
+
+TEST(Entity, DefaultTransform) {
+	EntitySPTR entity(Entity::Factory("default"));
+	
+	EXPECT_EQ(entity->GetName(), std::string("default"));
+	EXPECT_TRUE(entity->GetParent().get() == nullptr);
+	EXPECT_NEAR(entity->GetWorldPosition(), glm::vec3(0.0f, 0.0f, 0.0f), 1e-6f);
+	EXPECT_NEAR(entity->GetWorldRotation(), glm::fquat(1.0f, 0.0f, 0.0f, 0.0f), 1e-6f);
+	EXPECT_NEAR(entity->GetWorldScale(), 1.0f, 1e-6f);
+}
+
+TEST(Entity, DefaultParentLeavesChildUnturned) {
+	EntitySPTR parent(Entity::Factory("parent"));
+	EntitySPTR child(Entity::Factory("child"));
+	child->SetPosition(1.0f, 2.0f, 3.0f);
+	child->SetParent(parent);
+	
+	// A parent whose rotation was never set must not turn its children: GLM takes w first, so (0, 0, 0, 1) would be half a turn about z.
+	EXPECT_NEAR(child->GetWorldPosition(), glm::vec3(1.0f, 2.0f, 3.0f), 1e-6f);
+	EXPECT_NEAR(child->GetWorldRotation(), glm::fquat(1.0f, 0.0f, 0.0f, 0.0f), 1e-6f);
+}
+
+TEST(Entity, WorldTransformMatchesReference) {
+	Chain chain(8);
+	
+	for (size_t index = 0; index < chain.entities.size(); ++index) {
+		EXPECT_NEAR(chain.entities[index]->GetWorldPosition(), chain.WorldPosition(index), 1e-3f);
+		EXPECT_NEAR(chain.entities[index]->GetWorldRotation(), chain.WorldRotation(index), 1e-5f);
+		EXPECT_NEAR(chain.entities[index]->GetWorldScale(), chain.WorldScale(index), 1e-5f);
+		
+		glm::vec3 position;
+		glm::fquat rotation;
+		float scale;
+		chain.entities[index]->GetWorldTransform(position, rotation, scale);
+		EXPECT_NEAR(position, chain.WorldPosition(index), 1e-3f);
+		EXPECT_NEAR(rotation, chain.WorldRotation(index), 1e-5f);
+		EXPECT_NEAR(scale, chain.WorldScale(index), 1e-5f);
+	}
+}
+
+TEST(Entity, BatchWorldTransformsMatchSingle) {
+	Chain chain(8);
+	
+	// Siblings under the middle of the chain, listed before and after their ancestors, with a repeat, a root, and a null.
+	std::vector<EntitySPTR> entities;
+	for (unsigned int index = 0; index < 4; ++index) {
+		EntitySPTR sibling(Entity::Factory());
+		sibling->SetPosition(0.5f * index, 1.0f, -1.0f);
+		sibling->SetParent(chain.entities[4]);
+		entities.push_back(sibling);
+	}
+	entities.insert(entities.end(), chain.entities.rbegin(), chain.entities.rend());
+	entities.push_back(chain.entities[4]);
+	entities.push_back(Entity::Factory());
+	entities.push_back(EntitySPTR());
+	
+	std::vector<glm::vec3> positions(entities.size());
+	std::vector<glm::fquat> rotations(entities.size());
+	std::vector<float> scales(entities.size());
+	Entity::GetWorldTransforms(entities, &positions[0], &rotations[0], &scales[0]);
+	
+	for (size_t index = 0; index + 1 < entities.size(); ++index) {
+		EXPECT_NEAR(positions[index], entities[index]->GetWorldPosition(), 1e-3f);
+		EXPECT_NEAR(rotations[index], entities[index]->GetWorldRotation(), 1e-5f);
+		EXPECT_NEAR(scales[index], entities[index]->GetWorldScale(), 1e-5f);
+	}
+	EXPECT_NEAR(positions.back(), glm::vec3(0.0f, 0.0f, 0.0f), 1e-6f);
+	EXPECT_NEAR(scales.back(), 1.0f, 1e-6f);
+	
+	// Outputs not wanted may be null.
+	std::vector<float> only_scales(entities.size(), -1.0f);
+	Entity::GetWorldTransforms(entities, nullptr, nullptr, &only_scales[0]);
+	EXPECT_NEAR(only_scales[0], scales[0], 1e-6f);
+}
+
+TEST(Entity, MatricesMatchTransforms) {
+	Chain chain(6);
+	const Entity& leaf = *chain.entities.back();
+	
+	glm::vec3 points[3] = {glm::vec3(0.0f, 0.0f, 0.0f), glm::vec3(1.0f, -2.0f, 0.5f), glm::vec3(-3.0f, 4.0f, 8.0f)};
+	glm::vec3 world[3];
+	leaf.TransformPoints(points, world, 3);
+	
+	// The entity's origin is its world position, and other points go through the same chain of transforms.
+	EXPECT_NEAR(world[0], leaf.GetWorldPosition(), 1e-3f);
+	glm::vec3 expected = leaf.GetWorldPosition() + leaf.GetWorldRotation() * (leaf.GetWorldScale() * points[1]);
+	EXPECT_NEAR(world[1], expected, 1e-3f);
+	
+	// And back again, in place.
+	leaf.InverseTransformPoints(world, world, 3);
+	for (unsigned int index = 0; index < 3; ++index) {
+		EXPECT_NEAR(world[index], points[index], 1e-3f);
+	}
+	
+	glm::vec4 local_origin = chain.entities[2]->GetLocalInverseMatrix() * glm::vec4(chain.positions[2], 1.0f);
+	EXPECT_NEAR(glm::vec3(local_origin.x, local_origin.y, local_origin.z), glm::vec3(0.0f, 0.0f, 0.0f), 1e-4f);
+}
+
+TEST(Entity, MatricesFollowChanges) {
+	Chain chain(3);
+	const Entity& leaf = *chain.entities.back();
+	glm::vec3 origin(0.0f, 0.0f, 0.0f), result;
+	
+	leaf.TransformPoints(&origin, &result, 1);
+	EXPECT_NEAR(result, leaf.GetWorldPosition(), 1e-4f);
+	
+	// A field written directly on an ancestor.
+	chain.entities[0]->location = glm::vec3(10.0f, 20.0f, 30.0f);
+	leaf.TransformPoints(&origin, &result, 1);
+	EXPECT_NEAR(result, leaf.GetWorldPosition(), 1e-4f);
+	
+	// The entity's own rotation and scale.
+	chain.entities[2]->SetRotation(0.5f, -0.25f, 1.0f);
+	chain.entities[2]->SetScale(3.0f);
+	glm::vec3 unit(1.0f, 0.0f, 0.0f);
+	leaf.TransformPoints(&unit, &result, 1);
+	EXPECT_NEAR(result, leaf.GetWorldPosition() + leaf.GetWorldRotation() * (leaf.GetWorldScale() * unit), 1e-4f);
+	
+	// A new parent.
+	EntitySPTR other(Entity::Factory());
+	other->SetPosition(-5.0f, 0.0f, 0.0f);
+	chain.entities[2]->SetParent(other);
+	leaf.TransformPoints(&origin, &result, 1);
+	EXPECT_NEAR(result, leaf.GetWorldPosition(), 1e-4f);
+	
+	chain.entities[2]->SetParent(EntitySPTR());
+	leaf.InverseTransformPoints(&chain.positions[2], &result, 1);
+	EXPECT_NEAR(result, origin, 1e-4f);
+}
+
+TEST(Entity, ChangeTransform) {
+	EntitySPTR entity(Entity::Factory());
+	
+	entity->SetPosition(1.0f, 2.0f, 3.0f);
+	entity->ChangePosition(glm::vec3(-1.0f, 1.0f, 0.5f));
+	EXPECT_NEAR(entity->GetWorldPosition(), glm::vec3(0.0f, 3.0f, 3.5f), 1e-6f);
+	
+	entity->SetScale(2.0f);
+	entity->ChangeScale(1.5f);
+	EXPECT_NEAR(entity->GetWorldScale(), 3.0f, 1e-6f);
+	
+	glm::fquat first(glm::normalize(glm::fquat(glm::vec3(0.3f, 0.0f, 0.0f))));
+	glm::fquat second(glm::normalize(glm::fquat(glm::vec3(0.0f, 0.2f, 0.1f))));
+	entity->SetRotation(first);
+	entity->ChangeRotation(second);
+	EXPECT_NEAR(entity->GetWorldRotation(), first * second, 1e-5f);
+	
+	// The combined calls match the separate ones.
+	EntitySPTR combined(Entity::Factory());
+	combined->SetTransform(glm::vec3(1.0f, 2.0f, 3.0f), first, 2.0f);
+	combined->ChangeTransform(glm::vec3(-1.0f, 1.0f, 0.5f), second, 1.5f);
+	EXPECT_NEAR(combined->location, entity->location, 1e-6f);
+	EXPECT_NEAR(combined->rotation, entity->rotation, 1e-6f);
+	EXPECT_NEAR(combined->scale, entity->scale, 1e-6f);
+}
+
+TEST(Entity, RejectsParentingCycles) {
+	Chain chain(4);
+	
+	// Parenting the root to its own descendant must be refused.
+	chain.entities[0]->SetParent(chain.entities[3]);
+	EXPECT_TRUE(chain.entities[0]->GetParent().get() == nullptr);
+	
+	// Nor may an entity that has a parent be moved under its own descendant, or under itself.
+	chain.entities[1]->SetParent(chain.entities[2]);
+	EXPECT_TRUE(chain.entities[1]->GetParent() == chain.entities[0]);
+	chain.entities[1]->SetParent(chain.entities[1]);
+	EXPECT_TRUE(chain.entities[1]->GetParent() == chain.entities[0]);
+	
+	// While reparenting elsewhere is fine, up the entity's own line included.
+	chain.entities[3]->SetParent(chain.entities[1]);
+	EXPECT_TRUE(chain.entities[3]->GetParent() == chain.entities[1]);
+	chain.entities[3]->SetParent(chain.entities[0]);
+	EXPECT_TRUE(chain.entities[3]->GetParent() == chain.entities[0]);
+	
+	chain.entities[3]->SetParent(EntitySPTR());
+	EXPECT_TRUE(chain.entities[3]->GetParent().get() == nullptr);
+}
+
+TEST(Entity, ChildListsAndDepth) {
+	EntitySPTR root(Entity::Factory("root"));
+	EntitySPTR left(Entity::Factory("left"));
+	EntitySPTR right(Entity::Factory("right"));
+	EntitySPTR leaf(Entity::Factory("leaf"));
+	
+	left->SetParent(root);
+	right->SetParent(root);
+	leaf->SetParent(left);
+	
+	EXPECT_EQ(root->GetDepth(), 0u);
+	EXPECT_EQ(leaf->GetDepth(), 2u);
+	EXPECT_TRUE(root->IsAncestorOrSelf(leaf.get()));
+	EXPECT_FALSE(right->IsAncestorOrSelf(leaf.get()));
+	
+	// Children are listed newest first.
+	EXPECT_TRUE(root->GetFirstChild() == right.get());
+	EXPECT_TRUE(right->GetNextSibling() == left.get());
+	EXPECT_TRUE(left->GetNextSibling() == nullptr);
+	
+	// Moving a branch updates the depths under it.
+	left->SetParent(right);
+	EXPECT_TRUE(root->GetFirstChild() == right.get());
+	EXPECT_TRUE(right->GetNextSibling() == nullptr);
+	EXPECT_TRUE(right->GetFirstChild() == left.get());
+	EXPECT_EQ(leaf->GetDepth(), 3u);
+	
+	left->SetParent(EntitySPTR());
+	EXPECT_TRUE(right->GetFirstChild() == nullptr);
+	EXPECT_EQ(left->GetDepth(), 0u);
+	EXPECT_EQ(leaf->GetDepth(), 1u);
+}
+
+TEST(Entity, SubtreeWalksDepthFirst) {
+	EntitySPTR root(Entity::Factory("root"));
+	EntitySPTR a(Entity::Factory("a"));
+	EntitySPTR b(Entity::Factory("b"));
+	EntitySPTR a1(Entity::Factory("a1"));
+	EntitySPTR a2(Entity::Factory("a2"));
+	EntitySPTR outside(Entity::Factory("outside"));
+	
+	b->SetParent(root);
+	a->SetParent(root);
+	a2->SetParent(a);
+	a1->SetParent(a);
+	
+	std::string order;
+	for (Entity::SubtreeIterator entity_it = root->SubtreeBegin(); entity_it != root->SubtreeEnd(); ++entity_it) {
+		order += entity_it->GetName() + " ";
+	}
+	EXPECT_EQ(order, std::string("root a a1 a2 b "));
+	
+	// A walk of a branch stays in the branch.
+	order.clear();
+	for (Entity::SubtreeIterator entity_it = a->SubtreeBegin(); entity_it != a->SubtreeEnd(); ++entity_it) {
+		order += entity_it->GetName() + " ";
+	}
+	EXPECT_EQ(order, std::string("a a1 a2 "));
+	
+	// Skipping the children of a moves straight on to b.
+	Entity::SubtreeIterator entity_it = ++root->SubtreeBegin();
+	entity_it.SkipChildren();
+	EXPECT_TRUE(&*entity_it == b.get());
+	
+	EXPECT_TRUE(++outside->SubtreeBegin() == outside->SubtreeEnd());
+}
+
+TEST(Entity, BulkReparent) {
+	Chain chain(3);
+	std::vector<EntitySPTR> loose;
+	for (unsigned int index = 0; index < 3; ++index) {
+		loose.push_back(Entity::Factory());
+	}
+	
+	Entity::SetParent(loose, chain.entities[2]);
+	for (unsigned int index = 0; index < 3; ++index) {
+		EXPECT_TRUE(loose[index]->GetParent() == chain.entities[2]);
+		EXPECT_EQ(loose[index]->GetDepth(), 3u);
+	}
+	
+	// The chain's root can't go under its own descendant, but the others still move.
+	loose.push_back(chain.entities[0]);
+	Entity::SetParent(loose, chain.entities[1]);
+	EXPECT_TRUE(chain.entities[0]->GetParent().get() == nullptr);
+	EXPECT_TRUE(loose[0]->GetParent() == chain.entities[1]);
+	EXPECT_EQ(loose[0]->GetDepth(), 2u);
+}
+
+TEST(Entity, ClearComponentsBatchesByModule) {
+	CountingModule physics, graphics, legacy;
+	ModuleInterface::SetInterfaceVersion(&legacy, 1); // Built before RemoveComponents existed.
+	
+	std::vector<EntitySPTR> entities;
+	for (unsigned int index = 0; index < 3; ++index) {
+		EntitySPTR entity(Entity::Factory());
+		new ComponentInterface(entity, &physics);
+		new ComponentInterface(entity, &graphics);
+		new ComponentInterface(entity, &legacy);
+		entities.push_back(entity);
+	}
+	
+	Entity::ClearComponents(entities);
+	
+	EXPECT_EQ(physics.batches, 1u);
+	EXPECT_EQ(physics.removed, 3u);
+	EXPECT_EQ(graphics.batches, 1u);
+	EXPECT_EQ(graphics.removed, 3u);
+	EXPECT_EQ(legacy.batches, 0u);
+	EXPECT_EQ(legacy.removed, 3u);
+	
+	ModuleInterface::ForgetInterfaceVersion(&legacy);
+	EXPECT_EQ(ModuleInterface::GetInterfaceVersion(&legacy), MODULE_INTERFACE_VERSION);
+	
+	// A single entity is cleared the same way.
+	EntitySPTR single(Entity::Factory());
+	new ComponentInterface(single, &physics);
+	new ComponentInterface(single, &physics);
+	single->ClearComponents();
+	
+	EXPECT_EQ(physics.batches, 2u);
+	EXPECT_EQ(physics.removed, 5u);
+}
+
+TEST(Entity, ScriptHandlesKeepEntityAlive) {
+	Entity* handle = Entity::ScriptFactory("scripted");
+	std::weak_ptr<Entity> watcher(handle->shared_from_this());
+	
+	// A copy of the handle, then an EntitySPTR taken and dropped by native code.
+	handle->AddScriptReference();
+	Entity::FromScriptHandle(handle).reset();
+	EXPECT_FALSE(watcher.expired());
+	
+	// Native code can keep the entity after the last handle goes.
+	EntitySPTR held(watcher.lock());
+	handle->ReleaseScriptReference();
+	EXPECT_FALSE(watcher.expired());
+	
+	Entity* again = Entity::ToScriptHandle(held);
+	EXPECT_TRUE(again == held.get());
+	held.reset();
+	EXPECT_FALSE(watcher.expired());
+	
+	again->ReleaseScriptReference();
+	EXPECT_TRUE(watcher.expired());
+	
+	EXPECT_TRUE(Entity::ToScriptHandle(EntitySPTR()) == nullptr);
+	EXPECT_FALSE(Entity::FromScriptHandle(nullptr));
+}
@@ -0,0 +1,196 @@
+/**
+* \file
+* \author agent
+* \date 2026-10-19
+* \brief Tests of Envelope storage and serialization round trips.
+*/
+
+#include "UnitTest.h"
+
+// Standard Includes
+#include <fstream>
+#include <string>
+#include <typeinfo>
+
+// Library Includes
+#include <boost/filesystem.hpp>
+
+// Local Includes
+#include "../sharedbase/Envelope.h"
+
+// Local Types
+namespace {
+	/// A file in the temp folder that is removed when the test ends.
+	struct TempFile {
+		TempFile() : path((boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("nlstest-%%%%%%%%")).string()) {}
+		
+		~TempFile() {
+			boost::system::error_code error;
+			boost::filesystem::remove(this->path, error);
+		}
+		
+		std::string path;
+	};
+	
+	EnvelopeSPTR MakeEnvelope() {
+		EnvelopeSPTR envelope(new Envelope());
+		envelope->msgid = 42;
+		
+		envelope->AddData(true);
+		envelope->AddData(-7);
+		envelope->AddData(3000000000u);
+		envelope->AddData(2.5f);
+		envelope->AddData(std::string("a \"quoted\" string\nwith a newline"));
+		envelope->AddData(glm::vec3(1.0f, -2.0f, 3.5f));
+		envelope->AddData(glm::fquat(0.5f, 0.5f, -0.5f, 0.5f));
+		
+		EnvelopeSPTR nested(new Envelope());
+		nested->msgid = 7;
+		nested->AddData(std::string("inner"));
+		nested->AddData(12);
+		envelope->AddData(nested);
+		
+		return envelope;
+	}
+	
+	void ExpectMatches(const EnvelopeSPTR& envelope) {
+		ASSERT_EQ(envelope->GetCount(), 8u);
+		EXPECT_EQ(envelope->msgid, 42);
+		
+		EXPECT_EQ(envelope->GetDataBool(0), true);
+		EXPECT_EQ(envelope->GetDataInt(1), -7);
+		EXPECT_EQ(envelope->GetDataUInt(2), 3000000000u);
+		EXPECT_NEAR(envelope->GetDataFloat(3), 2.5f, 1e-6f);
+		EXPECT_EQ(envelope->GetDataString(4), std::string("a \"quoted\" string\nwith a newline"));
+		EXPECT_NEAR(envelope->GetDataVector(5), glm::vec3(1.0f, -2.0f, 3.5f), 1e-6f);
+		EXPECT_NEAR(envelope->GetDataQuat(6), glm::fquat(0.5f, 0.5f, -0.5f, 0.5f), 1e-6f);
+		
+		EnvelopeSPTR nested(envelope->GetDataEnvelopeSPTR(7));
+		ASSERT_TRUE(nested.get() != nullptr);
+		EXPECT_EQ(nested->msgid, 7);
+		ASSERT_EQ(nested->GetCount(), 2u);
+		EXPECT_EQ(nested->GetDataString(0), std::string("inner"));
+		EXPECT_EQ(nested->GetDataInt(1), 12);
+	}
+}
+
+TEST(Envelope, AddAndGetData) {
+	ExpectMatches(MakeEnvelope());
+}
+
+TEST(Envelope, Clone) {
+	EnvelopeSPTR original(MakeEnvelope());
+	EnvelopeSPTR copy(original->Clone());
+	
+	// Changing the original afterward must not show through.
+	original->AddData(99);
+	original->GetDataEnvelopeSPTR(7)->AddData(100);
+	
+	ExpectMatches(copy);
+}
+
+TEST(Envelope, BinaryBufferRoundTrip) {
+	std::shared_ptr<std::vector<char> > buffer(new std::vector<char>());
+	MakeEnvelope()->SaveToBinaryBuffer(*buffer);
+	
+	EnvelopeSPTR loaded(new Envelope());
+	ASSERT_TRUE(loaded->LoadFromBinaryBuffer(buffer));
+	
+	ExpectMatches(loaded);
+}
+
+TEST(Envelope, BinaryRejectsTruncatedData) {
+	std::shared_ptr<std::vector<char> > buffer(new std::vector<char>());
+	MakeEnvelope()->SaveToBinaryBuffer(*buffer);
+	buffer->resize(buffer->size() / 2);
+	
+	EnvelopeSPTR loaded(new Envelope());
+	EXPECT_FALSE(loaded->LoadFromBinaryBuffer(buffer));
+}
+
+TEST(Envelope, BinaryFileRoundTrip) {
+	TempFile file;
+	
+	ASSERT_TRUE(SaveToDiskBinary(MakeEnvelope(), file.path));
+	
+	EnvelopeSPTR loaded(new Envelope());
+	ASSERT_TRUE(LoadFromDisk(loaded, file.path));
+	
+	ExpectMatches(loaded);
+}
+
+TEST(Envelope, TextFileRoundTrip) {
+	TempFile file;
+	
+	ASSERT_TRUE(SaveToDisk(MakeEnvelope(), file.path));
+	
+	EnvelopeSPTR loaded(new Envelope());
+	ASSERT_TRUE(LoadFromDisk(loaded, file.path));
+	
+	ExpectMatches(loaded);
+}
+
+TEST(Envelope, SaveOverTheFileBeingDecoded) {
+	TempFile file;
+	
+	ASSERT_TRUE(SaveToDiskBinary(MakeEnvelope(), file.path));
+	
+	EnvelopeSPTR loaded(new Envelope());
+	ASSERT_TRUE(LoadFromDisk(loaded, file.path));
+	EnvelopeSPTR undecoded(loaded->Clone()); // Shares the mapping, with nothing decoded yet.
+	
+	loaded->AddData(std::string("changed"));
+	ASSERT_TRUE(SaveToDiskBinary(loaded, file.path));
+	
+	// Decoded from the copy taken as the mapping was closed, rather than the file that replaced it.
+	ExpectMatches(undecoded);
+	
+	EnvelopeSPTR saved(new Envelope());
+	ASSERT_TRUE(LoadFromDisk(saved, file.path));
+	ASSERT_EQ(saved->GetCount(), 9u);
+	EXPECT_EQ(saved->GetDataString(8), std::string("changed"));
+}
+
+TEST(Envelope, FailedSaveLeavesNoTempFile) {
+	TempFile file;
+	
+	// A folder can't be replaced by a file.
+	ASSERT_TRUE(boost::filesystem::create_directory(file.path));
+	
+	EXPECT_FALSE(SaveToDiskBinary(MakeEnvelope(), file.path));
+	EXPECT_FALSE(boost::filesystem::exists(file.path + ".tmp"));
+	
+	EXPECT_FALSE(SaveToDisk(MakeEnvelope(), file.path));
+	EXPECT_FALSE(boost::filesystem::exists(file.path + ".tmp"));
+}
+
+TEST(Envelope, TextFileKeyedByTypeidNamesLoads) {
+	TempFile file;
+	
+	// As written before the keys were spelled out: scalars under this compiler's typeid names, colors with no "color" level.
+	{
+		std::ofstream out(file.path.c_str());
+		out << "{\"NLS_SD_1_0_0\":{\"message_id\":\"42\",\"data\":{"
+			<< "\"item0\":{\"" << typeid(bool).name() << "\":\"true\"},"
+			<< "\"item1\":{\"" << typeid(int).name() << "\":\"-7\"},"
+			<< "\"item2\":{\"" << typeid(unsigned int).name() << "\":\"3000000000\"},"
+			<< "\"item3\":{\"" << typeid(float).name() << "\":\"2.5\"},"
+			<< "\"item4\":{\"r\":\"0.25\",\"g\":\"0.5\",\"b\":\"0.75\",\"a\":\"1\"}"
+			<< "}}}";
+	}
+	
+	EnvelopeSPTR loaded(new Envelope());
+	ASSERT_TRUE(LoadFromDisk(loaded, file.path));
+	ASSERT_EQ(loaded->GetCount(), 5u);
+	EXPECT_EQ(loaded->msgid, 42);
+	EXPECT_EQ(loaded->GetDataBool(0), true);
+	EXPECT_EQ(loaded->GetDataInt(1), -7);
+	EXPECT_EQ(loaded->GetDataUInt(2), 3000000000u);
+	EXPECT_NEAR(loaded->GetDataFloat(3), 2.5f, 1e-6f);
+	
+	glm::vec4 color(loaded->GetDataColor(4));
+	EXPECT_NEAR(color.r, 0.25f, 1e-6f);
+	EXPECT_NEAR(color.g, 0.5f, 1e-6f);
+	EXPECT_NEAR(color.b, 0.75f, 1e-6f);
+	EXPECT_NEAR(color.a, 1.0f, 1e-6f);
+}
@@ -0,0 +1,127 @@
+/**
+* \file
+* \author agent
+* \date 2026-10-19
+* \brief Tests that the EventLogger writes valid JSON logs.
+*/
+
+#include "UnitTest.h"
+
+// Standard Includes
+#include <string>
+
+// Library Includes
+#include <boost/filesystem.hpp>
+#include <boost/property_tree/json_parser.hpp>
+#include <boost/property_tree/ptree.hpp>
+#include <boost/scoped_ptr.hpp>
+
+// Local Includes
+#include "../sharedbase/EventLogger.h"
+
+// Local Types
+namespace {
+	/// A private logger writing to a file in a fresh temp folder, all removed when the test ends.
+	struct TempLog {
+		TempLog() :
+			folder(boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("nlstest-%%%%%%%%")),
+			elog(EventLogger::CreateEventLogger())
+			{
+			boost::filesystem::create_directories(this->folder);
+			this->path = (this->folder / "test.log").string();
+			this->elog->SetLogFile(this->path);
+		}
+		
+		~TempLog() {
+			this->elog.reset();
+			
+			boost::system::error_code error;
+			boost::filesystem::remove_all(this->folder, error);
+		}
+		
+		/// Parses the log, failing the test if it isn't valid JSON.  Returns the array of entries.
+		boost::property_tree::ptree Read() {
+			boost::property_tree::ptree tree;
+			
+			try {
+				boost::property_tree::read_json(this->path, tree);
+			}
+			catch (boost::property_tree::json_parser_error&) {
+				ASSERT_TRUE(!"log is valid JSON");
+			}
+			
+			// The key contains a period, so use another separator for the path.
+			return tree.get_child(boost::property_tree::ptree::path_type("NLSEngineLogVersion1.0", '/'), boost::property_tree::ptree());
+		}
+		
+		boost::filesystem::path folder;
+		std::string path;
+		boost::scoped_ptr<EventLogger> elog;
+	};
+}
+
+TEST(EventLogger, WritesValidJSON) {
+	TempLog log;
+	
+	{
+		EventLogger::ThreadBinding log_binding(log.elog.get());
+		
+		LOG(LOG_PRIORITY::INFO, "plain message");
+		LOG(LOG_PRIORITY::WARN, "quotes \" backslashes \\ slashes / and\ttabs\r\nnewlines");
+		LOG(LOG_PRIORITY::ERR, "");
+		LOG(LOG_PRIORITY::INFO, "bell \a and escape \x1b");
+	}
+	
+	boost::property_tree::ptree entries(log.Read());
+	ASSERT_EQ(entries.size(), 5u); // The "log file created" entry, then ours.
+	
+	boost::property_tree::ptree::const_iterator entry_it = entries.begin();
+	++entry_it;
+	
+	EXPECT_EQ(entry_it->second.get<std::string>("message"), std::string("plain message"));
+	EXPECT_EQ(entry_it->second.get<std::string>("level"), LOG_PRIORITY::PRINTABLE_NOTICES[LOG_PRIORITY::INFO]);
+	EXPECT_TRUE(entry_it->second.get<std::string>("function").find("EventLoggerTests.cpp") != std::string::npos);
+	EXPECT_TRUE(entry_it->second.get<std::string>("time").size() > 0);
+	++entry_it;
+	
+	EXPECT_EQ(entry_it->second.get<std::string>("message"), std::string("quotes \" backslashes \\ slashes / and\ttabs\r\nnewlines"));
+	++entry_it;
+	
+	EXPECT_EQ(entry_it->second.get<std::string>("message"), std::string(""));
+	++entry_it;
+	
+	EXPECT_EQ(entry_it->second.get<std::string>("message"), std::string("bell \a and escape \x1b"));
+}
+
+TEST(EventLogger, ThreadBindingRoutesAndRestores) {
+	TempLog outer;
+	TempLog inner;
+	
+	{
+		EventLogger::ThreadBinding outer_binding(outer.elog.get());
+		EXPECT_TRUE(EventLogger::GetEventLogger() == outer.elog.get());
+		
+		{
+			EventLogger::ThreadBinding inner_binding(inner.elog.get());
+			EXPECT_TRUE(EventLogger::GetEventLogger() == inner.elog.get());
+			LOG(LOG_PRIORITY::INFO, "inner");
+		}
+		
+		EXPECT_TRUE(EventLogger::GetEventLogger() == outer.elog.get());
+		LOG(LOG_PRIORITY::INFO, "outer");
+	}
+	
+	EXPECT_TRUE(EventLogger::GetEventLogger() != outer.elog.get());
+	
+	EXPECT_EQ(inner.Read().size(), 2u);
+	EXPECT_EQ(outer.Read().size(), 2u);
+}
+
+TEST(EventLogger, ArchivesPreviousLog) {
+	TempLog log;
+	
+	log.elog->SetLogFile(log.path);
+	
+	EXPECT_TRUE(boost::filesystem::exists(log.path + ".1"));
+	EXPECT_EQ(log.Read().size(), 1u);
+}
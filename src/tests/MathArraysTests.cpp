@@ -0,0 +1,207 @@
+/**
+* \file
+* \author agent
+* \date 2026-10-19
+* \brief Tests of VectorArray and RotationArray bulk math against the same math done one element at a time.
+*/
+
+#include "UnitTest.h"
+
+// Standard Includes
+#include <cstddef>
+#include <vector>
+
+// Library Includes
+#include <boost/random/mersenne_twister.hpp>
+#include <boost/random/uniform_real_distribution.hpp>
+
+// Local Includes
+#include "../sharedbase/MathArrays.h"
+
+// Local Types
+namespace {
+	/// Arrays of random values, sized so that both the four-at-a-time loops and their leftovers are exercised.
+	struct RandomArrays {
+		RandomArrays(std::size_t count) : vectors(new VectorArray()), others(new VectorArray()), rotations(new RotationArray()), otherRotations(new RotationArray()) {
+			boost::random::mt19937 generator(20120824u);
+			boost::random::uniform_real_distribution<float> coordinate(-10.0f, 10.0f);
+			boost::random::uniform_real_distribution<float> angle(-3.0f, 3.0f);
+			
+			for (std::size_t index = 0; index < count; ++index) {
+				this->vectors->PushBack(glm::vec3(coordinate(generator), coordinate(generator), coordinate(generator)));
+				this->others->PushBack(glm::vec3(coordinate(generator), coordinate(generator), coordinate(generator)));
+				this->rotations->PushBack(glm::normalize(glm::fquat(glm::vec3(angle(generator), angle(generator), angle(generator)))));
+				this->otherRotations->PushBack(glm::normalize(glm::fquat(glm::vec3(angle(generator), angle(generator), angle(generator)))));
+			}
+			
+			this->originalVectors.assign(this->vectors->GetData(), this->vectors->GetData() + count);
+			this->originalRotations.assign(this->rotations->GetData(), this->rotations->GetData() + count);
+		}
+		
+		~RandomArrays() {
+			this->vectors->Release();
+			this->others->Release();
+			this->rotations->Release();
+			this->otherRotations->Release();
+		}
+		
+		VectorArray* vectors;
+		VectorArray* others;
+		RotationArray* rotations;
+		RotationArray* otherRotations;
+		std::vector<glm::vec3> originalVectors;
+		std::vector<glm::fquat> originalRotations;
+	};
+	
+	/// Compares rotations up to sign, as q and -q are the same rotation.
+	float RotationDifference(const glm::fquat& lhs, const glm::fquat& rhs) {
+		float dot = lhs.x * rhs.x + lhs.y * rhs.y + lhs.z * rhs.z + lhs.w * rhs.w;
+		return 1.0f - (dot < 0.0f ? -dot : dot);
+	}
+}
+
+TEST(MathArrays, StorageIsAlignedAndKeepsValues) {
+	VectorArray* vectors = new VectorArray(3, glm::vec3(1.0f, 2.0f, 3.0f));
+	
+	for (unsigned int index = 0; index < 50; ++index) {
+		vectors->PushBack(glm::vec3(static_cast<float>(index), 0.0f, 0.0f));
+		EXPECT_EQ(reinterpret_cast<std::size_t>(vectors->GetData()) % VectorArray::ALIGNMENT, 0u);
+	}
+	
+	ASSERT_EQ(vectors->GetSize(), 53u);
+	EXPECT_NEAR((*vectors)[1], glm::vec3(1.0f, 2.0f, 3.0f), 1e-6f);
+	EXPECT_NEAR((*vectors)[52], glm::vec3(49.0f, 0.0f, 0.0f), 1e-6f);
+	
+	VectorArray* copy = new VectorArray();
+	copy->Assign(*vectors);
+	vectors->Resize(2);
+	vectors->Resize(4);
+	EXPECT_NEAR((*vectors)[3], glm::vec3(0.0f, 0.0f, 0.0f), 1e-6f);
+	EXPECT_EQ(copy->GetSize(), 53u);
+	EXPECT_NEAR((*copy)[52], glm::vec3(49.0f, 0.0f, 0.0f), 1e-6f);
+	
+	RotationArray* rotations = new RotationArray(2);
+	EXPECT_NEAR((*rotations)[1], glm::fquat(1.0f, 0.0f, 0.0f, 0.0f), 1e-6f);
+	
+	vectors->Release();
+	copy->Release();
+	rotations->Release();
+}
+
+TEST(MathArrays, VectorArithmeticMatchesScalar) {
+	RandomArrays arrays(39);
+	VectorArray& vectors = *arrays.vectors;
+	const VectorArray& others = *arrays.others;
+	glm::vec3 offset(0.5f, -1.5f, 2.25f);
+	
+	vectors.Add(offset);
+	ASSERT_TRUE(vectors.Add(others));
+	ASSERT_TRUE(vectors.AddScaled(others, 0.25f));
+	vectors.Scale(1.5f);
+	ASSERT_TRUE(vectors.Subtract(others));
+	ASSERT_TRUE(vectors.Lerp(others, 0.3f));
+	
+	for (std::size_t index = 0; index < vectors.GetSize(); ++index) {
+		glm::vec3 expected = arrays.originalVectors[index] + offset + others[index] + others[index] * 0.25f;
+		expected = expected * 1.5f - others[index];
+		expected = expected + (others[index] - expected) * 0.3f;
+		EXPECT_NEAR(vectors[index], expected, 1e-4f);
+	}
+	
+	VectorArray* low = new VectorArray();
+	VectorArray* high = new VectorArray();
+	low->Assign(vectors);
+	high->Assign(vectors);
+	ASSERT_TRUE(low->Min(others));
+	ASSERT_TRUE(high->Max(others));
+	
+	glm::vec3 bounds_low, bounds_high;
+	ASSERT_TRUE(vectors.GetBounds(bounds_low, bounds_high));
+	glm::vec3 expected_low(vectors[0]), expected_high(vectors[0]);
+	for (std::size_t index = 0; index < vectors.GetSize(); ++index) {
+		EXPECT_NEAR((*low)[index], glm::min(vectors[index], others[index]), 1e-6f);
+		EXPECT_NEAR((*high)[index], glm::max(vectors[index], others[index]), 1e-6f);
+		expected_low = glm::min(expected_low, vectors[index]);
+		expected_high = glm::max(expected_high, vectors[index]);
+	}
+	EXPECT_NEAR(bounds_low, expected_low, 1e-6f);
+	EXPECT_NEAR(bounds_high, expected_high, 1e-6f);
+	
+	low->Release();
+	high->Release();
+}
+
+TEST(MathArrays, VectorRotationMatchesScalar) {
+	RandomArrays arrays(23);
+	VectorArray& vectors = *arrays.vectors;
+	const RotationArray& rotations = *arrays.rotations;
+	glm::fquat rotation(glm::normalize(glm::fquat(glm::vec3(0.4f, -1.1f, 0.7f))));
+	
+	vectors.Rotate(rotation);
+	ASSERT_TRUE(vectors.Rotate(rotations));
+	
+	for (std::size_t index = 0; index < vectors.GetSize(); ++index) {
+		glm::vec3 expected = glm::rotate(rotations[index], glm::rotate(rotation, arrays.originalVectors[index]));
+		EXPECT_NEAR(vectors[index], expected, 1e-4f);
+	}
+}
+
+TEST(MathArrays, RotationArithmeticMatchesScalar) {
+	RandomArrays arrays(17);
+	RotationArray& rotations = *arrays.rotations;
+	const RotationArray& others = *arrays.otherRotations;
+	glm::fquat delta(glm::normalize(glm::fquat(glm::vec3(-0.2f, 0.9f, 0.1f))));
+	
+	rotations.Multiply(delta);
+	ASSERT_TRUE(rotations.Multiply(others));
+	
+	for (std::size_t index = 0; index < rotations.GetSize(); ++index) {
+		EXPECT_NEAR(RotationDifference(rotations[index], arrays.originalRotations[index] * delta * others[index]), 0.0f, 1e-5f);
+	}
+	
+	// Halfway along the shorter arc is the normalized sum, with the target flipped when on the far side.
+	RotationArray* halfway = new RotationArray();
+	halfway->Assign(rotations);
+	(*halfway)[0] = glm::fquat(-(*halfway)[0].w, -(*halfway)[0].x, -(*halfway)[0].y, -(*halfway)[0].z);
+	ASSERT_TRUE(halfway->Nlerp(others, 0.5f));
+	
+	for (std::size_t index = 0; index < rotations.GetSize(); ++index) {
+		glm::fquat from(rotations[index]), to(others[index]);
+		if (from.x * to.x + from.y * to.y + from.z * to.z + from.w * to.w < 0.0f) {
+			to = glm::fquat(-to.w, -to.x, -to.y, -to.z);
+		}
+		glm::fquat expected(glm::normalize(glm::fquat(from.w + to.w, from.x + to.x, from.y + to.y, from.z + to.z)));
+		EXPECT_NEAR(RotationDifference((*halfway)[index], expected), 0.0f, 1e-5f);
+	}
+	
+	// Scaled rotations normalize back to themselves, and a zero rotation becomes the identity.
+	(*halfway)[1] = glm::fquat(2.0f * others[1].w, 2.0f * others[1].x, 2.0f * others[1].y, 2.0f * others[1].z);
+	(*halfway)[2] = glm::fquat(0.0f, 0.0f, 0.0f, 0.0f);
+	halfway->Normalize();
+	EXPECT_NEAR((*halfway)[1], others[1], 1e-5f);
+	EXPECT_NEAR((*halfway)[2], glm::fquat(1.0f, 0.0f, 0.0f, 0.0f), 1e-6f);
+	
+	halfway->Release();
+}
+
+TEST(MathArrays, MismatchedLengthsAreRejected) {
+	RandomArrays arrays(8);
+	VectorArray* shorter = new VectorArray(5);
+	RotationArray* shorter_rotations = new RotationArray(5);
+	
+	EXPECT_FALSE(arrays.vectors->Add(*shorter));
+	EXPECT_FALSE(arrays.vectors->Lerp(*shorter, 0.5f));
+	EXPECT_FALSE(arrays.vectors->Rotate(*shorter_rotations));
+	EXPECT_FALSE(arrays.rotations->Nlerp(*shorter_rotations, 0.5f));
+	
+	for (std::size_t index = 0; index < arrays.vectors->GetSize(); ++index) {
+		EXPECT_NEAR((*arrays.vectors)[index], arrays.originalVectors[index], 1e-6f);
+	}
+	
+	glm::vec3 low, high;
+	shorter->Clear();
+	EXPECT_FALSE(shorter->GetBounds(low, high));
+	
+	shorter->Release();
+	shorter_rotations->Release();
+}
@@ -0,0 +1,440 @@
+/**
+* \file
+* \author agent
+* \date 2026-10-19
+* \brief Tests of ModuleManager with modules built into the test, including one laid out as an older module library is.
+*/
+
+#include "UnitTest.h"
+
+// Standard Includes
+#include <cstddef>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// Library Includes
+#include <angelscript.h>
+#include <boost/chrono.hpp>
+#include <boost/filesystem.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/thread.hpp>
+
+// Local Includes
+#include "../sharedbase/ComponentInterface.h"
+#include "../sharedbase/Entity.h"
+#include "../sharedbase/EventLogger.h"
+#include "../sharedbase/ModuleInterface.h"
+#include "../sharedbase/OSInterface.h"
+#include "../enginecore/ModuleManager.h"
+#include "../enginecore/ScriptEngine.h"
+
+// Local Types
+namespace {
+	/// ModuleInterface as it was at version 1, which module libraries built back then have the vtable of.
+	class ModuleInterfaceVersion1 {
+	public:
+		virtual ~ModuleInterfaceVersion1(void) {};
+		virtual void Update(double dt) = 0;
+		virtual WHO_DELETES::TYPE RemoveComponent(ComponentInterface*) = 0;
+		virtual void Register(asIScriptEngine* const) { }
+	protected:
+		ModuleInterfaceVersion1() {};
+	};
+	
+	/// A module as built against version 1, recording which of its methods are called.
+	class LegacyModule : public ModuleInterfaceVersion1 {
+	public:
+		LegacyModule(unsigned int* deleted) : updates(0), removed(0), registered(nullptr), deleted(deleted) { }
+		~LegacyModule() { ++*this->deleted; }
+		
+		void Update(double) {
+			++this->updates;
+		}
+		
+		WHO_DELETES::TYPE RemoveComponent(ComponentInterface*) {
+			++this->removed;
+			return WHO_DELETES::CALLER;
+		}
+		
+		void Register(asIScriptEngine* const as_engine) {
+			this->registered = as_engine;
+		}
+		
+		unsigned int updates;
+		unsigned int removed;
+		asIScriptEngine* registered;
+		unsigned int* deleted;
+	};
+	
+	/// What the engine sees of a module library's module: a ModuleInterface, whatever version it was built against.
+	ModuleInterface* AsLoaded(ModuleInterfaceVersion1* module) {
+		return reinterpret_cast<ModuleInterface*>(module);
+	}
+	
+	/// Keeps the thread busy for the given milliseconds, as a module doing real work would.
+	void Spend(double milliseconds) {
+		boost::chrono::steady_clock::time_point end = boost::chrono::steady_clock::now() + boost::chrono::duration_cast<boost::chrono::steady_clock::duration>(boost::chrono::duration<double, boost::milli>(milliseconds));
+		while (boost::chrono::steady_clock::now() < end) { }
+	}
+	
+	/// A module of the given priority that takes the given time to update, recording when it was updated and with what dt.
+	class TimedModule : public ModuleInterface {
+	public:
+		TimedModule(const std::string& name, UPDATE_PRIORITY::TYPE priority, double cost, const unsigned int* frame = nullptr, std::vector<std::string>* order = nullptr) :
+			name(name), priority(priority), cost(cost), frame(frame), order(order) { }
+		
+		void Update(double dt) {
+			if (this->order != nullptr) {
+				this->order->push_back(this->name);
+			}
+			this->frames.push_back((this->frame != nullptr) ? *this->frame : 0);
+			this->dts.push_back(dt);
+			
+			Spend(this->cost);
+		}
+		
+		WHO_DELETES::TYPE RemoveComponent(ComponentInterface*) {
+			return WHO_DELETES::CALLER;
+		}
+		
+		UPDATE_PRIORITY::TYPE GetUpdatePriority() const {
+			return this->priority;
+		}
+		
+		std::string name;
+		UPDATE_PRIORITY::TYPE priority;
+		double cost; ///< Milliseconds each update takes.
+		const unsigned int* frame; ///< The frame being run, if given.
+		std::vector<std::string>* order; ///< Where to note the module's name as it is updated, if given.
+		
+		std::vector<unsigned int> frames; ///< The frame of each update.
+		std::vector<double> dts; ///< The dt of each update.
+	};
+	
+#ifdef _WIN32
+	const std::string LIBRARY_EXTENSION(".dll");
+#else
+	const std::string LIBRARY_EXTENSION(".so");
+#endif
+	
+	/**
+	* \brief An OS whose module libraries are copies of the nlstestmodule library in a folder of their own.
+	* \details The test module reports what is done to it through ShowInfo, which notes each message and the thread it came from.
+	*/
+	class TestOS : public OSInterface {
+	public:
+		TestOS() : folder(boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("nlstest-%%%%%%%%")) {
+			boost::filesystem::create_directory(this->folder);
+		}
+		
+		~TestOS() {
+			boost::system::error_code error;
+			boost::filesystem::remove_all(this->folder, error);
+		}
+		
+		boost::any CreateGUIWindow(int, int, std::string, WINDOW_FLAGS) { return boost::any(); }
+		void ShowWarning(std::string, std::string) { }
+		void ShowError(std::string, std::string) { }
+		void RouteMessages() { }
+		std::string GetPath(SYSTEM_DIRS::TYPE) { return this->folder.string(); }
+		EventLogger* GetLogger() { return EventLogger::GetEventLogger(); }
+		bool IsRunning() { return true; }
+		
+		void ShowInfo(std::string message, std::string) {
+			boost::mutex::scoped_lock lock(this->mutex);
+			this->messages.push_back(message);
+			this->threads.push_back(boost::this_thread::get_id());
+		}
+		
+		/// Adds a copy of the test module library under the given module name.
+		void AddLibrary(const std::string& name) {
+			boost::filesystem::copy_file(std::string(NLS_ENGINE_TEST_MODULES_PATH) + "/nlstestmodule" + LIBRARY_EXTENSION, this->GetLibrary(name));
+		}
+		
+		/// Adds a file under the given module name that isn't a library at all.
+		void AddBrokenLibrary(const std::string& name) {
+			std::ofstream out(this->GetLibrary(name).c_str());
+			out << "not a library";
+		}
+		
+		/// Moves the write time of the library on, as a rebuild would.
+		void Rebuild(const std::string& name) {
+			std::time_t write_time = boost::filesystem::last_write_time(this->GetLibrary(name));
+			boost::filesystem::last_write_time(this->GetLibrary(name), write_time + 10);
+		}
+		
+		/// How many messages were shown starting with the given text.
+		unsigned int Count(const std::string& prefix) {
+			boost::mutex::scoped_lock lock(this->mutex);
+			unsigned int count = 0;
+			for (std::vector<std::string>::const_iterator message_it = this->messages.begin(); message_it != this->messages.end(); ++message_it) {
+				count += (message_it->compare(0, prefix.size(), prefix) == 0) ? 1 : 0;
+			}
+			return count;
+		}
+		
+		/// The last message shown, or empty if none.
+		std::string GetLastMessage() {
+			boost::mutex::scoped_lock lock(this->mutex);
+			return this->messages.empty() ? "" : this->messages.back();
+		}
+		
+		/// The thread the message was first shown from.
+		boost::thread::id GetThread(const std::string& message) {
+			boost::mutex::scoped_lock lock(this->mutex);
+			for (std::size_t index = 0; index < this->messages.size(); ++index) {
+				if (this->messages[index] == message) {
+					return this->threads[index];
+				}
+			}
+			return boost::thread::id();
+		}
+		
+	private:
+		std::string GetLibrary(const std::string& name) const {
+			return (this->folder / (name + LIBRARY_EXTENSION)).string();
+		}
+		
+		boost::filesystem::path folder;
+		boost::mutex mutex;
+		std::vector<std::string> messages;
+		std::vector<boost::thread::id> threads;
+	};
+	
+	/**
+	* \brief Updates the manager until messages starting with the text have been shown the given number of times.
+	* \details Hot reloading checks for rebuilds once a second, and loads them in the background, so this takes a while.
+	* \param[in,out] updates Counts the updates made.
+	* \return False if they weren't shown within a few seconds.
+	*/
+	bool UpdateUntil(ModuleManager& manager, TestOS& os, const std::string& prefix, unsigned int count, unsigned int& updates) {
+		for (unsigned int attempt = 0; attempt < 50 && os.Count(prefix) < count; ++attempt) {
+			manager.Update(0.016);
+			++updates;
+			boost::this_thread::sleep(boost::posix_time::milliseconds(100));
+		}
+		return os.Count(prefix) >= count;
+	}
+}
+
+TEST(ModuleManager, Version1ModuleIsCalledThroughItsOwnVtable) {
+	unsigned int deleted = 0;
+	LegacyModule* legacy = new LegacyModule(&deleted);
+	ModuleInterface* module = AsLoaded(legacy);
+	ModuleInterface::SetInterfaceVersion(module, 1); // As OpenModule does for a library without ModuleInterfaceVersion().
+	
+	ScriptEngine engine;
+	ModuleManager manager((OSInterfaceSPTR()));
+	manager.RegisterScriptEngine(&engine);
+	ASSERT_TRUE(manager.AddModule("legacy", module));
+	EXPECT_TRUE(legacy->registered == engine.GetasIScriptEngine());
+	
+	manager.Update(0.016);
+	manager.Update(0.016);
+	EXPECT_EQ(legacy->updates, 2u);
+	
+	// Components are removed one at a time, as the module is too old for RemoveComponents.
+	{
+		EntitySPTR entity(Entity::Factory());
+		new ComponentInterface(entity, module);
+		new ComponentInterface(entity, module);
+		entity->ClearComponents();
+	}
+	EXPECT_EQ(legacy->removed, 2u);
+	EXPECT_EQ(legacy->updates, 2u);
+	
+	manager.Shutdown();
+	EXPECT_EQ(deleted, 1u);
+	EXPECT_EQ(ModuleInterface::GetInterfaceVersion(module), MODULE_INTERFACE_VERSION);
+}
+
+TEST(ModuleManager, UpdatesInPriorityOrder) {
+	std::vector<std::string> order;
+	ModuleManager manager((OSInterfaceSPTR()));
+	
+	manager.AddModule("a_low",      new TimedModule("a_low",      UPDATE_PRIORITY::LOW,      0.0, nullptr, &order));
+	manager.AddModule("b_critical", new TimedModule("b_critical", UPDATE_PRIORITY::CRITICAL, 0.0, nullptr, &order));
+	manager.AddModule("c_normal",   new TimedModule("c_normal",   UPDATE_PRIORITY::NORMAL,   0.0, nullptr, &order));
+	manager.AddModule("d_high",     new TimedModule("d_high",     UPDATE_PRIORITY::HIGH,     0.0, nullptr, &order));
+	manager.AddModule("e_critical", new TimedModule("e_critical", UPDATE_PRIORITY::CRITICAL, 0.0, nullptr, &order));
+	
+	manager.Update(0.016);
+	
+	// By priority, then by name.
+	const char* expected[] = {"b_critical", "e_critical", "d_high", "c_normal", "a_low"};
+	ASSERT_EQ(order.size(), 5u);
+	for (unsigned int index = 0; index < 5; ++index) {
+		EXPECT_EQ(order[index], std::string(expected[index]));
+	}
+	
+	manager.Shutdown();
+}
+
+TEST(ModuleManager, SlowsLowPriorityModulesOverBudgetAndRelaxesAfter) {
+	TimedModule* slow = new TimedModule("slow", UPDATE_PRIORITY::LOW, 10.0);
+	ModuleManager manager((OSInterfaceSPTR()));
+	manager.AddModule("slow", slow);
+	manager.SetFrameBudget(1.0);
+	
+	for (unsigned int frame = 0; frame < 100 && manager.GetModuleUpdateInterval("slow") == 1; ++frame) {
+		manager.Update(0.016);
+	}
+	EXPECT_TRUE(manager.GetModuleUpdateInterval("slow") > 1u);
+	
+	// However far over budget, it is still updated every so often.
+	for (unsigned int frame = 0; frame < 100; ++frame) {
+		manager.Update(0.016);
+	}
+	EXPECT_TRUE(manager.GetModuleUpdateInterval("slow") <= 8u);
+	EXPECT_TRUE(slow->frames.size() > 100u / 8u);
+	
+	// Back under budget, it is updated every frame again, a step at a time.
+	slow->cost = 0.0;
+	for (unsigned int frame = 0; frame < 1000 && manager.GetModuleUpdateInterval("slow") > 1; ++frame) {
+		manager.Update(0.016);
+	}
+	EXPECT_EQ(manager.GetModuleUpdateInterval("slow"), 1u);
+	
+	manager.Shutdown();
+}
+
+TEST(ModuleManager, NeverSkipsCriticalModules) {
+	TimedModule* physics = new TimedModule("physics", UPDATE_PRIORITY::CRITICAL, 2.0);
+	TimedModule* ambient = new TimedModule("ambient", UPDATE_PRIORITY::LOW, 0.0);
+	ModuleManager manager((OSInterfaceSPTR()));
+	manager.AddModule("physics", physics);
+	manager.AddModule("ambient", ambient);
+	manager.SetFrameBudget(1.0);
+	
+	for (unsigned int frame = 0; frame < 100; ++frame) {
+		manager.Update(0.016);
+	}
+	
+	EXPECT_EQ(physics->frames.size(), 100u);
+	EXPECT_EQ(manager.GetModuleSkippedUpdates("physics"), 0u);
+	EXPECT_EQ(manager.GetModuleUpdateInterval("physics"), 1u);
+	
+	// Over budget from the critical module alone, so the low priority one gave way.
+	EXPECT_TRUE(manager.GetModuleSkippedUpdates("ambient") > 0u);
+	EXPECT_EQ(ambient->frames.size() + manager.GetModuleSkippedUpdates("ambient"), 100u);
+	
+	manager.Shutdown();
+}
+
+TEST(ModuleManager, SkippedModuleGetsTheTimeSinceItsLastUpdate) {
+	unsigned int frame = 0;
+	TimedModule* physics = new TimedModule("physics", UPDATE_PRIORITY::CRITICAL, 2.0);
+	TimedModule* ambient = new TimedModule("ambient", UPDATE_PRIORITY::LOW, 0.0, &frame);
+	ModuleManager manager((OSInterfaceSPTR()));
+	manager.AddModule("physics", physics);
+	manager.AddModule("ambient", ambient);
+	manager.SetFrameBudget(1.0);
+	
+	for (frame = 1; frame <= 50; ++frame) {
+		manager.Update(0.016);
+	}
+	
+	ASSERT_TRUE(ambient->frames.size() >= 2u);
+	
+	bool skipped = false;
+	unsigned int last_frame = 0;
+	for (unsigned int index = 0; index < ambient->frames.size(); ++index) {
+		unsigned int frames = ambient->frames[index] - last_frame;
+		EXPECT_NEAR(ambient->dts[index], frames * 0.016, 1e-9);
+		
+		skipped = skipped || (frames > 1);
+		last_frame = ambient->frames[index];
+	}
+	EXPECT_TRUE(skipped);
+	
+	manager.Shutdown();
+}
+
+TEST(ModuleManager, UnloadDiscardsPendingReload) {
+	std::shared_ptr<TestOS> os(new TestOS());
+	os->AddLibrary("hot");
+	
+	ModuleManager manager(os);
+	manager.SetHotReload(true);
+	ASSERT_EQ(manager.Load("hot"), MODULE_STATUS::LOADED);
+	
+	// Once the rebuild is constructed in the background, it is swapped in at the start of the next update.
+	unsigned int updates = 0;
+	os->Rebuild("hot");
+	ASSERT_TRUE(UpdateUntil(manager, *os, "constructed", 2, updates));
+	
+	manager.Unload("hot");
+	EXPECT_EQ(os->Count("deleted"), 2u);
+	EXPECT_EQ(manager.GetStatus("hot"), MODULE_STATUS::EXISTS);
+	
+	manager.Update(0.016);
+	EXPECT_EQ(os->Count("restored"), 0u);
+	EXPECT_EQ(os->Count("updated"), updates);
+	
+	manager.Shutdown();
+	EXPECT_EQ(os->Count("constructed"), 2u);
+}
+
+TEST(ModuleManager, AsyncLoadConstructsOnAWorkerThread) {
+	std::shared_ptr<TestOS> os(new TestOS());
+	os->AddLibrary("async");
+	
+	ModuleManager manager(os);
+	ASSERT_EQ(manager.LoadAsync("async"), MODULE_STATUS::LOADING);
+	EXPECT_EQ(manager.GetStatus("async"), MODULE_STATUS::LOADING);
+	
+	manager.FinishLoading();
+	EXPECT_EQ(manager.GetStatus("async"), MODULE_STATUS::LOADED);
+	EXPECT_EQ(os->Count("constructed"), 1u);
+	EXPECT_TRUE(os->GetThread("constructed") != boost::thread::id());
+	EXPECT_TRUE(os->GetThread("constructed") != boost::this_thread::get_id());
+	
+	manager.Update(0.016);
+	EXPECT_EQ(os->GetLastMessage(), "updated 1");
+	
+	manager.Shutdown();
+	EXPECT_EQ(os->Count("deleted"), 1u);
+}
+
+TEST(ModuleManager, FailedAsyncLoadLeavesNothingLoaded) {
+	std::shared_ptr<TestOS> os(new TestOS());
+	os->AddBrokenLibrary("broken");
+	
+	ModuleManager manager(os);
+	ASSERT_EQ(manager.LoadAsync("broken"), MODULE_STATUS::LOADING);
+	ASSERT_EQ(manager.LoadAsync("missing"), MODULE_STATUS::LOADING);
+	manager.FinishLoading();
+	
+	EXPECT_EQ(manager.GetStatus("broken"), MODULE_STATUS::EXISTS);
+	EXPECT_EQ(manager.GetStatus("missing"), MODULE_STATUS::NOT_FOUND);
+	
+	// Neither has a module to update.
+	manager.Update(0.016);
+	manager.Shutdown();
+	EXPECT_EQ(os->Count(""), 0u);
+}
+
+TEST(ModuleManager, HotReloadKeepsModuleState) {
+	std::shared_ptr<TestOS> os(new TestOS());
+	os->AddLibrary("hot");
+	
+	ModuleManager manager(os);
+	manager.SetHotReload(true);
+	ASSERT_EQ(manager.Load("hot"), MODULE_STATUS::LOADED);
+	
+	unsigned int updates = 0;
+	os->Rebuild("hot");
+	ASSERT_TRUE(UpdateUntil(manager, *os, "restored", 1, updates));
+	
+	// The old build saved its count before going, the new build carried on from it.
+	EXPECT_EQ(os->Count("constructed"), 2u);
+	EXPECT_EQ(os->Count("deleted"), 1u);
+	EXPECT_EQ(os->Count("restored " + boost::lexical_cast<std::string>(updates - 1)), 1u);
+	EXPECT_EQ(os->GetLastMessage(), "updated " + boost::lexical_cast<std::string>(updates));
+	EXPECT_EQ(manager.GetStatus("hot"), MODULE_STATUS::LOADED);
+	
+	manager.Shutdown();
+	EXPECT_EQ(os->Count("deleted"), 2u);
+}
@@ -0,0 +1,359 @@
+/**
+* \file
+* \author agent
+* \date 2026-10-19
+* \brief Tests run through a headless ScriptEngine: the script unit tests, and script math against Entity.
+*/
+
+#include "UnitTest.h"
+
+// Standard Includes
+#include <fstream>
+#include <sstream>
+#include <vector>
+
+// Library Includes
+#include <angelscript.h>
+#include <boost/filesystem.hpp>
+#include <boost/scoped_ptr.hpp>
+
+// Local Includes
+#include "../sharedbase/Entity.h"
+#include "../sharedbase/EventLogger.h"
+#include "../enginecore/EntityMap.h"
+#include "../enginecore/ScriptEngine.h"
+#include "../enginecore/ScriptExecutor.h"
+#include "../enginecore/ScriptProfiler.h"
+
+// Local Types
+namespace {
+	/// Composes a parent's world transform with a child's local position, using only script math.
+	const char* COMPOSE_SCRIPT =
+		"void Compose(const Vector &in parentPosition, const Rotation &in parentRotation, float parentScale, const Vector &in localPosition, Vector &out world) {\n"
+		"	Vector scaled(localPosition.x * parentScale, localPosition.y * parentScale, localPosition.z * parentScale);\n"
+		"	world = (scaled * parentRotation) + parentPosition;\n"
+		"}\n"
+	;
+	
+	/// Calls that never finish on their own, and calls that take a while.
+	const char* SLOW_SCRIPT =
+		"void Spin() {\n"
+		"	int count = 0;\n"
+		"	while (true) {\n"
+		"		count++;\n"
+		"	}\n"
+		"}\n"
+		"float Inner(uint count) {\n"
+		"	float sum = 0;\n"
+		"	for (uint i = 0; i < count; i++) {\n"
+		"		sum += i * 0.5f;\n"
+		"	}\n"
+		"	return sum;\n"
+		"}\n"
+		"void Outer() {\n"
+		"	Inner(200000);\n"
+		"}\n"
+	;
+	
+	/// Coroutines, and the functions that start and stop them.
+	const char* COROUTINE_SCRIPT =
+		"int ticks = 0;\n"
+		"int finished = 0;\n"
+		"uint lastID = 0;\n"
+		"bool stopped = false;\n"
+		"void Count() {\n"
+		"	for (int i = 0; i < 3; i++) {\n"
+		"		ticks++;\n"
+		"		Engine.Yield();\n"
+		"	}\n"
+		"	finished++;\n"
+		"}\n"
+		"void Sleep() {\n"
+		"	Engine.Wait(1.0);\n"
+		"	finished++;\n"
+		"}\n"
+		"void Forever() {\n"
+		"	while (true) {\n"
+		"		Engine.Yield();\n"
+		"	}\n"
+		"}\n"
+		"void StartCounts(uint count) {\n"
+		"	for (uint i = 0; i < count; i++) {\n"
+		"		lastID = Engine.StartCoroutine(@Count);\n"
+		"	}\n"
+		"}\n"
+		"void StartSleep() {\n"
+		"	lastID = Engine.StartCoroutine(@Sleep);\n"
+		"}\n"
+		"void StartForever() {\n"
+		"	lastID = Engine.StartCoroutine(@Forever);\n"
+		"}\n"
+		"void StopLast() {\n"
+		"	stopped = Engine.StopCoroutine(lastID);\n"
+		"}\n"
+		"void NotACoroutine() {\n"
+		"	Engine.Yield();\n"
+		"}\n"
+	;
+	
+	/// Writes to the fields of an entity in place.
+	const char* ENTITY_SCRIPT =
+		"void Move() {\n"
+		"	Engine::Entity@ crate = Engine::gEntMap.FindEntity(\"crate\");\n"
+		"	crate.positionOffset.x = 1;\n"
+		"	crate.scale *= 2;\n"
+		"}\n"
+	;
+	
+	bool LoadScriptText(ScriptEngine& engine, const std::string& text) {
+		boost::filesystem::path script_file(boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("nlstest-%%%%%%%%.as"));
+		{
+			std::ofstream out(script_file.string().c_str());
+			out << text;
+		}
+		
+		bool loaded = (engine.LoadScriptFile(script_file.string()) == SCRIPT_STATUS::LOAD_OK);
+		
+		boost::system::error_code error;
+		boost::filesystem::remove(script_file, error);
+		
+		return loaded;
+	}
+	
+	/// Runs a function of the enginecore module, with an optional argument, and returns the context's execution state.
+	int CallScript(ScriptEngine& engine, const std::string& decl, unsigned int argument = 0) {
+		boost::scoped_ptr<ScriptExecutor> exec(engine.ScriptExecutorFactory());
+		if (exec->PrepareFunction(decl, "enginecore") < 0) {
+			return -1;
+		}
+		if (argument > 0) {
+			exec->SetFunctionParam(0, argument);
+		}
+		return exec->ExecuteFunction();
+	}
+	
+	/// A global variable of the enginecore module.
+	template <typename T> T& ScriptGlobal(ScriptEngine& engine, const char* name) {
+		asIScriptModule* module = engine.GetasIScriptEngine()->GetModule("enginecore");
+		return *static_cast<T*>(module->GetAddressOfGlobalVar(module->GetGlobalVarIndexByName(name)));
+	}
+}
+
+TEST(ScriptEngine, ScriptUnitTests) {
+	ScriptEngine engine;
+	EventLogger::RegisterScriptEngine(&engine);
+	
+	ASSERT_EQ(engine.LoadScriptFile(std::string(NLS_ENGINE_SCRIPT_TESTS_PATH) + "/RunTests.as"), SCRIPT_STATUS::LOAD_OK);
+	
+	boost::scoped_ptr<ScriptExecutor> exec(engine.ScriptExecutorFactory());
+	ASSERT_TRUE(exec->PrepareFunction("void main()", "enginecore") >= 0);
+	
+	// Failures are logged by the script framework, which then aborts.
+	EXPECT_EQ(exec->ExecuteFunction(), static_cast<int>(asEXECUTION_FINISHED));
+}
+
+TEST(ScriptEngine, ScriptMathMatchesEntityTransform) {
+	ScriptEngine engine;
+	ASSERT_TRUE(LoadScriptText(engine, COMPOSE_SCRIPT));
+	
+	asIScriptEngine* as_engine = engine.GetasIScriptEngine();
+	asIScriptFunction* compose = as_engine->GetModule("enginecore")->GetFunctionByDecl("void Compose(const Vector &in, const Rotation &in, float, const Vector &in, Vector &out)");
+	ASSERT_TRUE(compose != nullptr);
+	
+	asIScriptContext* ctx = as_engine->CreateContext();
+	
+	EntitySPTR parent(Entity::Factory());
+	EntitySPTR child(Entity::Factory());
+	parent->SetPosition(3.0f, -1.0f, 2.0f);
+	parent->SetRotation(0.4f, -0.7f, 1.1f);
+	parent->SetScale(1.75f);
+	child->SetPosition(-2.0f, 0.5f, 4.0f);
+	child->SetParent(parent);
+	
+	glm::vec3 parent_position(parent->GetWorldPosition());
+	glm::fquat parent_rotation(parent->GetWorldRotation());
+	float parent_scale = parent->GetWorldScale();
+	glm::vec3 local_position(-2.0f, 0.5f, 4.0f);
+	glm::vec3 world;
+	
+	ctx->Prepare(compose);
+	ctx->SetArgAddress(0, &parent_position);
+	ctx->SetArgAddress(1, &parent_rotation);
+	ctx->SetArgFloat(2, parent_scale);
+	ctx->SetArgAddress(3, &local_position);
+	ctx->SetArgAddress(4, &world);
+	EXPECT_EQ(ctx->Execute(), static_cast<int>(asEXECUTION_FINISHED));
+	
+	EXPECT_NEAR(child->GetWorldPosition(), world, 1e-4f);
+	
+	ctx->Release();
+}
+
+TEST(ScriptEngine, EntityFieldsAreWrittenInPlace) {
+	ScriptEngine engine;
+	EntityMap map;
+	map.RegisterScriptEngine(&engine);
+	ASSERT_TRUE(LoadScriptText(engine, ENTITY_SCRIPT));
+	
+	EntitySPTR crate(Entity::Factory("crate"));
+	crate->SetPosition(0.0f, 2.0f, 3.0f);
+	crate->SetScale(1.5f);
+	map.AddEntity(crate);
+	
+	std::vector<EntitySPTR> changed;
+	map.TakeChangedEntities(changed);
+	
+	ASSERT_EQ(CallScript(engine, "void Move()"), static_cast<int>(asEXECUTION_FINISHED));
+	EXPECT_EQ(crate->location, glm::vec3(1.0f, 2.0f, 3.0f));
+	EXPECT_EQ(crate->scale, 3.0f);
+	
+	// Written with no call to say so, yet still listed for the snapshot.
+	map.TakeChangedEntities(changed);
+	ASSERT_EQ(changed.size(), 1u);
+	EXPECT_TRUE(changed[0] == crate);
+}
+
+TEST(ScriptEngine, TimeoutAbortsRunawayScript) {
+	ScriptEngine engine;
+	ASSERT_TRUE(LoadScriptText(engine, SLOW_SCRIPT));
+	
+	boost::scoped_ptr<ScriptExecutor> exec(engine.ScriptExecutorFactory());
+	ASSERT_TRUE(exec->PrepareFunction("void Spin()", "enginecore") >= 0);
+	EXPECT_EQ(exec->ExecuteFunction(0.05), static_cast<int>(asEXECUTION_ABORTED));
+	
+	// The engine's limit applies to calls made without one.
+	engine.SetScriptTimeout(0.05);
+	ASSERT_TRUE(exec->PrepareFunction("void Spin()", "enginecore") >= 0);
+	EXPECT_EQ(exec->ExecuteFunction(), static_cast<int>(asEXECUTION_ABORTED));
+	
+	// Calls that finish in time are left alone.
+	ASSERT_TRUE(exec->PrepareFunction("void Outer()", "enginecore") >= 0);
+	EXPECT_EQ(exec->ExecuteFunction(10.0), static_cast<int>(asEXECUTION_FINISHED));
+}
+
+TEST(ScriptEngine, ProfilerWritesFoldedStacks) {
+	ScriptEngine engine;
+	ASSERT_TRUE(LoadScriptText(engine, SLOW_SCRIPT));
+	
+	boost::filesystem::path profile_file(boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("nlstest-%%%%%%%%.folded"));
+	engine.StartProfiler(profile_file.string(), 0.0001);
+	ASSERT_TRUE(engine.GetProfiler());
+	
+	boost::scoped_ptr<ScriptExecutor> exec(engine.ScriptExecutorFactory());
+	ASSERT_TRUE(exec->PrepareFunction("void Outer()", "enginecore") >= 0);
+	EXPECT_EQ(exec->ExecuteFunction(), static_cast<int>(asEXECUTION_FINISHED));
+	
+	engine.StopProfiler();
+	EXPECT_FALSE(engine.GetProfiler());
+	
+	std::stringstream profile;
+	{
+		std::ifstream in(profile_file.string().c_str());
+		profile << in.rdbuf();
+	}
+	boost::system::error_code error;
+	boost::filesystem::remove(profile_file, error);
+	
+	// Each line is the stack, outermost first, then the microseconds spent in it.
+	std::string line;
+	bool found = false;
+	while (std::getline(profile, line)) {
+		std::string::size_type space = line.rfind(' ');
+		ASSERT_TRUE(space != std::string::npos);
+		if (line.compare(0, 6, "Outer:") == 0 && line.find(";Inner:") != std::string::npos) {
+			found = true;
+		}
+	}
+	EXPECT_TRUE(found);
+}
+
+TEST(ScriptEngine, CoroutinesYieldUntilTheNextUpdate) {
+	ScriptEngine engine;
+	ASSERT_TRUE(LoadScriptText(engine, COROUTINE_SCRIPT));
+	engine.SetCoroutineBudget(0.0);
+	
+	// Enough at once to run through the context pool in earnest.
+	ASSERT_EQ(CallScript(engine, "void StartCounts(uint)", 2000), static_cast<int>(asEXECUTION_FINISHED));
+	EXPECT_EQ(engine.GetCoroutineCount(), 2000u);
+	EXPECT_EQ(ScriptGlobal<int>(engine, "ticks"), 0); // Not until the next update.
+	
+	for (int update = 1; update <= 3; ++update) {
+		engine.UpdateCoroutines(0.016);
+		EXPECT_EQ(ScriptGlobal<int>(engine, "ticks"), update * 2000);
+		EXPECT_EQ(ScriptGlobal<int>(engine, "finished"), 0);
+	}
+	
+	engine.UpdateCoroutines(0.016);
+	EXPECT_EQ(ScriptGlobal<int>(engine, "finished"), 2000);
+	EXPECT_EQ(engine.GetCoroutineCount(), 0u);
+	
+	// The pooled contexts are used again.
+	ASSERT_EQ(CallScript(engine, "void StartCounts(uint)", 1), static_cast<int>(asEXECUTION_FINISHED));
+	for (int update = 0; update < 4; ++update) {
+		engine.UpdateCoroutines(0.016);
+	}
+	EXPECT_EQ(ScriptGlobal<int>(engine, "ticks"), 6003);
+	EXPECT_EQ(ScriptGlobal<int>(engine, "finished"), 2001);
+}
+
+TEST(ScriptEngine, CoroutinesWaitForGameTime) {
+	ScriptEngine engine;
+	ASSERT_TRUE(LoadScriptText(engine, COROUTINE_SCRIPT));
+	
+	ASSERT_EQ(CallScript(engine, "void StartSleep()"), static_cast<int>(asEXECUTION_FINISHED));
+	
+	engine.UpdateCoroutines(0.5); // Starts waiting, until 1.5.
+	engine.UpdateCoroutines(0.5);
+	EXPECT_EQ(ScriptGlobal<int>(engine, "finished"), 0);
+	EXPECT_EQ(engine.GetCoroutineCount(), 1u);
+	
+	engine.UpdateCoroutines(0.6);
+	EXPECT_EQ(ScriptGlobal<int>(engine, "finished"), 1);
+	EXPECT_EQ(engine.GetCoroutineCount(), 0u);
+}
+
+TEST(ScriptEngine, CoroutinesKeepToTheBudget) {
+	ScriptEngine engine;
+	ASSERT_TRUE(LoadScriptText(engine, COROUTINE_SCRIPT));
+	
+	ASSERT_EQ(CallScript(engine, "void StartCounts(uint)", 10), static_cast<int>(asEXECUTION_FINISHED));
+	
+	// A budget too small for anything still lets one through.
+	engine.SetCoroutineBudget(1e-9);
+	engine.UpdateCoroutines(0.016);
+	EXPECT_EQ(ScriptGlobal<int>(engine, "ticks"), 1);
+	
+	// Those left over go first, ahead of the one that already ran.
+	engine.SetCoroutineBudget(0.0);
+	engine.UpdateCoroutines(0.016);
+	EXPECT_EQ(ScriptGlobal<int>(engine, "ticks"), 11);
+}
+
+TEST(ScriptEngine, CoroutinesCanBeStopped) {
+	ScriptEngine engine;
+	ASSERT_TRUE(LoadScriptText(engine, COROUTINE_SCRIPT));
+	
+	ASSERT_EQ(CallScript(engine, "void StartForever()"), static_cast<int>(asEXECUTION_FINISHED));
+	engine.UpdateCoroutines(0.016);
+	engine.UpdateCoroutines(0.016);
+	EXPECT_EQ(engine.GetCoroutineCount(), 1u);
+	
+	ASSERT_EQ(CallScript(engine, "void StopLast()"), static_cast<int>(asEXECUTION_FINISHED));
+	EXPECT_TRUE(ScriptGlobal<bool>(engine, "stopped"));
+	EXPECT_EQ(engine.GetCoroutineCount(), 0u);
+	
+	// Already gone.
+	ASSERT_EQ(CallScript(engine, "void StopLast()"), static_cast<int>(asEXECUTION_FINISHED));
+	EXPECT_FALSE(ScriptGlobal<bool>(engine, "stopped"));
+	
+	// Coroutines still running when the engine goes are stopped with it.
+	ASSERT_EQ(CallScript(engine, "void StartForever()"), static_cast<int>(asEXECUTION_FINISHED));
+	engine.UpdateCoroutines(0.016);
+}
+
+TEST(ScriptEngine, OnlyCoroutinesYield) {
+	ScriptEngine engine;
+	ASSERT_TRUE(LoadScriptText(engine, COROUTINE_SCRIPT));
+	
+	EXPECT_EQ(CallScript(engine, "void NotACoroutine()"), static_cast<int>(asEXECUTION_EXCEPTION));
+}
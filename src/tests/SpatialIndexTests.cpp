@@ -0,0 +1,161 @@
+/**
+* \file
+* \author agent
+* \date 2026-10-19
+* \brief Tests of SpatialIndex queries against a scan of every entity.
+*/
+
+#include "UnitTest.h"
+
+// Standard Includes
+#include <algorithm>
+#include <set>
+#include <string>
+#include <vector>
+
+// Library Includes
+#include <boost/lexical_cast.hpp>
+#include <boost/random/mersenne_twister.hpp>
+#include <boost/random/uniform_real_distribution.hpp>
+
+// Local Includes
+#include "../sharedbase/Entity.h"
+#include "../enginecore/EntityMap.h"
+#include "../enginecore/SpatialIndex.h"
+
+// Local Types
+namespace {
+	/// Entities scattered over a region larger than a few cells, some of them parented so that they move with another.
+	struct ScatteredWorld {
+		ScatteredWorld(unsigned int count) : index(map) {
+			boost::random::mt19937 generator(20120822u);
+			boost::random::uniform_real_distribution<float> coordinate(-50.0f, 50.0f);
+			
+			for (unsigned int entity_index = 0; entity_index < count; ++entity_index) {
+				EntitySPTR entity(Entity::Factory("entity" + boost::lexical_cast<std::string>(entity_index)));
+				entity->SetPosition(coordinate(generator), coordinate(generator), coordinate(generator));
+				
+				if (entity_index % 10 == 9) {
+					entity->SetParent(this->entities[entity_index - 1]);
+				}
+				
+				this->entities.push_back(entity);
+				this->map.AddEntity(entity);
+			}
+		}
+		
+		std::set<const Entity*> ScanRadius(const glm::vec3& center, float radius) const {
+			std::set<const Entity*> found;
+			for (std::vector<EntitySPTR>::const_iterator entity_it = this->entities.begin(); entity_it != this->entities.end(); ++entity_it) {
+				glm::vec3 offset = (*entity_it)->GetWorldPosition() - center;
+				if (glm::dot(offset, offset) <= radius * radius) {
+					found.insert(entity_it->get());
+				}
+			}
+			return found;
+		}
+		
+		static std::set<const Entity*> ToSet(const std::vector<EntitySPTR>& list) {
+			std::set<const Entity*> found;
+			for (std::vector<EntitySPTR>::const_iterator entity_it = list.begin(); entity_it != list.end(); ++entity_it) {
+				found.insert(entity_it->get());
+			}
+			return found;
+		}
+		
+		EntityMap map;
+		SpatialIndex index;
+		std::vector<EntitySPTR> entities;
+	};
+}
+
+TEST(SpatialIndex, RadiusMatchesScan) {
+	ScatteredWorld world(500);
+	
+	EXPECT_EQ(world.index.GetCount(), 500u);
+	
+	const float radii[] = {0.0f, 3.0f, 12.5f, 40.0f, 500.0f};
+	for (unsigned int index = 0; index < 5; ++index) {
+		glm::vec3 center(5.0f, -7.0f, 11.0f);
+		std::vector<EntitySPTR> found;
+		
+		unsigned int count = world.index.FindInRadius(center, radii[index], found);
+		
+		EXPECT_EQ(count, static_cast<unsigned int>(found.size()));
+		EXPECT_TRUE(ScatteredWorld::ToSet(found) == world.ScanRadius(center, radii[index]));
+	}
+}
+
+TEST(SpatialIndex, BoxMatchesScan) {
+	ScatteredWorld world(500);
+	glm::vec3 low(-20.0f, 0.0f, -35.0f), high(10.0f, 45.0f, -5.0f);
+	
+	std::set<const Entity*> expected;
+	for (std::vector<EntitySPTR>::const_iterator entity_it = world.entities.begin(); entity_it != world.entities.end(); ++entity_it) {
+		glm::vec3 position = (*entity_it)->GetWorldPosition();
+		if (position.x >= low.x && position.y >= low.y && position.z >= low.z && position.x <= high.x && position.y <= high.y && position.z <= high.z) {
+			expected.insert(entity_it->get());
+		}
+	}
+	
+	std::vector<EntitySPTR> found;
+	world.index.FindInBox(low, high, found);
+	EXPECT_TRUE(ScatteredWorld::ToSet(found) == expected);
+	
+	// An inside out box holds nothing.
+	found.clear();
+	EXPECT_EQ(world.index.FindInBox(high, low, found), 0u);
+}
+
+TEST(SpatialIndex, NearestMatchesScan) {
+	ScatteredWorld world(500);
+	
+	const glm::vec3 points[] = {glm::vec3(0.0f, 0.0f, 0.0f), glm::vec3(49.0f, -49.0f, 20.0f), glm::vec3(400.0f, 0.0f, 0.0f)};
+	const unsigned int counts[] = {1, 7, 600};
+	
+	for (unsigned int index = 0; index < 3; ++index) {
+		std::vector<float> distances;
+		for (std::vector<EntitySPTR>::const_iterator entity_it = world.entities.begin(); entity_it != world.entities.end(); ++entity_it) {
+			distances.push_back(glm::distance((*entity_it)->GetWorldPosition(), points[index]));
+		}
+		std::sort(distances.begin(), distances.end());
+		
+		std::vector<EntitySPTR> found;
+		unsigned int count = world.index.FindNearest(points[index], counts[index], found);
+		
+		ASSERT_EQ(count, std::min(counts[index], 500u));
+		for (unsigned int rank = 0; rank < count; ++rank) {
+			EXPECT_NEAR(glm::distance(found[rank]->GetWorldPosition(), points[index]), distances[rank], 1e-4f);
+		}
+	}
+}
+
+TEST(SpatialIndex, FollowsMovesAndRemovals) {
+	ScatteredWorld world(100);
+	glm::vec3 far_away(1000.0f, 1000.0f, 1000.0f);
+	std::vector<EntitySPTR> found;
+	
+	// Moving a parent moves its child along with it, once the index is updated.
+	world.entities[8]->SetPosition(far_away.x, far_away.y, far_away.z);
+	EXPECT_EQ(world.index.FindInRadius(far_away, 200.0f, found), 0u);
+	
+	world.index.Update();
+	EXPECT_EQ(world.index.FindInRadius(far_away, 200.0f, found), 2u);
+	
+	found.clear();
+	world.map.RemoveEntity(world.entities[9]->GetName());
+	EXPECT_EQ(world.index.FindInRadius(far_away, 200.0f, found), 1u);
+	EXPECT_TRUE(found[0] == world.entities[8]);
+	EXPECT_EQ(world.index.GetCount(), 99u);
+	
+	// Rebuilding with another cell size finds the same.
+	std::set<const Entity*> expected = world.ScanRadius(glm::vec3(0.0f, 0.0f, 0.0f), 25.0f);
+	expected.erase(world.entities[9].get());
+	
+	found.clear();
+	world.index.SetCellSize(3.5f);
+	world.index.FindInRadius(glm::vec3(0.0f, 0.0f, 0.0f), 25.0f, found);
+	EXPECT_TRUE(ScatteredWorld::ToSet(found) == expected);
+	
+	world.map.DestroyRemovedEntities();
+}
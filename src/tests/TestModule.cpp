@@ -0,0 +1,67 @@
+/**
+* \file
+* \author agent
+* \date 2026-10-19
+* \brief A module library for the ModuleManager tests, reporting what is done to it through the OS it is given.
+* \details Built as the nlstestmodule library, which the tests copy under the names of the modules they load.
+*/
+
+// Standard Includes
+#include <string>
+
+// Library Includes
+#include <boost/lexical_cast.hpp>
+
+// Local Includes
+#include "../sharedbase/Envelope.h"
+#include "../sharedbase/ModuleInterface.h"
+#include "../sharedbase/OSInterface.h"
+
+// Local Types
+namespace {
+	/// Counts its updates, and hands the count on when reloaded.
+	class TestModule : public ModuleInterface {
+	public:
+		TestModule(OSInterfaceSPTR os) : os(os), updates(0) {
+			this->Report("constructed");
+		}
+		
+		~TestModule() {
+			this->Report("deleted");
+		}
+		
+		void Update(double) {
+			++this->updates;
+			this->Report("updated " + boost::lexical_cast<std::string>(this->updates));
+		}
+		
+		WHO_DELETES::TYPE RemoveComponent(ComponentInterface*) {
+			return WHO_DELETES::CALLER;
+		}
+		
+		bool SaveState(EnvelopeSPTR state) {
+			state->AddData(this->updates);
+			return true;
+		}
+		
+		void RestoreState(EnvelopeSPTR state) {
+			this->updates = state->GetDataInt(0);
+			this->Report("restored " + boost::lexical_cast<std::string>(this->updates));
+		}
+		
+	private:
+		/// The OS of the tests notes each message, and the thread it came from.
+		void Report(const std::string& message) {
+			this->os->ShowInfo(message, "nlstestmodule");
+		}
+		
+		OSInterfaceSPTR os;
+		int updates;
+	};
+}
+
+NLS_MODULE_EXPORT ModuleInterface* ModuleFactory(OSInterfaceSPTR os) {
+	return new TestModule(os);
+}
+
+NLS_MODULE_INTERFACE_VERSION()
@@ -0,0 +1,111 @@
+/**
+* \file
+* \author agent
+* \date 2026-10-19
+* \brief Minimal native unit test framework.
+*/
+
+#include "UnitTest.h"
+
+// Standard Includes
+#include <iostream>
+
+// Library Includes
+#include <boost/chrono.hpp>
+
+// Local Includes
+
+namespace UnitTest {
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+	Registry& Registry::Get() {
+		static Registry registry;
+		return registry;
+	}
+	
+	void Registry::Add(const std::string& group, const std::string& name, TestFunction function) {
+		this->tests.push_back(Test(group, name, function));
+	}
+	
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+	unsigned int Registry::Run(const std::vector<std::string>& filters) {
+		unsigned int ran = 0;
+		std::vector<std::string> failures;
+		
+		for (std::vector<Test>::iterator test_it = this->tests.begin(); test_it != this->tests.end(); ++test_it) {
+			std::string full_name(test_it->group + "." + test_it->name);
+			
+			bool selected = filters.empty();
+			for (std::vector<std::string>::const_iterator filter_it = filters.begin(); !selected && filter_it != filters.end(); ++filter_it) {
+				selected = (full_name.compare(0, filter_it->size(), *filter_it) == 0);
+			}
+			if (!selected) {
+				continue;
+			}
+			
+			std::cout << "[ RUN      ] " << full_name << std::endl;
+			
+			this->checks = 0;
+			this->failed = false;
+			
+			boost::chrono::steady_clock::time_point start = boost::chrono::steady_clock::now();
+			try {
+				test_it->function();
+			}
+			catch (AbortTest&) {
+				// The failed assertion has already been reported.
+			}
+			catch (std::exception& e) {
+				this->Record(false, std::string("Unexpected exception: ") + e.what(), __FILE__, __LINE__, false);
+			}
+			boost::chrono::milliseconds elapsed = boost::chrono::duration_cast<boost::chrono::milliseconds>(boost::chrono::steady_clock::now() - start);
+			
+			std::cout << (this->failed ? "[  FAILED  ] " : "[       OK ] ") << full_name << " (" << this->checks << " checks, " << elapsed.count() << " ms)" << std::endl;
+			
+			if (this->failed) {
+				failures.push_back(full_name);
+			}
+			++ran;
+		}
+		
+		std::cout << "[==========] " << ran << " tests ran, " << (ran - failures.size()) << " passed." << std::endl;
+		for (std::vector<std::string>::iterator failure_it = failures.begin(); failure_it != failures.end(); ++failure_it) {
+			std::cout << "[  FAILED  ] " << *failure_it << std::endl;
+		}
+		
+		return static_cast<unsigned int>(failures.size());
+	}
+	
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+	void Registry::Record(bool passed, const std::string& message, const char* file, int line, bool fatal) {
+		++this->checks;
+		
+		if (passed) {
+			return;
+		}
+		
+		this->failed = true;
+		
+		std::cout << file << "(" << line << "): Failure: " << message << std::endl;
+		
+		if (fatal) {
+			throw AbortTest();
+		}
+	}
+	
+	/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+	std::string Describe(const bool& value) {
+		return value ? "true" : "false";
+	}
+	
+	std::string Describe(const glm::vec3& value) {
+		std::ostringstream out;
+		out << "(" << value.x << ", " << value.y << ", " << value.z << ")";
+		return out.str();
+	}
+	
+	std::string Describe(const glm::fquat& value) {
+		std::ostringstream out;
+		out << "(" << value.x << ", " << value.y << ", " << value.z << ", " << value.w << ")";
+		return out.str();
+	}
+}
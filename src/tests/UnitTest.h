@@ -0,0 +1,136 @@
+/**
+* \file
+* \author agent
+* \date 2026-10-19
+* \brief Minimal native unit test framework.
+*
+* Tests are declared with TEST(Group, Name) { ... } and checked with the EXPECT_ and ASSERT_ macros, named after the
+* ones in ScriptUnitTests/TestFramework.as.  An EXPECT_ failure marks the test as failed and carries on, an ASSERT_
+* failure also ends the test.
+*/
+#pragma once
+
+// Standard Includes
+#include <cmath>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Library Includes
+#include <glm/glm.hpp>
+#include <glm/gtx/quaternion.hpp>
+
+// Local Includes
+
+// Forward Declarations
+
+// Typedefs
+
+namespace UnitTest {
+	typedef void (*TestFunction)();
+	
+	/**
+	* \brief Holds every declared test and runs them.
+	*/
+	class Registry {
+	public:
+		static Registry& Get();
+		
+		void Add(const std::string& group, const std::string& name, TestFunction);
+		
+		/// Runs the tests whose "Group.Name" starts with one of the filters, or all tests when there are none.  Returns the number of failed tests.
+		unsigned int Run(const std::vector<std::string>& filters);
+		
+		/// Records the outcome of a single check in the running test.
+		void Record(bool passed, const std::string& message, const char* file, int line, bool fatal);
+		
+	private:
+		struct Test {
+			Test(const std::string& group, const std::string& name, TestFunction function) : group(group), name(name), function(function) {}
+			
+			std::string group;
+			std::string name;
+			TestFunction function;
+		};
+		
+		Registry() : checks(0), failed(false) {}
+		
+		std::vector<Test> tests;
+		unsigned int checks; ///< Checks made by the running test.
+		bool failed; ///< Whether the running test has failed a check.
+	};
+	
+	/// Adds a test to the registry during static initialization.
+	struct Registrar {
+		Registrar(const char* group, const char* name, TestFunction function) {
+			Registry::Get().Add(group, name, function);
+		}
+	};
+	
+	/// Thrown by a failed ASSERT_ to leave the test.
+	struct AbortTest {};
+	
+	/// Formats a value for a failure message.
+	template <typename T>
+	std::string Describe(const T& value) {
+		std::ostringstream out;
+		out << value;
+		return out.str();
+	}
+	
+	std::string Describe(const bool&);
+	std::string Describe(const glm::vec3&);
+	std::string Describe(const glm::fquat&);
+	
+	inline bool Near(const float& a, const float& b, const float& range) {
+		return std::fabs(a - b) < range;
+	}
+	
+	inline bool Near(const double& a, const double& b, const double& range) {
+		return std::fabs(a - b) < range;
+	}
+	
+	inline bool Near(const glm::vec3& a, const glm::vec3& b, const float& range) {
+		return Near(a.x, b.x, range) && Near(a.y, b.y, range) && Near(a.z, b.z, range);
+	}
+	
+	/// Quaternions q and -q are the same rotation.
+	inline bool Near(const glm::fquat& a, const glm::fquat& b, const float& range) {
+		return std::fabs(a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w) > 1.0f - range;
+	}
+	
+	inline void Check(bool passed, const std::string& expression, const char* file, int line, bool fatal) {
+		Registry::Get().Record(passed, expression, file, line, fatal);
+	}
+	
+	template <typename A, typename B>
+	void CheckEqual(const A& a, const B& b, bool expect_equal, const char* expression, const char* file, int line, bool fatal) {
+		bool passed = expect_equal ? (a == b) : !(a == b);
+		Registry::Get().Record(passed, passed ? "" : std::string(expression) + " with values " + Describe(a) + " and " + Describe(b), file, line, fatal);
+	}
+	
+	template <typename A, typename B, typename R>
+	void CheckNear(const A& a, const B& b, const R& range, const char* expression, const char* file, int line, bool fatal) {
+		bool passed = Near(a, b, range);
+		Registry::Get().Record(passed, passed ? "" : std::string(expression) + " with values " + Describe(a) + " and " + Describe(b), file, line, fatal);
+	}
+}
+
+/// Declares and registers a test.
+#define TEST(group, name) \
+	static void UnitTest_##group##_##name(); \
+	static ::UnitTest::Registrar UnitTest_Registrar_##group##_##name(#group, #name, &UnitTest_##group##_##name); \
+	static void UnitTest_##group##_##name()
+
+#define EXPECT_TRUE(a)  ::UnitTest::Check(!!(a), "EXPECT_TRUE(" #a ")", __FILE__, __LINE__, false)
+#define ASSERT_TRUE(a)  ::UnitTest::Check(!!(a), "ASSERT_TRUE(" #a ")", __FILE__, __LINE__, true)
+#define EXPECT_FALSE(a) ::UnitTest::Check(!(a), "EXPECT_FALSE(" #a ")", __FILE__, __LINE__, false)
+#define ASSERT_FALSE(a) ::UnitTest::Check(!(a), "ASSERT_FALSE(" #a ")", __FILE__, __LINE__, true)
+
+#define EXPECT_EQ(a, b) ::UnitTest::CheckEqual((a), (b), true, "EXPECT_EQ(" #a ", " #b ")", __FILE__, __LINE__, false)
+#define ASSERT_EQ(a, b) ::UnitTest::CheckEqual((a), (b), true, "ASSERT_EQ(" #a ", " #b ")", __FILE__, __LINE__, true)
+#define EXPECT_NE(a, b) ::UnitTest::CheckEqual((a), (b), false, "EXPECT_NE(" #a ", " #b ")", __FILE__, __LINE__, false)
+#define ASSERT_NE(a, b) ::UnitTest::CheckEqual((a), (b), false, "ASSERT_NE(" #a ", " #b ")", __FILE__, __LINE__, true)
+
+#define EXPECT_NEAR(a, b, range) ::UnitTest::CheckNear((a), (b), (range), "EXPECT_NEAR(" #a ", " #b ")", __FILE__, __LINE__, false)
+#define ASSERT_NEAR(a, b, range) ::UnitTest::CheckNear((a), (b), (range), "ASSERT_NEAR(" #a ", " #b ")", __FILE__, __LINE__, true)
@@ -0,0 +1,197 @@
+/**
+* \file
+* \author agent
+* \date 2026-10-19
+* \brief Tests of WorldSnapshot saving and loading, including across restarts.
+*/
+
+#include "UnitTest.h"
+
+// Standard Includes
+#include <string>
+
+// Library Includes
+#include <boost/filesystem.hpp>
+
+// Local Includes
+#include "../sharedbase/Entity.h"
+#include "../enginecore/EntityMap.h"
+#include "../enginecore/WorldSnapshot.h"
+
+// Local Types
+namespace {
+	/// A base path in the temp folder whose snapshot files are removed when the test ends.
+	struct TempSnapshot {
+		TempSnapshot() : path((boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("nlstest-%%%%%%%%")).string()) {}
+		
+		~TempSnapshot() {
+			boost::system::error_code error;
+			boost::filesystem::remove(this->path + ".snapshot", error);
+			boost::filesystem::remove_all(this->path + ".journal", error);
+			boost::filesystem::remove(this->path + ".stale", error);
+		}
+		
+		/// Keeps a copy of the journal as it is now.
+		void KeepJournal() {
+			boost::filesystem::copy_file(this->path + ".journal", this->path + ".stale", boost::filesystem::copy_option::overwrite_if_exists);
+		}
+		
+		/// Puts back the kept journal, as though emptying it had failed.
+		void RestoreJournal() {
+			boost::filesystem::copy_file(this->path + ".stale", this->path + ".journal", boost::filesystem::copy_option::overwrite_if_exists);
+		}
+		
+		std::string path;
+	};
+	
+	/// Loads the snapshot into a new map, as a restarted process would, and returns the named entity.
+	EntitySPTR LoadEntity(const std::string& path, const std::string& name, EntityMap& map) {
+		WorldSnapshot snapshot(map);
+		snapshot.SetPath(path);
+		if (!snapshot.Load()) {
+			return EntitySPTR();
+		}
+		
+		const NamedEntityMap& entities = map.GetEntities();
+		NamedEntityMap::const_iterator entity_it = entities.find(&name);
+		return (entity_it != entities.end()) ? entity_it->second : EntitySPTR();
+	}
+}
+
+TEST(WorldSnapshot, ReloadsFullSnapshotAndDeltas) {
+	TempSnapshot files;
+	glm::fquat turret_rotation;
+	
+	{
+		EntityMap map;
+		WorldSnapshot snapshot(map);
+		snapshot.SetPath(files.path);
+		
+		EntitySPTR ship(Entity::Factory("ship"));
+		EntitySPTR turret(Entity::Factory("turret"));
+		EntitySPTR crate(Entity::Factory("crate"));
+		map.AddEntity(ship);
+		map.AddEntity(turret);
+		map.AddEntity(crate);
+		turret->SetParent(ship);
+		ASSERT_TRUE(snapshot.SaveFull());
+		
+		ship->SetPosition(1.0f, 2.0f, 3.0f);
+		ASSERT_TRUE(snapshot.SaveDelta());
+		
+		map.RemoveEntity("crate");
+		map.DestroyRemovedEntities();
+		EntitySPTR barrel(Entity::Factory("barrel"));
+		map.AddEntity(barrel);
+		barrel->SetScale(4.0f);
+		turret->SetRotation(0.0f, 1.0f, 0.0f);
+		turret_rotation = turret->rotation;
+		ASSERT_TRUE(snapshot.SaveDelta());
+		
+		// Nothing changed, nothing written.
+		ASSERT_TRUE(snapshot.SaveDelta());
+	}
+	
+	EntityMap map;
+	EntitySPTR ship(LoadEntity(files.path, "ship", map));
+	ASSERT_TRUE(ship);
+	EXPECT_EQ(map.GetEntities().size(), 3u);
+	EXPECT_EQ(ship->location, glm::vec3(1.0f, 2.0f, 3.0f));
+	
+	const NamedEntityMap& entities = map.GetEntities();
+	std::string turret_name("turret"), barrel_name("barrel"), crate_name("crate");
+	ASSERT_TRUE(entities.find(&turret_name) != entities.end());
+	ASSERT_TRUE(entities.find(&barrel_name) != entities.end());
+	EXPECT_TRUE(entities.find(&crate_name) == entities.end());
+	
+	EntitySPTR turret(entities.find(&turret_name)->second);
+	EXPECT_TRUE(turret->GetParent() == ship);
+	EXPECT_NEAR(turret->rotation, turret_rotation, 1e-5f);
+	EXPECT_EQ(entities.find(&barrel_name)->second->scale, 4.0f);
+}
+
+TEST(WorldSnapshot, RestartIgnoresStaleJournal) {
+	TempSnapshot files;
+	
+	{
+		EntityMap map;
+		WorldSnapshot snapshot(map);
+		snapshot.SetPath(files.path);
+		
+		EntitySPTR ship(Entity::Factory("ship"));
+		map.AddEntity(ship);
+		ASSERT_TRUE(snapshot.SaveFull());
+		
+		ship->SetPosition(2.0f, 0.0f, 0.0f);
+		ASSERT_TRUE(snapshot.SaveDelta());
+		files.KeepJournal();
+		
+		ship->SetPosition(3.0f, 0.0f, 0.0f);
+		ASSERT_TRUE(snapshot.SaveFull());
+		files.RestoreJournal();
+	}
+	
+	// A restart saves without loading first, and the journal again fails to be emptied.
+	{
+		EntityMap map;
+		WorldSnapshot snapshot(map);
+		snapshot.SetPath(files.path);
+		
+		EntitySPTR ship(Entity::Factory("ship"));
+		map.AddEntity(ship);
+		ship->SetPosition(4.0f, 0.0f, 0.0f);
+		ASSERT_TRUE(snapshot.SaveDelta()); // Nothing to build on, so a full snapshot.
+		files.RestoreJournal();
+		
+		ship->SetPosition(5.0f, 0.0f, 0.0f);
+		ASSERT_TRUE(snapshot.SaveDelta());
+	}
+	
+	// The stale record is older than the snapshot, and the new one newer.
+	{
+		EntityMap map;
+		EntitySPTR ship(LoadEntity(files.path, "ship", map));
+		ASSERT_TRUE(ship);
+		EXPECT_EQ(ship->location, glm::vec3(5.0f, 0.0f, 0.0f));
+	}
+	
+	// Loaded and saved on from there, the numbering still carries on.
+	{
+		EntityMap map;
+		WorldSnapshot snapshot(map);
+		snapshot.SetPath(files.path);
+		ASSERT_TRUE(snapshot.Load());
+		
+		EntitySPTR ship(map.GetEntities().begin()->second);
+		ship->SetPosition(6.0f, 0.0f, 0.0f);
+		ASSERT_TRUE(snapshot.SaveDelta());
+	}
+	
+	EntityMap map;
+	EntitySPTR ship(LoadEntity(files.path, "ship", map));
+	ASSERT_TRUE(ship);
+	EXPECT_EQ(ship->location, glm::vec3(6.0f, 0.0f, 0.0f));
+}
+
+TEST(WorldSnapshot, FullSaveFailsIfJournalCantBeEmptied) {
+	TempSnapshot files;
+	boost::filesystem::create_directory(files.path + ".journal");
+	
+	EntityMap map;
+	WorldSnapshot snapshot(map);
+	snapshot.SetPath(files.path);
+	
+	EntitySPTR ship(Entity::Factory("ship"));
+	map.AddEntity(ship);
+	EXPECT_FALSE(snapshot.SaveFull());
+	
+	// And the next save tries a full one again.
+	boost::filesystem::remove(files.path + ".journal");
+	ship->SetPosition(1.0f, 0.0f, 0.0f);
+	EXPECT_TRUE(snapshot.SaveDelta());
+	
+	EntityMap loaded_map;
+	EntitySPTR loaded(LoadEntity(files.path, "ship", loaded_map));
+	ASSERT_TRUE(loaded);
+	EXPECT_EQ(loaded->location, glm::vec3(1.0f, 0.0f, 0.0f));
+}
@@ -0,0 +1,28 @@
+/**
+* \file
+* \author agent
+* \date 2026-10-19
+* \brief Entry point of the native unit tests.
+*
+* Usage: nlstest [Group[.Name] ...]
+* Runs every test, or only those whose names start with one of the given filters.  Exits non-zero if any test failed.
+*/
+
+// Standard Includes
+#include <string>
+#include <vector>
+
+// Library Includes
+
+// Local Includes
+#include "UnitTest.h"
+#include "../sharedbase/EventLogger.h"
+
+int main(int argc, char* argv[]) {
+	std::vector<std::string> filters(argv + 1, argv + argc);
+	
+	EventLogger::module = "UnitTest";
+	EventLogger::GetEventLogger()->SetLogFile("nlstest.log");
+	
+	return UnitTest::Registry::Get().Run(filters) == 0 ? 0 : 1;
+}